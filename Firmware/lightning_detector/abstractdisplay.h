@@ -49,7 +49,8 @@ public:
     virtual void setup() const = 0;                 ///< \copybrief AS3935::setup()
     //
     virtual void init() const = 0;                  ///< Initialize the display.
-    virtual void sleep() const = 0;                 ///< Send the display to sleep/off mode.
+    virtual void sleep() const = 0;                 ///< Send the display to sleep mode (retaining its content/state if supported).
+    virtual void powerOff() const = 0;              ///< Fully turn off the display (after sleep()).
     //
     virtual void clear() = 0;                       ///< Clear the display content.
     /*!
@@ -57,6 +58,8 @@ public:
      *
      * \note The overall formatting and which parts of the passed information are shown is up to the specific implementation.
      *
+     * \note The actual display refresh may run asynchronously (see service() and refreshing()).
+     *
      * \param pNumLightnings Accumulated number of lightnings.
      * \param pLightningRate Current lightning rate as number of lightnings per minute.
      * \param pStormDist AS3935-internal estimate of storm distance in kilometers.
@@ -69,6 +72,9 @@ public:
      */
     virtual void update(size_t pNumLightnings, float pLightningRate, uint8_t pStormDist, float pBatteryPercentage, float pBatteryVoltage,
                         float pRunTimeHours, Auxil::RunMode pMode, bool pSerialEnabled, AS3935::InterruptType pLastInterrupt) = 0;
+    //
+    virtual void service() = 0;                     ///< Continue an asynchronous display refresh (call regularly while refreshing()).
+    virtual bool refreshing() const = 0;            ///< Check if an asynchronous display refresh is in progress.
 
 private:
     /*!
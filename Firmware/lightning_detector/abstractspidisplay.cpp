@@ -26,6 +26,10 @@
 #include "spiconfig.h"
 #include "i2cconfig.h"
 
+#include <algorithm>
+
+NRF_SPIM_Type *const AbstractSPIDisplay::spim = NRF_SPIM2;
+
 /*!
  * \brief Constructor.
  *
@@ -53,3 +57,90 @@ void AbstractSPIDisplay::setup() const
     SPIConfig::enableSPI();
     I2CConfig::enableI2C();
 }
+
+//Protected
+
+/*!
+ * \brief Transmit many data bytes via EasyDMA while sleeping.
+ *
+ * Sends \p pLength bytes from \p pData by directly using the SPIM peripheral's EasyDMA (in chunks of maximum
+ * DMA transfer length), ignoring received data. While waiting for each transfer's END event the MCU sleeps
+ * (WFE with SEVONPEND; the SPIM interrupt itself is temporarily disabled in the NVIC). If the SPI instance
+ * is used in legacy (non-DMA) SPI mode, it is temporarily switched to SPIM mode, which shares the pin,
+ * frequency and mode configuration. Falls back to SPI.transfer() if \p pData is not located in data RAM.
+ *
+ * \attention Must be called within an SPI transaction (SPI.beginTransaction()), with chip select and
+ *            any other control signals (such as data/command) already set up by the display driver.
+ *
+ * \param pData Data bytes.
+ * \param pLength Number of data bytes.
+ */
+void AbstractSPIDisplay::transferBulk(const uint8_t* pData, size_t pLength) const
+{
+    const uint32_t dataAddr = reinterpret_cast<uint32_t>(pData);
+
+    //EasyDMA can only access data RAM
+    if ((dataAddr < dataRAMStart) || (dataAddr + pLength > dataRAMEnd))
+    {
+        for (size_t i = 0; i < pLength; ++i)
+            SPI.transfer(*(pData+i));
+
+        return;
+    }
+
+    const uint32_t prevEnable = spim->ENABLE;
+
+    if (prevEnable != SPIM_ENABLE_ENABLE_Enabled)
+    {
+        spim->ENABLE = 0;
+        spim->ENABLE = SPIM_ENABLE_ENABLE_Enabled;
+    }
+
+    //Let the END event only wake up the MCU (pending IRQ + SEVONPEND) without calling any interrupt handler
+
+    const bool irqEnabled = (NVIC_GetEnableIRQ(spimIRQType) != 0);
+    const bool sevOnPend = ((SCB->SCR & SCB_SCR_SEVONPEND_Msk) != 0);
+
+    NVIC_DisableIRQ(spimIRQType);
+    SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+    spim->INTENSET = SPIM_INTENSET_END_Msk;
+
+    spim->RXD.MAXCNT = 0;
+
+    while (pLength > 0)
+    {
+        size_t chunkLength = std::min(pLength, static_cast<size_t>(SPIM_TXD_MAXCNT_MAXCNT_Msk));
+
+        spim->TXD.PTR = reinterpret_cast<uint32_t>(pData);
+        spim->TXD.MAXCNT = chunkLength;
+
+        spim->EVENTS_END = 0;
+        NVIC_ClearPendingIRQ(spimIRQType);
+
+        spim->TASKS_START = 1;
+
+        while (spim->EVENTS_END == 0)
+            __WFE();
+
+        pData += chunkLength;
+        pLength -= chunkLength;
+    }
+
+    spim->EVENTS_END = 0;
+    spim->INTENCLR = SPIM_INTENSET_END_Msk;
+
+    NVIC_ClearPendingIRQ(spimIRQType);
+
+    if (!sevOnPend)
+        SCB->SCR &= ~SCB_SCR_SEVONPEND_Msk;
+
+    if (irqEnabled)
+        NVIC_EnableIRQ(spimIRQType);
+
+    if (prevEnable != SPIM_ENABLE_ENABLE_Enabled)
+    {
+        spim->ENABLE = 0;
+        spim->ENABLE = prevEnable;
+    }
+}
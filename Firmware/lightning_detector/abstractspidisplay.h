@@ -41,6 +41,8 @@
  * To use the SPI bus for the display you will need to have an IO expander connected to the I2C bus to at least provide another
  * IO pin for the corresponding 'chip select' signal. The IO expander functionality must be implemented by your driver, too.
  * The I2C address of the IO expander must be already passed to this class' constructor (see AbstractSPIDisplay()).
+ *
+ * Larger amounts of data (e.g. the display buffer) should be sent via transferBulk(), which uses EasyDMA and lets the MCU sleep.
  */
 class AbstractSPIDisplay : public AbstractDisplay
 {
@@ -52,16 +54,31 @@ public:
     //
     void init() const override = 0;             ///< \copybrief AbstractDisplay::init()
     void sleep() const override = 0;            ///< \copybrief AbstractDisplay::sleep()
+    void powerOff() const override = 0;         ///< \copybrief AbstractDisplay::powerOff()
     //
     void clear() override = 0;                  ///< \copybrief AbstractDisplay::clear()
     void update(size_t pNumLightnings, float pLightningRate, uint8_t pStormDist, float pBatteryPercentage, float pBatteryVoltage,
                 float pRunTimeHours, Auxil::RunMode pMode, bool pSerialEnabled, AS3935::InterruptType pLastInterrupt) override = 0;
                                                 ///< \copydoc AbstractDisplay::update()
+    //
+    void service() override = 0;                ///< \copybrief AbstractDisplay::service()
+    bool refreshing() const override = 0;       ///< \copybrief AbstractDisplay::refreshing()
+
+protected:
+    void transferBulk(const uint8_t* pData, size_t pLength) const;  ///< Transmit many data bytes via EasyDMA while sleeping.
 
 private:
     virtual void selectChip() const = 0;        ///< Enable display's SPI 'chip select' signal.
     virtual void deselectChip() const = 0;      ///< Disable display's SPI 'chip select' signal.
 
+private:
+    static constexpr IRQn_Type spimIRQType = SPIM2_SPIS2_SPI2_IRQn; ///< IRQ type for used SPIM instance.
+    //
+    static NRF_SPIM_Type *const spim;   ///< Used SPIM instance (same as used by SPI library, see SPIConfig::enableSPI()).
+    //
+    static constexpr uint32_t dataRAMStart = 0x20000000;    ///< Start address of data RAM (accessible by EasyDMA).
+    static constexpr uint32_t dataRAMEnd = 0x20040000;      ///< End address (exclusive) of data RAM (accessible by EasyDMA).
+
 protected:
     const SPISettings spiSettings;      ///< Settings for SPI transactions.
     //
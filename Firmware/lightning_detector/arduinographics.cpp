@@ -25,6 +25,8 @@
 
 #include "arduinographics.h"
 
+#include <algorithm>
+
 /*!
  * \brief Constructor.
  *
@@ -48,7 +50,7 @@ ArduinoGraphics::ArduinoGraphics(int width, int height) :
     _strokeR(0),
     _strokeG(0),
     _strokeB(0),
-    _textBuffer(""),
+    _textBuffer(),
     _textR(0),
     _textG(0),
     _textB(0),
@@ -143,9 +145,8 @@ void ArduinoGraphics::background(uint32_t color)
  */
 void ArduinoGraphics::clear()
 {
-    for (int x = 0; x < _width; x++)
-        for (int y = 0; y < _height; y++)
-            set(x, y, _backgroundR, _backgroundG, _backgroundB);
+    for (int y = 0; y < _height; y++)
+        clippedHSpan(0, _width - 1, y, _backgroundR, _backgroundG, _backgroundB);
 }
 
 /*!
@@ -233,6 +234,9 @@ void ArduinoGraphics::circle(int x, int y, int diameter)
 /*!
  * \brief Draw an ellipse.
  *
+ * Uses the integer midpoint ellipse algorithm (see ellipseMidpoint()),
+ * first for the filling (if enabled) and then for the outline (if enabled).
+ *
  * \param x Ellipse center x-coordinate.
  * \param y Ellipse center y-coordinate.
  * \param width Ellipse width.
@@ -243,46 +247,24 @@ void ArduinoGraphics::ellipse(int x, int y, int width, int height)
     if (!_stroke && !_fill)
         return;
 
-    int32_t a = width / 2;
-    int32_t b = height / 2;
-    int64_t a2 = a * a;
-    int64_t b2 = b * b;
-    int64_t i, j;
+    int a = width / 2;
+    int b = height / 2;
+
+    if ((a < 0) || (b < 0))
+        return;
 
     if (_fill)
-    {
-        for (j = -b; j <= b; j++)
-        {
-            for (i = -a; i <= a; i++)
-            {
-                if (i*i*b2 + j*j*a2 <= a2*b2)
-                    set(x + i, y + j, _fillR, _fillG, _fillB);
-            }
-        }
-    }
+        ellipseMidpoint(x, y, a, b, true);
 
     if (_stroke)
-    {
-        int x_val, y_val;
-        for (i = -a; i <= a; i++)
-        {
-            y_val = b * sqrt(1 - static_cast<double>(i*i) / a2);
-            set(x + i, y + y_val, _strokeR, _strokeG, _strokeB);
-            set(x + i, y - y_val, _strokeR, _strokeG, _strokeB);
-        }
-        for (j = -b; j <= b; j++)
-        {
-            x_val = a * sqrt(1 - static_cast<double>(j*j) / b2);
-            set(x + x_val, y + j, _strokeR, _strokeG, _strokeB);
-            set(x - x_val, y + j, _strokeR, _strokeG, _strokeB);
-        }
-    }
+        ellipseMidpoint(x, y, a, b, false);
 }
 
 /*!
  * \brief Draw a line.
  *
- * \note Uses lineLow() and lineHigh() for oblique lines.
+ * \note Horizontal and vertical lines are drawn as (clipped) spans.
+ *       Uses lineLow() and lineHigh() for oblique lines.
  *
  * \param x1 Start point x-coordinate.
  * \param y1 Start point y-coordinate.
@@ -295,15 +277,11 @@ void ArduinoGraphics::line(int x1, int y1, int x2, int y2)
         return;
 
     if (x1 == x2)
-    {
-        for (int y = y1; y <= y2; y++)
-            set(x1, y, _strokeR, _strokeG, _strokeB);
-    }
+        clippedVSpan(x1, std::min(y1, y2), std::max(y1, y2), _strokeR, _strokeG, _strokeB);
     else if (y1 == y2)
-    {
-        for (int x = x1; x <= x2; x++)
-            set(x, y1, _strokeR, _strokeG, _strokeB);
-    }
+        clippedHSpan(std::min(x1, x2), std::max(x1, x2), y1, _strokeR, _strokeG, _strokeB);
+    else if ((std::max(x1, x2) < 0) || (std::max(y1, y2) < 0) || (std::min(x1, x2) >= _width) || (std::min(y1, y2) >= _height))
+        return; // offscreen
     else if (abs(y2 - y1) < abs(x2 - x1))
     {
         if (x1 > x2)
@@ -329,12 +307,15 @@ void ArduinoGraphics::line(int x1, int y1, int x2, int y2)
 void ArduinoGraphics::point(int x, int y)
 {
     if (_stroke)
-        set(x, y, _strokeR, _strokeG, _strokeB);
+        clippedPoint(x, y, _strokeR, _strokeG, _strokeB);
 }
 
 /*!
  * \brief Draw a rectangle.
  *
+ * The outline (if stroke enabled) is drawn as two horizontal and two vertical
+ * spans and the filling (if enabled) as one horizontal span per row.
+ *
  * \param x Start corner x-coordinate.
  * \param y Start corner y-coordinate.
  * \param width Rectangle width.
@@ -342,7 +323,7 @@ void ArduinoGraphics::point(int x, int y)
  */
 void ArduinoGraphics::rect(int x, int y, int width, int height)
 {
-    if (!_stroke && !_fill)
+    if ((!_stroke && !_fill) || (width <= 0) || (height <= 0))
         return;
 
     int x1 = x;
@@ -350,15 +331,25 @@ void ArduinoGraphics::rect(int x, int y, int width, int height)
     int x2 = x1 + width - 1;
     int y2 = y1 + height - 1;
 
-    for (x = x1; x <= x2; x++)
+    if (_fill)
     {
-        for (y = y1; y <= y2; y++)
-        {
-            if ((x == x1 || x == x2 || y == y1 || y == y2) && _stroke)
-                set(x, y, _strokeR, _strokeG, _strokeB);    // stroke
-            else if (_fill)
-                set(x, y, _fillR, _fillG, _fillB);          // fill
-        }
+        int border = _stroke ? 1 : 0;
+
+        for (y = y1 + border; y <= y2 - border; y++)
+            clippedHSpan(x1 + border, x2 - border, y, _fillR, _fillG, _fillB);
+    }
+
+    if (_stroke)
+    {
+        clippedHSpan(x1, x2, y1, _strokeR, _strokeG, _strokeB);
+
+        if (y2 != y1)
+            clippedHSpan(x1, x2, y2, _strokeR, _strokeG, _strokeB);
+
+        clippedVSpan(x1, y1 + 1, y2 - 1, _strokeR, _strokeG, _strokeB);
+
+        if (x2 != x1)
+            clippedVSpan(x2, y1 + 1, y2 - 1, _strokeR, _strokeG, _strokeB);
     }
 }
 
@@ -394,12 +385,10 @@ void ArduinoGraphics::text(const char* str, int x, int y)
         }
         else
         {
-            const uint16_t* b = _font->data[c];
-
-            if (b == nullptr)
-                b =  _font->data[0x20];
+            uint16_t b[Font::maxHeight];
 
-            if (b)
+            // fall back to space for characters without glyph
+            if (_font->decodeGlyph(c, b) || _font->decodeGlyph(' ', b))
                 bitmap(b, x, y, _font->width, _font->height);
 
             x += _font->width;
@@ -407,20 +396,6 @@ void ArduinoGraphics::text(const char* str, int x, int y)
     }
 }
 
-/*!
- * \brief Draw text.
- *
- * See also text(const char*, int, int).
- *
- * \param str The text.
- * \param x Cursor start position x-coordinate.
- * \param y Cursor start position y-coordinate.
- */
-void ArduinoGraphics::text(const String& str, int x, int y)
-{
-    text(str.c_str(), x, y);
-}
-
 /*!
  * \brief Set the text font.
  *
@@ -477,7 +452,7 @@ void ArduinoGraphics::set(int x, int y, uint32_t color)
  */
 void ArduinoGraphics::beginText(int x, int y)
 {
-    _textBuffer = "";
+    _textBuffer.clear();
 
     _textX = x;
     _textY = y;
@@ -516,7 +491,7 @@ void ArduinoGraphics::beginText(int x, int y, uint32_t color)
 /*!
  * \brief Draw the text currently in text buffer and clear text buffer.
  *
- * See also text(const String&, int, int).
+ * See also text(const char*, int, int).
  */
 void ArduinoGraphics::endText()
 {
@@ -528,7 +503,7 @@ void ArduinoGraphics::endText()
 
     stroke(_textR, _textG, _textB);
 
-    text(_textBuffer, _textX, _textY);
+    text(_textBuffer.c_str(), _textX, _textY);
 
     // restore the stroke color
     if (strokeOn)
@@ -537,7 +512,47 @@ void ArduinoGraphics::endText()
         noStroke();
 
     // clear the buffer
-    _textBuffer = "";
+    _textBuffer.clear();
+}
+
+//Protected
+
+/*!
+ * \brief Set the color of a horizontal span of pixels.
+ *
+ * Only called with spans that lie completely within the image (see clippedHSpan()).
+ * The default implementation calls set() for every pixel.
+ *
+ * \param x1 Start x-coordinate.
+ * \param x2 End x-coordinate (not smaller than \p x1).
+ * \param y Y-coordinate.
+ * \param r Red color value from 0 to 255.
+ * \param g Green color value from 0 to 255.
+ * \param b Blue color value from 0 to 255.
+ */
+void ArduinoGraphics::hSpan(int x1, int x2, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    for (int x = x1; x <= x2; x++)
+        set(x, y, r, g, b);
+}
+
+/*!
+ * \brief Set the color of a vertical span of pixels.
+ *
+ * Only called with spans that lie completely within the image (see clippedVSpan()).
+ * The default implementation calls set() for every pixel.
+ *
+ * \param x X-coordinate.
+ * \param y1 Start y-coordinate.
+ * \param y2 End y-coordinate (not smaller than \p y1).
+ * \param r Red color value from 0 to 255.
+ * \param g Green color value from 0 to 255.
+ * \param b Blue color value from 0 to 255.
+ */
+void ArduinoGraphics::vSpan(int x, int y1, int y2, uint8_t r, uint8_t g, uint8_t b)
+{
+    for (int y = y1; y <= y2; y++)
+        set(x, y, r, g, b);
 }
 
 //Private
@@ -562,14 +577,20 @@ void ArduinoGraphics::bitmap(const uint16_t* data, int x, int y, int width, int
     if (!_stroke)
         return;
 
-    if ((data == nullptr) || ((x + width) < 0) || ((y + height) < 0) || (x > _width) || (y > _height))
+    if ((data == nullptr) || ((x + width) <= 0) || ((y + height) <= 0) || (x >= _width) || (y >= _height))
         return; // offscreen
 
-    for (int j = 0; j < height; j++)
+    // clip to the image
+    int i1 = std::max(0, -x);
+    int j1 = std::max(0, -y);
+    int i2 = std::min(width, _width - x);
+    int j2 = std::min(height, _height - y);
+
+    for (int j = j1; j < j2; j++)
     {
         uint16_t b = data[j];
 
-        for (int i = 0; i < width; i++)
+        for (int i = i1; i < i2; i++)
         {
             if (b & (1 << (15 - i)))
                 set(x + i, y + j, _strokeR, _strokeG, _strokeB);
@@ -581,6 +602,71 @@ void ArduinoGraphics::bitmap(const uint16_t* data, int x, int y, int width, int
 
 //
 
+/*!
+ * \brief Clip a horizontal span to the image and draw it.
+ *
+ * See hSpan().
+ *
+ * \param x1 Start x-coordinate.
+ * \param x2 End x-coordinate (nothing is drawn if smaller than \p x1).
+ * \param y Y-coordinate.
+ * \param r Red color value from 0 to 255.
+ * \param g Green color value from 0 to 255.
+ * \param b Blue color value from 0 to 255.
+ */
+void ArduinoGraphics::clippedHSpan(int x1, int x2, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    if ((y < 0) || (y >= _height))
+        return;
+
+    x1 = std::max(x1, 0);
+    x2 = std::min(x2, _width - 1);
+
+    if (x1 <= x2)
+        hSpan(x1, x2, y, r, g, b);
+}
+
+/*!
+ * \brief Clip a vertical span to the image and draw it.
+ *
+ * See vSpan().
+ *
+ * \param x X-coordinate.
+ * \param y1 Start y-coordinate.
+ * \param y2 End y-coordinate (nothing is drawn if smaller than \p y1).
+ * \param r Red color value from 0 to 255.
+ * \param g Green color value from 0 to 255.
+ * \param b Blue color value from 0 to 255.
+ */
+void ArduinoGraphics::clippedVSpan(int x, int y1, int y2, uint8_t r, uint8_t g, uint8_t b)
+{
+    if ((x < 0) || (x >= _width))
+        return;
+
+    y1 = std::max(y1, 0);
+    y2 = std::min(y2, _height - 1);
+
+    if (y1 <= y2)
+        vSpan(x, y1, y2, r, g, b);
+}
+
+/*!
+ * \brief Draw a pixel if it lies within the image.
+ *
+ * \param x X-coordinate.
+ * \param y Y-coordinate.
+ * \param r Red color value from 0 to 255.
+ * \param g Green color value from 0 to 255.
+ * \param b Blue color value from 0 to 255.
+ */
+void ArduinoGraphics::clippedPoint(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height))
+        set(x, y, r, g, b);
+}
+
+//
+
 /*!
  * \brief Draw flat oblique lines with angle below 45 degrees to x-axis.
  *
@@ -606,7 +692,7 @@ void ArduinoGraphics::lineLow(int x1, int y1, int x2, int y2)
 
     for (int x = x1; x <= x2; x++)
     {
-        set(x, y, _strokeR, _strokeG, _strokeB);
+        clippedPoint(x, y, _strokeR, _strokeG, _strokeB);
 
         if (D > 0)
         {
@@ -643,7 +729,7 @@ void ArduinoGraphics::lineHigh(int x1, int y1, int x2, int y2)
 
     for (int y = y1; y <= y2; y++)
     {
-        set(x, y, _strokeR, _strokeG, _strokeB);
+        clippedPoint(x, y, _strokeR, _strokeG, _strokeB);
 
         if (D > 0)
         {
@@ -657,6 +743,112 @@ void ArduinoGraphics::lineHigh(int x1, int y1, int x2, int y2)
 
 //
 
+/*!
+ * \brief Draw the outline or the filling of an ellipse.
+ *
+ * Uses the midpoint ellipse algorithm with integer decision variables (scaled by 4 to avoid fractions),
+ * which steps along the first quadrant of the outline and mirrors each point to the other quadrants.
+ * The filling is drawn as one horizontal span between each pair of mirrored outline points, but only once per row:
+ * In the first region (where \p j stays the same for several steps of \p i) only the widest span of each row is drawn.
+ *
+ * \param x Ellipse center x-coordinate.
+ * \param y Ellipse center y-coordinate.
+ * \param a Horizontal semi-axis.
+ * \param b Vertical semi-axis.
+ * \param fill Draw the filling with fill color (instead of the outline with stroke color).
+ */
+void ArduinoGraphics::ellipseMidpoint(int x, int y, int a, int b, bool fill)
+{
+    auto plot = [this, x, y, fill](int i, int j) -> void
+    {
+        if (fill)
+        {
+            clippedHSpan(x - i, x + i, y + j, _fillR, _fillG, _fillB);
+
+            if (j != 0)
+                clippedHSpan(x - i, x + i, y - j, _fillR, _fillG, _fillB);
+        }
+        else
+        {
+            clippedPoint(x + i, y + j, _strokeR, _strokeG, _strokeB);
+            clippedPoint(x - i, y + j, _strokeR, _strokeG, _strokeB);
+            clippedPoint(x + i, y - j, _strokeR, _strokeG, _strokeB);
+            clippedPoint(x - i, y - j, _strokeR, _strokeG, _strokeB);
+        }
+    };
+
+    // degenerate ellipse (a horizontal line) is not covered by the algorithm below
+    if (b == 0)
+    {
+        if (fill)
+            clippedHSpan(x - a, x + a, y, _fillR, _fillG, _fillB);
+        else
+            clippedHSpan(x - a, x + a, y, _strokeR, _strokeG, _strokeB);
+
+        return;
+    }
+
+    int64_t a2 = static_cast<int64_t>(a) * a;
+    int64_t b2 = static_cast<int64_t>(b) * b;
+
+    int i = 0;
+    int j = b;
+
+    int64_t dx = 0;         // 2 * b^2 * i
+    int64_t dy = 2 * a2 * j; // 2 * a^2 * j
+
+    // region 1: slope magnitude below 1, step i
+    int64_t d = 4 * b2 - 4 * a2 * b + a2;
+
+    while (dx < dy)
+    {
+        if (!fill)
+            plot(i, j);
+
+        i++;
+        dx += 2 * b2;
+
+        if (d < 0)
+            d += 4 * (dx + b2);
+        else
+        {
+            // row is complete, fill it with its widest span
+            if (fill)
+                plot(i - 1, j);
+
+            j--;
+            dy -= 2 * a2;
+            d += 4 * (dx - dy + b2);
+        }
+    }
+
+    // fill the last (possibly incomplete) row of region 1
+    if (fill)
+        plot(i - 1, j);
+
+    // region 2: slope magnitude at least 1, step j
+    d = b2 * (2 * i + 1) * (2 * i + 1) + 4 * a2 * (j - 1) * (j - 1) - 4 * a2 * b2;
+
+    while (j >= 0)
+    {
+        plot(i, j);
+
+        j--;
+        dy -= 2 * a2;
+
+        if (d > 0)
+            d += 4 * (a2 - dy);
+        else
+        {
+            i++;
+            dx += 2 * b2;
+            d += 4 * (dx - dy + a2);
+        }
+    }
+}
+
+//
+
 /*!
  * \brief Extract red color value from RGB color value.
  *
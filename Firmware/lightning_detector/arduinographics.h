@@ -26,6 +26,7 @@
 #ifndef ARDUINOGRAPHICS_H
 #define ARDUINOGRAPHICS_H
 
+#include "fixedstring.h"
 #include "font.h"
 
 #include <Arduino.h>
@@ -37,6 +38,11 @@
  * to be applied on up to 24-bit RGB bitmaps. The graphics buffer format is a priori
  * arbitrary because it must be implemented by deriving from this abstract base class
  * and implementing the set(int, int, uint8_t, uint8_t, uint8_t) function anyway.
+ *
+ * All primitives are rasterized with integer arithmetic only and on top of horizontal and vertical
+ * pixel spans (see hSpan(), vSpan()), which are clipped to the image once before being drawn, such
+ * that set() is never called for pixels outside of the image. Derived classes can override the span
+ * functions with faster implementations for their specific buffer format.
  */
 class ArduinoGraphics
 {
@@ -67,7 +73,6 @@ public:
     void rect(int x, int y, int width, int height);     ///< Draw a rectangle.
     //
     void text(const char* str, int x = 0, int y = 0);   ///< Draw text.
-    void text(const String& str, int x = 0, int y = 0); ///< Draw text.
     void textFont(const Font* which);                   ///< Set the text font.
     //
     int textFontWidth() const;                          ///< Get the current font's character width.
@@ -90,12 +95,22 @@ public:
     void beginText(int x, int y, uint32_t color);                   ///< Clear text buffer, set cursor position and text color.
     void endText();                                                 ///< Draw the text currently in text buffer and clear text buffer.
 
+protected:
+    virtual void hSpan(int x1, int x2, int y, uint8_t r, uint8_t g, uint8_t b);  ///< Set the color of a horizontal span of pixels.
+    virtual void vSpan(int x, int y1, int y2, uint8_t r, uint8_t g, uint8_t b);  ///< Set the color of a vertical span of pixels.
+
 private:
     void bitmap(const uint16_t* data, int x, int y, int width, int height); ///< Insert a raw monochrome bitmap.
     //
+    void clippedHSpan(int x1, int x2, int y, uint8_t r, uint8_t g, uint8_t b);  ///< Clip a horizontal span to the image and draw it.
+    void clippedVSpan(int x, int y1, int y2, uint8_t r, uint8_t g, uint8_t b);  ///< Clip a vertical span to the image and draw it.
+    void clippedPoint(int x, int y, uint8_t r, uint8_t g, uint8_t b);           ///< Draw a pixel if it lies within the image.
+    //
     void lineLow(int x1, int y1, int x2, int y2);   ///< Draw flat oblique lines with angle below 45 degrees to x-axis.
     void lineHigh(int x1, int y1, int x2, int y2);  ///< Draw steep oblique lines with angle at least 45 degrees to x-axis.
     //
+    void ellipseMidpoint(int x, int y, int a, int b, bool fill);    ///< Draw the outline or the filling of an ellipse.
+    //
     static uint8_t colorR(uint32_t color);  ///< Extract red color value from RGB color value.
     static uint8_t colorG(uint32_t color);  ///< Extract green color value from RGB color value.
     static uint8_t colorB(uint32_t color);  ///< Extract blue color value from RGB color value.
@@ -117,7 +132,7 @@ private:
     uint8_t _strokeG;       ///< Stroke color green value.
     uint8_t _strokeB;       ///< Stroke color blue value.
     //
-    String _textBuffer;     ///< Text writing buffer.
+    FixedString<32> _textBuffer;    ///< Text writing buffer.
     uint8_t _textR;         ///< Text color red value.
     uint8_t _textG;         ///< Text color green value.
     uint8_t _textB;         ///< Text color blue value.
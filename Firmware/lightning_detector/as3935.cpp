@@ -92,22 +92,22 @@ void AS3935::disableInterrupt() const
  */
 void AS3935::writeConfiguration(const Configuration& pConfig) const
 {
-    uint8_t afeGb = pConfig.getRegister(Configuration::RegIdent::AFE_GB);
-    writeReg(0x00, (afeGb << 1));
-
-    uint8_t nfLev = pConfig.getRegister(Configuration::RegIdent::NF_LEV);
-    uint8_t wdTh = pConfig.getRegister(Configuration::RegIdent::WDTH);
-    writeReg(0x01, ((nfLev << 4) | wdTh));
-
-    uint8_t minNumLigh = pConfig.getRegister(Configuration::RegIdent::MIN_NUM_LIGH);
-    uint8_t sRej = pConfig.getRegister(Configuration::RegIdent::SREJ);
-    writeReg(0x02, ((((((static_cast<uint8_t>(1) << 1) | static_cast<uint8_t>(1)) << 2) | minNumLigh) << 4) | sRej));
-
-    uint8_t lcoFDiv = pConfig.getRegister(Configuration::RegIdent::LCO_FDIV);
-    writeReg(0x03, ((lcoFDiv << 6) | (readReg(0x03) & 0b00100000)));
+    writeConfigRegisters(pConfig, 0xFF);
+}
 
-    uint8_t tunCap = pConfig.getRegister(Configuration::RegIdent::TUN_CAP);
-    writeReg(0x08, (tunCap | (readReg(0x08) & 0b10000000)));
+/*!
+ * \brief Rewrite only changed configuration registers.
+ *
+ * Like writeConfiguration() but only writes those registers that contain fields that differ
+ * between \p pConfig and \p pPrevConfig (see Configuration::changedRegisters()).
+ * Lightning statistics, disturber masking and power-down state are not affected.
+ *
+ * \param pConfig New configuration to write.
+ * \param pPrevConfig Configuration that was written before.
+ */
+void AS3935::updateConfiguration(const Configuration& pConfig, const Configuration& pPrevConfig) const
+{
+    writeConfigRegisters(pConfig, pConfig.changedRegisters(pPrevConfig));
 }
 
 //
@@ -167,6 +167,35 @@ void AS3935::clearStatistics() const
 
 //
 
+/*!
+ * \brief Enter power-down mode.
+ *
+ * Stops the lightning detection (no more interrupt requests) to save power. See also powerUp().
+ */
+void AS3935::powerDown() const
+{
+    writeReg(0x00, (readReg(0x00) | 0b00000001));
+}
+
+/*!
+ * \brief Leave power-down mode.
+ *
+ * Resumes the lightning detection after powerDown(). As required by the datasheet, the RC
+ * oscillators are recalibrated afterwards (direct command \p CALIB_RCO and \p DISP_TRCO toggle for 2ms).
+ */
+void AS3935::powerUp() const
+{
+    writeReg(0x00, (readReg(0x00) & 0b11111110));
+
+    writeReg(0x3D, 0x96);
+
+    writeReg(0x08, (readReg(0x08) | 0b00100000));
+    delay(2);
+    writeReg(0x08, (readReg(0x08) & 0b11011111));
+}
+
+//
+
 /*!
  * \brief Check for interrupt request signal.
  *
@@ -241,8 +270,72 @@ AS3935::InterruptType AS3935::processIRQ(uint32_t& pEnergy, uint8_t& pDistance)
     return static_cast<InterruptType>(intType);
 }
 
+//
+
+/*!
+ * \brief Read value from a register for diagnostic purposes.
+ *
+ * \param pAddr Register address (from 0x00 to \p maxRegisterAddr).
+ * \return Read value (0 for inaccessible registers).
+ */
+uint8_t AS3935::dumpRegister(uint8_t pAddr) const
+{
+    return readReg(pAddr);
+}
+
 //Private
 
+/*!
+ * \brief Write configuration registers containing some fields.
+ *
+ * Writes each register that contains at least one of the fields \p pFields
+ * (preserving the power-down, disturber masking and antenna tuning bits).
+ *
+ * \param pConfig Configuration to write.
+ * \param pFields Bit mask of fields with bit number \p static_cast<uint8_t>(reg) set for each field \p reg to write.
+ */
+void AS3935::writeConfigRegisters(const Configuration& pConfig, uint8_t pFields) const
+{
+    auto hasField = [pFields](Configuration::RegIdent pReg) -> bool
+    {
+        return (pFields & (static_cast<uint8_t>(1) << static_cast<uint8_t>(pReg))) != 0;
+    };
+
+    if (hasField(Configuration::RegIdent::AFE_GB))
+    {
+        uint8_t afeGb = pConfig.getRegister(Configuration::RegIdent::AFE_GB);
+        writeReg(0x00, ((afeGb << 1) | (readReg(0x00) & 0b00000001)));
+    }
+
+    if (hasField(Configuration::RegIdent::NF_LEV) || hasField(Configuration::RegIdent::WDTH))
+    {
+        uint8_t nfLev = pConfig.getRegister(Configuration::RegIdent::NF_LEV);
+        uint8_t wdTh = pConfig.getRegister(Configuration::RegIdent::WDTH);
+        writeReg(0x01, ((nfLev << 4) | wdTh));
+    }
+
+    if (hasField(Configuration::RegIdent::MIN_NUM_LIGH) || hasField(Configuration::RegIdent::SREJ))
+    {
+        uint8_t minNumLigh = pConfig.getRegister(Configuration::RegIdent::MIN_NUM_LIGH);
+        uint8_t sRej = pConfig.getRegister(Configuration::RegIdent::SREJ);
+        writeReg(0x02, ((((((static_cast<uint8_t>(1) << 1) | static_cast<uint8_t>(1)) << 2) | minNumLigh) << 4) | sRej));
+    }
+
+    if (hasField(Configuration::RegIdent::LCO_FDIV))
+    {
+        uint8_t lcoFDiv = pConfig.getRegister(Configuration::RegIdent::LCO_FDIV);
+        writeReg(0x03, ((lcoFDiv << 6) | (readReg(0x03) & 0b00100000)));
+    }
+
+    if (hasField(Configuration::RegIdent::TUN_CAP))
+    {
+        uint8_t tunCap = pConfig.getRegister(Configuration::RegIdent::TUN_CAP);
+        writeReg(0x08, (tunCap | (readReg(0x08) & 0b10000000)));
+    }
+}
+
+//
+
 /*!
  * \brief Write value to a register.
  *
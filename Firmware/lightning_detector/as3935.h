@@ -55,6 +55,8 @@ public:
     void disableInterrupt() const;                          ///< Detach Arduino interrupt for interrupt request pin.
     //
     void writeConfiguration(const Configuration& pConfig) const;    ///< Write configuration registers.
+    void updateConfiguration(const Configuration& pConfig, const Configuration& pPrevConfig) const;
+                                                                    ///< Rewrite only changed configuration registers.
     //
     void maskDisturbers() const;        ///< Enable interrupt masking for disturber signals.
     void unmaskDisturbers() const;      ///< Disable interrupt masking for disturber signals.
@@ -63,11 +65,18 @@ public:
     //
     void clearStatistics() const;       ///< Clear distance estimation statistics.
     //
+    void powerDown() const;             ///< Enter power-down mode.
+    void powerUp() const;               ///< Leave power-down mode.
+    //
     bool irqHigh() const;               ///< Check for interrupt request signal.
     //
     InterruptType processIRQ(uint32_t& pEnergy, uint8_t& pDistance) const;  ///< Update values from chip according to interrupt type.
+    //
+    uint8_t dumpRegister(uint8_t pAddr) const;  ///< Read value from a register for diagnostic purposes.
 
 private:
+    void writeConfigRegisters(const Configuration& pConfig, uint8_t pFields) const; ///< Write configuration registers containing some fields.
+    //
     void writeReg(uint8_t pAddr, uint8_t pVal) const;   ///< Write value to a register.
     uint8_t readReg(uint8_t pAddr) const;               ///< Read value from a register.
     //
@@ -88,7 +97,7 @@ private:
                                             0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
                                             0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
                                             0x30, 0x31, 0x32};                              ///< Addresses of all accessible registers.
-    static constexpr uint8_t writableRegisters[] = {0x00, 0x01, 0x02, 0x03, 0x08};          ///< Addresses of all writable registers.
+    static constexpr uint8_t writableRegisters[] = {0x00, 0x01, 0x02, 0x03, 0x08, 0x3D};    ///< Addresses of all writable registers.
 
 public:
     /*!
@@ -109,6 +118,7 @@ public:
     };
     //
     static constexpr uint8_t stormDistanceOutOfRange = 63;  ///< Storm distance value used to report "out of range" condition.
+    static constexpr uint8_t maxRegisterAddr = 0x32;        ///< Highest address of the accessible registers (see dumpRegister()).
 };
 
 #endif // AS3935_H
@@ -130,4 +130,33 @@ float calcBatteryPercentage(float pCurrentVoltage, float pHighVoltage, float pLo
     return 100. * (static_cast<float>(lowChargeIdx - currentChargeIdx) / static_cast<float>(lowChargeIdx - highChargeIdx));
 }
 
+//
+
+/*!
+ * \brief Calculate a CRC-32 checksum.
+ *
+ * Calculates the standard (IEEE 802.3, zlib) CRC-32 of some data. The calculation can be
+ * continued over several blocks of data by passing the previous return value as \p pCRC.
+ * Uses a bitwise calculation without look-up table to save flash (only short data is checked).
+ *
+ * \param pData Data to calculate the checksum of.
+ * \param pLength Length of \p pData in bytes.
+ * \param pCRC Checksum of the preceding data (0 for a new checksum).
+ * \return CRC-32 of all data including \p pData.
+ */
+uint32_t crc32(const uint8_t* pData, size_t pLength, uint32_t pCRC)
+{
+    uint32_t crc = ~pCRC;
+
+    for (size_t i = 0; i < pLength; ++i)
+    {
+        crc ^= pData[i];
+
+        for (uint8_t bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
 } // namespace Auxil
@@ -50,10 +50,22 @@ enum class RunMode : uint8_t
     TuneAntenna = 2         ///< Antenna tuning mode.
 };
 
+/*!
+ * \brief Keys of the persistently stored values.
+ *
+ * Defines the keys used for the FlashKVStore (keep existing values when adding keys).
+ */
+enum class StoreKey : uint16_t
+{
+    ConfigProfile = 1       ///< Stored configuration profile (raw configuration, see Configuration::getRawConfig()).
+};
+
 //
 
 float calcBatteryPercentage(float pCurrentVoltage, float pHighVoltage, float pLowVoltage,
                             float pLoadCurrentIdle, float pLoadCurrentMax, size_t pNumCoinCells);   ///< Estimate the battery percentage.
+//
+uint32_t crc32(const uint8_t* pData, size_t pLength, uint32_t pCRC = 0);    ///< Calculate a CRC-32 checksum.
 
 //
 
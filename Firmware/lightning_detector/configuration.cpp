@@ -23,69 +23,8 @@
 
 #include "configuration.h"
 
+constexpr uint8_t Configuration::numRegisters;
+constexpr uint32_t Configuration::rawConfMask;
 constexpr uint8_t Configuration::regOfsLenMap[][3];
-
-//
-
-/*!
- * \brief Constructor.
- *
- * Starts with all 24 configuration bits equal to 0.
- */
-Configuration::Configuration() :
-    conf()
-{
-    std::array<bool, 24> tConf;
-    tConf.fill(0);
-    load(std::move(tConf));
-}
-
-//Public
-
-/*!
- * \brief Load configuration from raw DIP switch positions.
- *
- * See also getRawConfig().
- *
- * \param pRawConf The 24 configuration bits from the 24 switch positions.
- */
-void Configuration::load(std::array<bool, 24> pRawConf)
-{
-    conf.swap(pRawConf);
-}
-
-//
-/*!
- * \brief Extract a register value from loaded raw configuration.
- *
- * \param pReg Desired register.
- * \return Value of the register.
- */
-uint8_t Configuration::getRegister(RegIdent pReg) const
-{
-    uint8_t retVal = 0;
-
-    uint8_t ofs = regOfsLenMap[static_cast<uint8_t>(pReg)][1];
-    uint8_t len = regOfsLenMap[static_cast<uint8_t>(pReg)][2];
-
-    for (uint16_t i = ofs; i < ofs+len; ++i)
-    {
-        retVal = (retVal << 1);
-        if (conf[i])
-            retVal |= static_cast<uint8_t>(1);
-    }
-
-    return retVal;
-}
-
-/*!
- * \brief Get loaded raw configuration bits.
- *
- * See also load().
- *
- * \return The 24 configuration bits for the 24 switch positions.
- */
-std::array<bool, 24> Configuration::getRawConfig() const
-{
-    return conf;
-}
+constexpr uint8_t Configuration::regMaxValues[];
+constexpr const char* Configuration::regNames[];
@@ -26,18 +26,20 @@
 
 #include <Arduino.h>
 
-#include <array>
-
 /*!
  * \brief Register configuration object for the AS3935 registers.
  *
  * Stores the configurable settings of the AS3935 sensor in the form of a series of register values.
  *
- * The raw configuration (see load() and getRawConfig()) has a length of 24 bits and must
- * have the following format (always starting with MSB, bit lengths in parentheses):
+ * The raw configuration (see load() and getRawConfig()) has a length of 24 bits, packed into the 24 least significant
+ * bits of a \p uint32_t (first DIP switch position in bit 23), and must have the following format
+ * (always starting with MSB, bit lengths in parentheses):
  *
  * {RegIdent::AFE_GB (5), RegIdent::NF_LEV (3), RegIdent::WDTH (4), RegIdent::SREJ (4),
  *  RegIdent::TUN_CAP (4), RegIdent::LCO_FDIV (2), RegIdent::MIN_NUM_LIGH (2)}
+ *
+ * All register access is \p constexpr, so that predefined configurations (see ConfigurationProfiles)
+ * can be built and validated (see isValid()) at compile time.
  */
 class Configuration
 {
@@ -45,15 +47,193 @@ public:
     enum class RegIdent : uint8_t;
 
 public:
-    Configuration();                            ///< Constructor.
+    /*!
+     * \brief Constructor.
+     *
+     * Starts with all 24 configuration bits equal to 0.
+     */
+    constexpr Configuration() :
+        conf(0)
+    {
+    }
+    /*!
+     * \brief Constructor.
+     *
+     * Uses a packed raw configuration (see load()).
+     *
+     * \param pRawConf The 24 configuration bits (higher bits are ignored).
+     */
+    explicit constexpr Configuration(uint32_t pRawConf) :
+        conf(pRawConf & rawConfMask)
+    {
+    }
+    /*!
+     * \brief Constructor.
+     *
+     * Uses explicit register values (bits exceeding a register's length are ignored, see fitsRegister()).
+     *
+     * \param pAfeGb Value for RegIdent::AFE_GB.
+     * \param pNfLev Value for RegIdent::NF_LEV.
+     * \param pWdth Value for RegIdent::WDTH.
+     * \param pSrej Value for RegIdent::SREJ.
+     * \param pTunCap Value for RegIdent::TUN_CAP.
+     * \param pLcoFdiv Value for RegIdent::LCO_FDIV.
+     * \param pMinNumLigh Value for RegIdent::MIN_NUM_LIGH.
+     */
+    constexpr Configuration(uint8_t pAfeGb, uint8_t pNfLev, uint8_t pWdth, uint8_t pSrej,
+                            uint8_t pTunCap, uint8_t pLcoFdiv, uint8_t pMinNumLigh) :
+        conf(Configuration().withRegister(RegIdent::AFE_GB, pAfeGb).withRegister(RegIdent::NF_LEV, pNfLev)
+                            .withRegister(RegIdent::WDTH, pWdth).withRegister(RegIdent::SREJ, pSrej)
+                            .withRegister(RegIdent::TUN_CAP, pTunCap).withRegister(RegIdent::LCO_FDIV, pLcoFdiv)
+                            .withRegister(RegIdent::MIN_NUM_LIGH, pMinNumLigh).getRawConfig())
+    {
+    }
     //
-    void load(std::array<bool, 24> pRawConf);   ///< Load configuration from raw DIP switch positions.
+    /*!
+     * \brief Load configuration from raw DIP switch positions.
+     *
+     * See also getRawConfig().
+     *
+     * \param pRawConf The 24 configuration bits from the 24 switch positions (higher bits are ignored).
+     */
+    void load(uint32_t pRawConf)
+    {
+        conf = pRawConf & rawConfMask;
+    }
     //
-    uint8_t getRegister(RegIdent pReg) const;   ///< Extract a register value from loaded raw configuration.
-    std::array<bool, 24> getRawConfig() const;  ///< Get loaded raw configuration bits.
+    /*!
+     * \brief Extract a register value from loaded raw configuration.
+     *
+     * \param pReg Desired register.
+     * \return Value of the register.
+     */
+    constexpr uint8_t getRegister(RegIdent pReg) const
+    {
+        return static_cast<uint8_t>((conf >> regShift(pReg)) & regMask(pReg));
+    }
+    /*!
+     * \brief Get a copy with a different register value.
+     *
+     * \param pReg Desired register.
+     * \param pValue New value of the register (bits exceeding the register's length are ignored, see fitsRegister()).
+     * \return Changed configuration.
+     */
+    constexpr Configuration withRegister(RegIdent pReg, uint8_t pValue) const
+    {
+        return Configuration((conf & ~(regMask(pReg) << regShift(pReg))) | ((pValue & regMask(pReg)) << regShift(pReg)));
+    }
+    /*!
+     * \brief Get loaded raw configuration bits.
+     *
+     * See also load().
+     *
+     * \return The 24 configuration bits for the 24 switch positions.
+     */
+    constexpr uint32_t getRawConfig() const
+    {
+        return conf;
+    }
+    //
+    /*!
+     * \brief Check if all register values are within their documented ranges.
+     *
+     * Register values are invalid if they are reserved according to the %AS3935 datasheet
+     * (see regMaxValues). Such values can still be set via the DIP switches, though.
+     *
+     * \return If no register has a reserved value.
+     */
+    constexpr bool isValid() const
+    {
+        for (const auto& reg : regOfsLenMap)
+            if (getRegister(static_cast<RegIdent>(reg[0])) > regMaxValues[reg[0]])
+                return false;
+
+        return true;
+    }
+    /*!
+     * \brief Check if a value fits into a register.
+     *
+     * \param pReg Desired register.
+     * \param pValue Register value.
+     * \return If \p pValue does not exceed the register's length and is not reserved (see isValid()).
+     */
+    static constexpr bool fitsRegister(RegIdent pReg, uint8_t pValue)
+    {
+        return (pValue <= regMask(pReg)) && (pValue <= regMaxValues[static_cast<uint8_t>(pReg)]);
+    }
+    /*!
+     * \brief Get the name of a register.
+     *
+     * \param pReg Desired register.
+     * \return Register name as in the %AS3935 datasheet (e.g. "AFE_GB").
+     */
+    static constexpr const char* getRegisterName(RegIdent pReg)
+    {
+        return regNames[static_cast<uint8_t>(pReg)];
+    }
+    //
+    /*!
+     * \brief Determine which registers differ from another configuration.
+     *
+     * \param pOther Configuration to compare with.
+     * \return Bit mask with bit number \p static_cast<uint8_t>(reg) set for each differing register \p reg.
+     */
+    constexpr uint8_t changedRegisters(const Configuration& pOther) const
+    {
+        uint8_t mask = 0;
+
+        for (const auto& reg : regOfsLenMap)
+            if (getRegister(static_cast<RegIdent>(reg[0])) != pOther.getRegister(static_cast<RegIdent>(reg[0])))
+                mask |= static_cast<uint8_t>(1u << reg[0]);
+
+        return mask;
+    }
+    //
+    /*!
+     * \brief Compare with another configuration.
+     *
+     * \param pOther Configuration to compare with.
+     * \return If all register values are equal.
+     */
+    constexpr bool operator==(const Configuration& pOther) const
+    {
+        return conf == pOther.conf;
+    }
+    /*!
+     * \brief Compare with another configuration.
+     *
+     * \param pOther Configuration to compare with.
+     * \return If any register value differs.
+     */
+    constexpr bool operator!=(const Configuration& pOther) const
+    {
+        return conf != pOther.conf;
+    }
+
+private:
+    /*!
+     * \brief Get the bit mask of a register's value.
+     *
+     * \param pReg Desired register.
+     * \return Mask with the register's length in bits.
+     */
+    static constexpr uint32_t regMask(RegIdent pReg)
+    {
+        return (static_cast<uint32_t>(1) << regOfsLenMap[static_cast<uint8_t>(pReg)][2]) - 1;
+    }
+    /*!
+     * \brief Get the position of a register's value within the packed raw configuration.
+     *
+     * \param pReg Desired register.
+     * \return Bit number of the register's LSB.
+     */
+    static constexpr uint8_t regShift(RegIdent pReg)
+    {
+        return static_cast<uint8_t>(24 - regOfsLenMap[static_cast<uint8_t>(pReg)][1] - regOfsLenMap[static_cast<uint8_t>(pReg)][2]);
+    }
 
 private:
-    std::array<bool, 24> conf;  ///< Raw DIP configuration bits (mapped to registers via 'regOfsLenMap').
+    uint32_t conf;  ///< Packed raw DIP configuration bits (mapped to registers via 'regOfsLenMap').
 
 public:
     /*!
@@ -69,8 +249,12 @@ public:
         LCO_FDIV = 5,     ///< Divsion ratio for antenna resonance on interrupt pin (tuning mode) [2 bits].
         MIN_NUM_LIGH = 6  ///< Minimum number of lightnings to trigger an interrupt [2 bits].
     };
+    //
+    static constexpr uint8_t numRegisters = 7;          ///< Number of configurable registers (see RegIdent).
 
 private:
+    static constexpr uint32_t rawConfMask = 0xFFFFFF;   ///< Mask for the 24 raw configuration bits.
+    //
     static constexpr uint8_t regOfsLenMap[][3] = {{static_cast<uint8_t>(RegIdent::AFE_GB), 0, 5},
                                                   {static_cast<uint8_t>(RegIdent::NF_LEV), 5, 3},
                                                   {static_cast<uint8_t>(RegIdent::WDTH), 8, 4},
@@ -80,7 +264,30 @@ private:
                                                   {static_cast<uint8_t>(RegIdent::MIN_NUM_LIGH), 22, 2}};   ///< \brief Maps the configurable
                                                                                                             ///  %AS3935 registers to their
                                                                                                             ///  lengths and their offsets
-                                                                                                            ///  within the 'conf' array.
+                                                                                                            ///  within the raw configuration.
+    static constexpr uint8_t regMaxValues[] = {0b11111, 0b111, 10, 11, 0b1111, 0b11, 0b11}; ///< \brief Maximum non-reserved values of the
+                                                                                            ///  configurable %AS3935 registers
+                                                                                            ///  (in RegIdent order).
+    static constexpr const char* regNames[] = {"AFE_GB", "NF_LEV", "WDTH", "SREJ",
+                                               "TUN_CAP", "LCO_FDIV", "MIN_NUM_LIGH"};      ///< \brief Names of the configurable
+                                                                                            ///  %AS3935 registers
+                                                                                            ///  (in RegIdent order).
 };
 
+/*!
+ * \brief Predefined AS3935 register configurations.
+ *
+ * The defaults correspond to the recommended DIP switch settings (see README).
+ */
+namespace ConfigurationProfiles
+{
+
+constexpr Configuration Indoor(0b10010, 0b010, 0b0010, 0b0010, 0b0000, 0b00, 0b00);     ///< Default configuration (indoor gain).
+constexpr Configuration Outdoor = Indoor.withRegister(Configuration::RegIdent::AFE_GB, 0b01110);
+                                                                                        ///< Default configuration with outdoor gain.
+
+static_assert(Indoor.isValid() && Outdoor.isValid(), "Default configurations contain reserved register values.");
+
+} // namespace ConfigurationProfiles
+
 #endif // CONFIGURATION_H
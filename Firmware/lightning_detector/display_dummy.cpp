@@ -64,6 +64,15 @@ void DISPLAY_TYPE::sleep() const
 {
 }
 
+/*!
+ * \copybrief AbstractDisplay::powerOff()
+ *
+ * \note Does nothing.
+ */
+void DISPLAY_TYPE::powerOff() const
+{
+}
+
 //
 
 /*!
@@ -95,6 +104,27 @@ void DISPLAY_TYPE::update(size_t pNumLightnings, float pLightningRate, uint8_t p
 {
 }
 
+//
+
+/*!
+ * \copybrief AbstractDisplay::service()
+ *
+ * \note Does nothing.
+ */
+void DISPLAY_TYPE::service()
+{
+}
+
+/*!
+ * \copybrief AbstractDisplay::refreshing()
+ *
+ * \return Always false.
+ */
+bool DISPLAY_TYPE::refreshing() const
+{
+    return false;
+}
+
 //Private
 
 /*!
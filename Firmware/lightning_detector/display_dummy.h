@@ -47,11 +47,15 @@ public:
     //
     void init() const override final;   ///< \copybrief AbstractDisplay::init()
     void sleep() const override final;  ///< \copybrief AbstractDisplay::sleep()
+    void powerOff() const override final;   ///< \copybrief AbstractDisplay::powerOff()
     //
     void clear() override final;        ///< \copybrief AbstractDisplay::clear()
     void update(size_t pNumLightnings, float pLightningRate, uint8_t pStormDist, float pBatteryPercentage, float pBatteryVoltage,
                 float pRunTimeHours, Auxil::RunMode pMode, bool pSerialEnabled, AS3935::InterruptType pLastInterrupt) override final;
                                         ///< \copybrief AbstractDisplay::update()
+    //
+    void service() override final;          ///< \copybrief AbstractDisplay::service()
+    bool refreshing() const override final; ///< \copybrief AbstractDisplay::refreshing()
 
 private:
     void setPixel(size_t pX, size_t pY, uint8_t pR, uint8_t pG, uint8_t pB) override final;     ///< \copybrief AbstractDisplay::setPixel()
@@ -23,17 +23,26 @@
 
 #include "display_waveshareepaper154bw_sx1509ioexpander.h"
 
+#include "fixedstring.h"
 #include "fonts.h"
 #include "spiconfig.h"
+#include "statusscreenbackground.h"
 
 #include <SPI.h>
 #include <Wire.h>
 
+#include <nrf_soc.h>
+
+#include <algorithm>
+
+volatile bool DISPLAY_TYPE::irqDisplayIdle = false;
+
 /*!
  * \brief Constructor.
  *
  * Configures the Graphics instance to work with this display driver instance and
  * sets background and stroke colors to obtain black strokes on a white background.
+ * The same colors are set for the band framebuffer used for rendering (see renderBand()).
  * See also setPixel().
  *
  * \param pSX1509Addr I2C address of the SX1509 IO expander chip.
@@ -41,13 +50,17 @@
  * \param pPinNumDspDC SX1509 pin number to connect display's \p DC pin to.
  * \param pPinNumDspRST SX1509 pin number to connect display's \p RST pin to.
  * \param pPinNumDspBUSY SX1509 pin number to connect display's \p BUSY pin to.
+ * \param pPinSX1509INT MCU pin connected to SX1509's \p NINT pin (use Pins::NotConnected if not connected).
+ * \param pFullRefreshInterval Number of consecutive partial refreshes after which a full refresh is forced (0 disables partial refresh).
  */
-DISPLAY_TYPE::DISPLAY_TYPE(uint8_t pSX1509Addr, uint8_t pPinNumDspCS, uint8_t pPinNumDspDC, uint8_t pPinNumDspRST, uint8_t pPinNumDspBUSY) :
+DISPLAY_TYPE::DISPLAY_TYPE(uint8_t pSX1509Addr, uint8_t pPinNumDspCS, uint8_t pPinNumDspDC, uint8_t pPinNumDspRST, uint8_t pPinNumDspBUSY,
+                           Pin pPinSX1509INT, uint8_t pFullRefreshInterval) :
     AbstractSPIDisplay(200, 200, SPISettings(SPIConfig::getSPISpeed(), MSBFIRST, SPI_MODE0), pSX1509Addr),
     pinNumDspCS(pPinNumDspCS),
     pinNumDspDC(pPinNumDspDC),
     pinNumDspRST(pPinNumDspRST),
     pinNumDspBUSY(pPinNumDspBUSY),
+    pinSX1509INT(pPinSX1509INT),
     bankAMaskDspCS(sx1509PinToBankAMask(pinNumDspCS)),
     bankBMaskDspCS(sx1509PinToBankBMask(pinNumDspCS)),
     bankAMaskDspDC(sx1509PinToBankAMask(pinNumDspDC)),
@@ -55,13 +68,37 @@ DISPLAY_TYPE::DISPLAY_TYPE(uint8_t pSX1509Addr, uint8_t pPinNumDspCS, uint8_t pP
     bankAMaskDspRST(sx1509PinToBankAMask(pinNumDspRST)),
     bankBMaskDspRST(sx1509PinToBankBMask(pinNumDspRST)),
     bankAMaskDspBUSY(sx1509PinToBankAMask(pinNumDspBUSY)),
-    bankBMaskDspBUSY(sx1509PinToBankBMask(pinNumDspBUSY))
+    bankBMaskDspBUSY(sx1509PinToBankBMask(pinNumDspBUSY)),
+    dataShadowB(0b11111111),
+    dataShadowA(0b11111111),
+    fullRefreshInterval(pFullRefreshInterval),
+    fieldTexts{},
+    shownFieldTexts{},
+    frameBlank(true),
+    shownBlank(true),
+    shownValid(false),
+    partialRefreshCount(0),
+    controllerRAMValid(false),
+    panelState(PanelState::Off),
+    refreshState(RefreshState::Idle),
+    framePending(false),
+    framePendingFullRefresh(false),
+    refreshPartial(false),
+    refreshRegions{},
+    settings{{0x01, false, 0, {}}, {0x11, false, 0, {}}, {0x1A, false, 0, {}},
+             {0x3C, false, 0, {}}, {0x44, false, 0, {}}, {0x45, false, 0, {}}},
+    busyMillis{0, 0, 0, 0, 0, 0},
+    busyWaitsUntilCalibration{0, 0, 0, 0, 0, 0}
 {
     graphics.setDisplay(this);
 
     graphics.begin();
     graphics.background(1, 1, 1);
     graphics.stroke(0, 0, 0);
+
+    bandFramebuffer.background(1, 1, 1);
+    bandFramebuffer.stroke(0, 0, 0);
+    bandFramebuffer.noFill();
 }
 
 //Public
@@ -75,6 +112,7 @@ DISPLAY_TYPE::DISPLAY_TYPE(uint8_t pSX1509Addr, uint8_t pPinNumDspCS, uint8_t pP
  * - \p CS, \p DC and \p RST as outputs; inputs otherwise
  * - Set high level for active-low \p CS and \p RST
  * - Enable pull-down and disable input buffer for every unused pin
+ * - If \p NINT is connected: Enable interrupt for falling edge of \p BUSY (display controller becomes idle)
  *
  * Finally issues an initial display hardware reset.
  */
@@ -94,8 +132,7 @@ void DISPLAY_TYPE::setup() const
     writeRegSX1509(SX1509RegisterAddress::RegDirA, ~(bankAMaskDspCS | bankAMaskDspDC | bankAMaskDspRST));
 
     //Start with high output for active-low CS and RST
-    writeRegSX1509(SX1509RegisterAddress::RegDataB, (bankBMaskDspCS | bankBMaskDspRST));
-    writeRegSX1509(SX1509RegisterAddress::RegDataA, (bankAMaskDspCS | bankAMaskDspRST));
+    writeDataSX1509((bankBMaskDspCS | bankBMaskDspRST), (bankAMaskDspCS | bankAMaskDspRST));
 
     //Use pull-down on every unused pin
     writeRegSX1509(SX1509RegisterAddress::RegPullUpB, 0b0);
@@ -107,6 +144,27 @@ void DISPLAY_TYPE::setup() const
     writeRegSX1509(SX1509RegisterAddress::RegInputDisableB, ~(bankBMaskDspCS | bankBMaskDspDC | bankBMaskDspRST | bankBMaskDspBUSY));
     writeRegSX1509(SX1509RegisterAddress::RegInputDisableA, ~(bankBMaskDspCS | bankBMaskDspDC | bankBMaskDspRST | bankBMaskDspBUSY));
 
+    //Use interrupt for falling edge of BUSY if NINT is connected
+
+    if (pinSX1509INT != Pins::NotConnected)
+    {
+        pinMode(pinSX1509INT, INPUT_PULLUP);    //NINT is open-drain
+
+        const uint8_t bankPinIdx = pinNumDspBUSY % 8;
+        const uint8_t senseFalling = 0b10 << (2*(bankPinIdx % 4));
+
+        if (pinNumDspBUSY >= 8)
+            writeRegSX1509((bankPinIdx >= 4) ? SX1509RegisterAddress::RegSenseHighB : SX1509RegisterAddress::RegSenseLowB, senseFalling);
+        else
+            writeRegSX1509((bankPinIdx >= 4) ? SX1509RegisterAddress::RegSenseHighA : SX1509RegisterAddress::RegSenseLowA, senseFalling);
+
+        writeRegSX1509(SX1509RegisterAddress::RegInterruptMaskB, ~bankBMaskDspBUSY);
+        writeRegSX1509(SX1509RegisterAddress::RegInterruptMaskA, ~bankAMaskDspBUSY);
+
+        //Attach only once (attaching allocates on the mbed core); waits just clear the interrupt source and the flag
+        attachInterrupt(digitalPinToInterrupt(pinSX1509INT), &DISPLAY_TYPE::isrDisplayIdle, FALLING);
+    }
+
     //Make sure again that CS is high
     deselectChip();
 
@@ -119,41 +177,73 @@ void DISPLAY_TYPE::setup() const
 /*!
  * \copybrief AbstractSPIDisplay::init()
  *
- * Display hardware reset plus following init sequence:
- * - \p 0x12
+ * If the display is in deep sleep mode (see sleep()), it is only woken up via wakeDisplay() ("warm start",
+ * retaining RAM content). If the display is turned off, does a display hardware reset plus software reset
+ * (\p 0x12) instead. Does neither if the display is already initialized.
+ *
+ * Then applies the following settings (see writeSetting()):
  * - \p 0x01, \p 0XC7, \p 0x00, \p 0x00
  * - \p 0x11, \p 0x03
- * - \p 0x44, \p 0x00, \p 0x18
- * - \p 0x45, \p 0x00, \p 0x00, \p 0xC7, \p 0x00
+ *
+ * The RAM window (\p 0x44, \p 0x45) is set on demand by startRefresh().
  */
 void DISPLAY_TYPE::init() const
 {
-    hwResetDisplay();
+    if (panelState == PanelState::DeepSleep)
+        wakeDisplay();
+    else if (panelState == PanelState::Off)
+    {
+        hwResetDisplay();
 
-    writeCommand(0x12);
+        writeCommand(0x12);
+        invalidateSettings();
 
-    waitDisplayIdle();
+        waitDisplayIdle(BusyPhase::ColdReset);
+    }
 
-    writeCommand(0x01, 0XC7, 0x00, 0x00);
+    panelState = PanelState::Active;
 
-    writeCommand(0x11, 0x03);   //Incrementing X, incrementing Y, auto update address along x-axis
+    writeSetting(0x01, {0xC7, 0x00, 0x00});
 
-    writeCommand(0x44, 0x00, 0x18);
-    writeCommand(0x45, 0x00, 0x00, 0xC7, 0x00);
+    writeSetting(0x11, {0x03});     //Incrementing X, incrementing Y, auto update address along x-axis
 }
 
 /*!
  * \copybrief AbstractSPIDisplay::sleep()
  *
- * Sends sleep command and then fully turns off display power via turnOffDisplay().
+ * Sends the command for deep sleep mode 1, which retains the display controller's RAM content.
+ * Display power stays on until powerOff() is called.
+ *
+ * Note: This is done automatically after an asynchronous refresh has finished (see service()).
  */
 void DISPLAY_TYPE::sleep() const
 {
-    waitDisplayIdle();
+    if (panelState != PanelState::Active)
+        return;
+
+    waitDisplayIdle(BusyPhase::Other);
 
     writeCommand(0x10, 0x01);
 
+    panelState = PanelState::DeepSleep;
+}
+
+/*!
+ * \copybrief AbstractSPIDisplay::powerOff()
+ *
+ * Fully turns off display power via turnOffDisplay(), which loses the display controller's RAM content.
+ *
+ * Note: Should not be called while refreshing() returns true.
+ */
+void DISPLAY_TYPE::powerOff() const
+{
+    if (panelState == PanelState::Off)
+        return;
+
     turnOffDisplay();
+
+    panelState = PanelState::Off;
+    controllerRAMValid = false;
 }
 
 //
@@ -161,14 +251,15 @@ void DISPLAY_TYPE::sleep() const
 /*!
  * \copybrief AbstractSPIDisplay::clear()
  *
- * Resets the buffer to all white and calls updateDisplay().
+ * Switches to a blank (all white) image and does a full display refresh.
+ * Unlike update() this waits for the refresh to finish (see completeRefresh()).
  */
 void DISPLAY_TYPE::clear()
 {
-    for (size_t i = 0; i < 5000; ++i)
-        displayBuffer[i] = 0b11111111;
+    frameBlank = true;
 
-    updateDisplay();
+    queueRefresh(true);
+    completeRefresh();
 }
 
 //
@@ -177,7 +268,10 @@ void DISPLAY_TYPE::clear()
  * \copybrief AbstractSPIDisplay::update()
  *
  * Shows all of the passed information on the display.
- * The buffer is written and then updateDisplay() is called to write the buffer out.
+ * The information is formatted into the status screen's text fields (see setField()) and then an asynchronous
+ * display refresh is requested via queueRefresh() (using partial refresh if possible, see startRefresh()).
+ * Only fields whose text changed are rendered and transferred again. Call service() to finish the refresh.
+ * If a refresh is already in progress, the new frame is shown after that one has finished.
  *
  * The displayed information is formatted in the following way (~ from top-left to bottom-right):
  * - \p pNumLightnings
@@ -208,173 +302,138 @@ void DISPLAY_TYPE::clear()
 void DISPLAY_TYPE::update(size_t pNumLightnings, float pLightningRate, uint8_t pStormDist, float pBatteryPercentage, float pBatteryVoltage,
                           float pRunTimeHours, Auxil::RunMode pMode, bool pSerialEnabled, AS3935::InterruptType pLastInterrupt)
 {
-    //Prepare formatted strings
+    //Prepare formatted strings (strings that do not fit into their field are replaced by "NaN")
+    //Note: the field font only contains the characters of StatusScreenLayout::fieldCharacters (others are shown as space)
 
-    auto rightAlignString = [](String& pStr, size_t pLength) -> void
-    {
-        if (pLength < pStr.length())
-            return;
+    FixedString<statusFields[static_cast<size_t>(StatusField::NumLightnings)].numChars> numLghtStr;
+    numLghtStr.appendUInt(static_cast<uint32_t>(pNumLightnings));
+    if (numLghtStr.overflowed())
+        numLghtStr.assign("NaN");
 
-        size_t diff = pLength - pStr.length();
-
-        for (size_t i = 0; i < diff; ++i)
-            pStr = String(" ") + pStr;
-    };
-
-    size_t numLghtStrMaxLen = 10;
-    String numLghtStr(pNumLightnings);
-    if (numLghtStr.length() > numLghtStrMaxLen)
-        numLghtStr = "NaN";
-
-    size_t rateStrMaxLen = 5;
-    size_t rateStrDecPlaces = 0;
+    FixedString<statusFields[static_cast<size_t>(StatusField::LightningRate)].numChars> rateStr;
+    uint8_t rateStrDecPlaces = 0;
     if (static_cast<size_t>(pLightningRate) < 10)
         rateStrDecPlaces = 1;
-    String rateStr(pLightningRate, rateStrDecPlaces);
-    rateStr += "/m";
-    if (rateStr.length() > rateStrMaxLen)
-        rateStr = "NaN";
-    rightAlignString(rateStr, rateStrMaxLen);
+    rateStr.appendFixed(pLightningRate, rateStrDecPlaces);
+    rateStr.append("/m");
+    if (rateStr.overflowed())
+        rateStr.assign("NaN");
 
-    size_t voltageStrMaxLen = 7;
-    String voltageStr(pBatteryVoltage, 3);
-    voltageStr += " V";
-    if (voltageStr.length() > voltageStrMaxLen)
-        voltageStr = "NaN";
+    FixedString<statusFields[static_cast<size_t>(StatusField::BatteryVoltage)].numChars> voltageStr;
+    voltageStr.appendFixed(pBatteryVoltage, 3);
+    voltageStr.append(" V");
+    if (voltageStr.overflowed())
+        voltageStr.assign("NaN");
 
-    size_t distStrMaxLen = 8;
-    String distStr;
+    FixedString<statusFields[static_cast<size_t>(StatusField::StormDistance)].numChars> distStr;
 
     if (pStormDist == AS3935::stormDistanceOutOfRange)
-        distStr = "???";
+        distStr.append("???");
     else
-        distStr = String(pStormDist);
+        distStr.appendUInt(pStormDist);
 
-    distStr += " km";
-    if (distStr.length() > distStrMaxLen)
-        distStr = "NaN";
-    rightAlignString(distStr, distStrMaxLen);
+    distStr.append(" km");
+    if (distStr.overflowed())
+        distStr.assign("NaN");
 
-    size_t batFracStrMaxLen = 7;
-    String batFracStr(static_cast<size_t>(pBatteryPercentage));
-    batFracStr += " %";
-    if (batFracStr.length() > batFracStrMaxLen)
-        batFracStr = "NaN";
+    FixedString<statusFields[static_cast<size_t>(StatusField::BatteryPercentage)].numChars> batFracStr;
+    batFracStr.appendUInt(static_cast<uint32_t>(pBatteryPercentage));
+    batFracStr.append(" %");
+    if (batFracStr.overflowed())
+        batFracStr.assign("NaN");
 
-    size_t statusStrMaxLen = 7;
-    String statusStr;
+    FixedString<statusFields[static_cast<size_t>(StatusField::Status)].numChars> statusStr;
 
     if (pMode == Auxil::RunMode::Normal)
-        statusStr += " ";
+        statusStr.append(' ');
     else if (pMode == Auxil::RunMode::UnmaskDisturbers)
-        statusStr += "D";
+        statusStr.append('D');
     else if (pMode == Auxil::RunMode::TuneAntenna)
-        statusStr += "T";
+        statusStr.append('T');
     else
-        statusStr += "?";
+        statusStr.append('?');
 
     if (pSerialEnabled)
-        statusStr += "S";
+        statusStr.append('S');
     else
-        statusStr += " ";
+        statusStr.append(' ');
 
-    statusStr += " ";
+    statusStr.append(' ');
 
     if (pLastInterrupt == AS3935::InterruptType::DistanceChanged)
-        statusStr += "dDst";
+        statusStr.append("dDst");
     else if (pLastInterrupt == AS3935::InterruptType::Noise)
-        statusStr += "NOIS";
+        statusStr.append("NOIS");
     else if (pLastInterrupt == AS3935::InterruptType::Disturber)
-        statusStr += "Dist";
+        statusStr.append("Dist");
     else if (pLastInterrupt == AS3935::InterruptType::Lightning)
-        statusStr += "";
+        statusStr.append("");
     else if (pLastInterrupt == AS3935::InterruptType::Invalid)
-        statusStr += "INV";
+        statusStr.append("INV");
     else
-        statusStr += "?";
+        statusStr.append('?');
 
-    if (statusStr.length() > statusStrMaxLen)
-        statusStr = "ERROR";
+    if (statusStr.overflowed())
+        statusStr.assign("ERROR");
 
     size_t pRunTimeFullDays = static_cast<size_t>(pRunTimeHours) / 24;
     float pRunTimeRemainderHours = pRunTimeHours - pRunTimeFullDays*24;
 
-    size_t runtimeStrMaxLen = 8;
-    String runtimeStr = String(pRunTimeFullDays) + "d ";
+    FixedString<statusFields[static_cast<size_t>(StatusField::RunTime)].numChars> runtimeStr;
 
     if (pRunTimeFullDays == 0)
-        runtimeStr = String(pRunTimeRemainderHours, 1) + " h";
+    {
+        runtimeStr.appendFixed(pRunTimeRemainderHours, 1);
+        runtimeStr.append(" h");
+    }
     else
-        runtimeStr += String(static_cast<size_t>(pRunTimeRemainderHours)) + "h";
-
-    if (runtimeStr.length() > runtimeStrMaxLen)
-        runtimeStr = "NaN";
-    rightAlignString(runtimeStr, runtimeStrMaxLen);
-
-    //Clear buffer
-    for (size_t i = 0; i < 5000; ++i)
-        displayBuffer[i] = 0b11111111;
-
-    //Draw Frame
-    const size_t frameMargin = 1;
-    graphics.rect(frameMargin, frameMargin, graphics.width() - 2*frameMargin, graphics.height() - 2*frameMargin);
-
-    //Write header/caption text
-
-    graphics.textFont(&Font_TerminASCII24Bold);
-
-    const size_t textHeight = graphics.textFontHeight();
-    const size_t textWidth = graphics.textFontWidth();
-
-    const size_t textOfsX = 4;
-    const size_t textOfsY = 4;
-    const size_t textPadding = 3;
-    const size_t captionTextExtraPadding = 3;
-
-    size_t yPos = textOfsY+captionTextExtraPadding;
+    {
+        runtimeStr.appendUInt(static_cast<uint32_t>(pRunTimeFullDays));
+        runtimeStr.append("d ");
+        runtimeStr.appendUInt(static_cast<uint32_t>(pRunTimeRemainderHours));
+        runtimeStr.append('h');
+    }
 
-    graphics.text(" Lightning Det. ", textOfsX, yPos);
+    if (runtimeStr.overflowed())
+        runtimeStr.assign("NaN");
 
-    //Write text containing the interesting information
+    //Set fields (only changed fields are rendered again, see startRefresh())
 
-    graphics.textFont(&Font_TerminASCII24);
+    setField(StatusField::NumLightnings, numLghtStr.c_str());
+    setField(StatusField::LightningRate, rateStr.c_str());
+    setField(StatusField::BatteryVoltage, voltageStr.c_str());
+    setField(StatusField::StormDistance, distStr.c_str());
+    setField(StatusField::BatteryPercentage, batFracStr.c_str());
+    setField(StatusField::Status, statusStr.c_str());
+    setField(StatusField::RunTime, runtimeStr.c_str());
 
-    yPos += textHeight+captionTextExtraPadding+textPadding;
-    graphics.text("Lightnings  Rate", textOfsX, yPos);
-    yPos += textHeight+textPadding;
-    graphics.text(numLghtStr, textOfsX, yPos);
-    graphics.text(rateStr, textOfsX + 11*textWidth, yPos);
-    yPos += textHeight+textPadding;
-    graphics.text("Battery Distance", textOfsX, yPos);
-    yPos += textHeight+textPadding;
-    graphics.text(voltageStr, textOfsX, yPos);
-    graphics.text(distStr, textOfsX + 8*textWidth, yPos);
-    yPos += textHeight+textPadding;
-    graphics.text(batFracStr, textOfsX, yPos);
-    graphics.text("Run Time", textOfsX + 8*textWidth, yPos);
-    yPos += textHeight+textPadding;
-    graphics.text(statusStr, textOfsX, yPos);
-    graphics.text(runtimeStr, textOfsX + 8*textWidth, yPos);
+    frameBlank = false;
 
-    //Add decoration lines
+    queueRefresh(false);
+}
 
-    const size_t yPos0 = textOfsY+captionTextExtraPadding+textHeight+captionTextExtraPadding+1;
-    yPos = yPos0;
+//
 
-    graphics.line(frameMargin, yPos, graphics.width()-1-frameMargin, yPos);
-    yPos += textHeight+textPadding;
-    yPos += textHeight+textPadding;
-    graphics.line(frameMargin, yPos, graphics.width()-1-frameMargin, yPos);
-    graphics.line(textOfsX + static_cast<size_t>(10.5*textWidth), yPos0, textOfsX + static_cast<size_t>(10.5*textWidth), yPos);
-    graphics.line(textOfsX + static_cast<size_t>(7.5*textWidth), yPos, textOfsX + static_cast<size_t>(7.5*textWidth),
-                  graphics.height()-1-frameMargin);
-    yPos += textHeight+textPadding;
-    yPos += textHeight+textPadding;
-    graphics.line(textOfsX + static_cast<size_t>(7.5*textWidth), yPos, graphics.width()-1-frameMargin, yPos);
-    yPos += textHeight+textPadding;
-    graphics.line(frameMargin, yPos, textOfsX + static_cast<size_t>(7.5*textWidth), yPos);
+/*!
+ * \copybrief AbstractSPIDisplay::service()
+ *
+ * Checks if the display controller has finished a refresh in progress and if so calls finishRefresh(),
+ * which also starts the next requested refresh, if any, or otherwise sends the display to sleep.
+ */
+void DISPLAY_TYPE::service()
+{
+    if ((refreshState == RefreshState::Refreshing) && !displayBusy())
+        finishRefresh();
+}
 
-    updateDisplay();
+/*!
+ * \copybrief AbstractSPIDisplay::refreshing()
+ *
+ * \return True if a display refresh is in progress or pending.
+ */
+bool DISPLAY_TYPE::refreshing() const
+{
+    return (refreshState != RefreshState::Idle) || framePending;
 }
 
 //Private
@@ -385,6 +444,9 @@ void DISPLAY_TYPE::update(size_t pNumLightnings, float pLightningRate, uint8_t p
  * Sets the pixel value for pixel (\p pX, \p pY), ignoring the specified color value (monochrome display).
  * If any of \p pR, \p pG or \p pB are larger than zero the pixel value is set to 1 and it is set to zero otherwise.
  *
+ * The generic Graphics instance is not used for rendering by this driver (see renderBand()). For completeness,
+ * its pixels are written to the band framebuffer (see MonoFramebuffer::setPixel()).
+ *
  * \param pX Display's x-coordinate.
  * \param pY Display's y-coordinate.
  * \param pR Red pixel value from 0 to 255.
@@ -393,51 +455,332 @@ void DISPLAY_TYPE::update(size_t pNumLightnings, float pLightningRate, uint8_t p
  */
 void DISPLAY_TYPE::setPixel(size_t pX, size_t pY, uint8_t pR, uint8_t pG, uint8_t pB)
 {
-    size_t pixIdx = graphics.width()*pY + pX;
+    bool set = ((pR > 0) || (pG > 0) || (pB > 0));
+
+    bandFramebuffer.setPixel(pX, pY, set);
+}
+
+//
+
+/*!
+ * \brief Set the text of a status screen field for the next frame.
+ *
+ * The text is truncated to the field width (see StatusFieldLayout::numChars).
+ *
+ * \param pField Field to set.
+ * \param pText New field text.
+ */
+void DISPLAY_TYPE::setField(StatusField pField, const char* pText)
+{
+    const size_t fieldIdx = static_cast<size_t>(pField);
 
-    size_t byteIdx = pixIdx / 8;
-    size_t bitIdx = pixIdx % 8;
+    std::array<char, statusFieldMaxChars+1>& text = fieldTexts[fieldIdx];
 
-    uint8_t byteMask = 0b10000000 >> bitIdx;
+    text.fill('\0');
+    strncpy(text.data(), pText, statusFields[fieldIdx].numChars);
+}
 
-    bool set = ((pR > 0) || (pG > 0) || (pB > 0));
+//
 
-    if (set)
-        displayBuffer[byteIdx] |= byteMask;
-    else
-        displayBuffer[byteIdx] &= ~byteMask;
+/*!
+ * \brief Render a region of one band of an image into a band framebuffer.
+ *
+ * Clears \p pFramebuffer to white if \p pBlank. Otherwise copies the band from the prerendered static parts of the
+ * status screen (see StatusScreenBackground) and draws those text fields that intersect \p pRegion (with alignment according
+ * to \p statusFields), clipping everything outside of display rows \p pBand * \p bandRows to
+ * (\p pBand + 1) * \p bandRows - 1. Only the content of \p pRegion is valid afterwards.
+ *
+ * \param pFieldTexts Texts of the status screen fields.
+ * \param pBlank Render a blank (all white) image instead of the status screen.
+ * \param pFramebuffer Band framebuffer.
+ * \param pBand Index of the band (0 to \p numBands - 1).
+ * \param pRegion Region of the band that needs to be rendered.
+ */
+void DISPLAY_TYPE::renderBand(const FieldTexts& pFieldTexts, bool pBlank, BandFramebuffer& pFramebuffer, uint8_t pBand,
+                              const BandRegion& pRegion)
+{
+    pFramebuffer.setOriginY(pBand*bandRows);
+
+    if (pBlank)
+    {
+        pFramebuffer.clear();
+        return;
+    }
+
+    pFramebuffer.load(&StatusScreenBackground[pBand*BandFramebuffer::bufferSize]);
+
+    const int16_t regionX1 = 8*pRegion.xByte1;
+    const int16_t regionX2 = 8*pRegion.xByte2 + 7;
+    const int16_t regionY1 = pBand*bandRows + pRegion.y1;
+    const int16_t regionY2 = pBand*bandRows + pRegion.y2;
+
+    for (size_t i = 0; i < numStatusFields; ++i)
+    {
+        const StatusFieldLayout& field = statusFields[i];
+
+        const int16_t charWidth = field.font->width;
+        const int16_t fieldX2 = field.x + field.numChars*charWidth - 1;
+        const int16_t fieldY2 = field.y + static_cast<int16_t>(field.font->height) - 1;
+
+        if ((field.x > regionX2) || (fieldX2 < regionX1) || (field.y > regionY2) || (fieldY2 < regionY1))
+            continue;
+
+        const char* text = pFieldTexts[i].data();
+
+        int16_t xPos = field.x;
+
+        if (field.alignment == FieldAlignment::Right)
+            xPos += (field.numChars - static_cast<int16_t>(strlen(text))) * charWidth;
+
+        pFramebuffer.textFont(field.font);
+        pFramebuffer.text(text, xPos, field.y);
+    }
 }
 
 //
 
 /*!
- * \brief Update the display according to the current buffer content.
+ * \brief Request an asynchronous display refresh for the current field texts.
+ *
+ * Starts the refresh via startRefresh() if no refresh is in progress. Otherwise the
+ * refresh is started as soon as the current one has finished (see finishRefresh()),
+ * then using the field texts at that time (i.e. the newest frame wins).
  *
- * Does a full display update sequence using the current state of the bitmap buffer.
+ * \param pForceFullRefresh Always do a full update (see startRefresh()).
  */
-void DISPLAY_TYPE::updateDisplay() const
+void DISPLAY_TYPE::queueRefresh(bool pForceFullRefresh)
 {
-    waitDisplayIdle();
+    framePending = true;
+    framePendingFullRefresh = framePendingFullRefresh || pForceFullRefresh;
+
+    if (refreshState == RefreshState::Idle)
+        startRefresh();
+}
+
+/*!
+ * \brief Start a display refresh according to the current field texts.
+ *
+ * Compares the field texts with the currently shown ones and marks the regions of all changed fields as dirty
+ * (see markDirty()). The whole screen is dirty if the shown image is unknown or if switching between blank image
+ * and status screen. Returns immediately if nothing changed. Otherwise initializes the display (see init()) and
+ * starts either a full or a partial display update, without waiting for the actual refresh to finish (see service(),
+ * finishRefresh()). The field texts may be overwritten with the next frame afterwards.
+ *
+ * A full update (mode 1 waveform, whole panel flashes) is done if a full update was requested,
+ * if the shown image is unknown or if there were already \p fullRefreshInterval partial updates
+ * since the last full update (to remove accumulated ghosting). Otherwise a partial update (mode 2
+ * waveform, only changed pixels are driven) is done: The dirty region of each band is rendered (see renderBand())
+ * and written to the "new image" RAM bank (\p 0x24) using a matching RAM window, while the "old image" RAM bank
+ * (\p 0x26) already holds the shown image. If the controller RAM content was lost in the meantime (power-off/reset,
+ * see hwResetDisplay()), the full shown image and the full new image are written to \p 0x26 and \p 0x24 instead.
+ */
+void DISPLAY_TYPE::startRefresh()
+{
+    framePending = false;
+
+    bool partialRefresh = !framePendingFullRefresh && shownValid && partialRefreshCount < fullRefreshInterval;
+
+    framePendingFullRefresh = false;
+
+    //Find regions that need to be written
+
+    for (BandRegion& region : refreshRegions)
+        region.dirty = false;
+
+    if (!shownValid || (frameBlank != shownBlank))
+        markDirty(0, 0, 199, 199);
+    else if (!frameBlank)
+    {
+        for (size_t i = 0; i < numStatusFields; ++i)
+        {
+            if (strcmp(fieldTexts[i].data(), shownFieldTexts[i].data()) == 0)
+                continue;
+
+            const StatusFieldLayout& field = statusFields[i];
+
+            markDirty(field.x, field.y, field.x + field.numChars*field.font->width - 1, field.y + field.font->height - 1);
+        }
+    }
+
+    bool dirty = false;
+
+    for (const BandRegion& region : refreshRegions)
+        dirty = dirty || region.dirty;
+
+    if (!dirty)
+        return;
+
+    init();
+
+    bool fullRAMWrite = partialRefresh && !controllerRAMValid;
+
+    waitDisplayIdle(BusyPhase::Other);
 
     uint16_t tval12bit = 0x140;  //TODO: This is ~20 degrees; how to use internal sensor???
-    writeCommand(0x1A, (tval12bit >> 4), ((tval12bit & 0b000000001111) << 4));
+    writeSetting(0x1A, {static_cast<uint8_t>(tval12bit >> 4), static_cast<uint8_t>((tval12bit & 0b000000001111) << 4)});
 
-    writeCommand(0x22, 0xB1);
+    writeCommand(0x22, partialRefresh ? 0xB9 : 0xB1);   //Load temperature and waveform for display mode 2 or 1
 
     writeCommand(0x20);
 
-    waitDisplayIdle();
+    waitDisplayIdle(BusyPhase::LoadWaveform);
 
-    writeCommand(0x4E, 0x00);
-    writeCommand(0x4F, 0X00, 0x00);
+    writeSetting(0x3C, {static_cast<uint8_t>(partialRefresh ? 0x80 : 0xC0)});   //Border waveform: keep VCOM level for partial update (no border flashing)
 
-    writeCommandRaw(0x24, &displayBuffer[0], 5000);
+    //Render the dirty regions band by band and stream them to controller RAM
 
-    writeCommand(0x22, 0xC7);
+    for (uint8_t band = 0; band < numBands; ++band)
+    {
+        BandRegion& region = refreshRegions[band];
+
+        if (!partialRefresh || fullRAMWrite)
+            region = {true, 0, 24, 0, bandRows-1};
+
+        if (!region.dirty)
+            continue;
+
+        if (fullRAMWrite)
+        {
+            renderBand(shownFieldTexts, shownBlank, bandFramebuffer, band, region);
+            writeRAMWindow(0x26, bandFramebuffer, band, region);
+        }
+
+        renderBand(fieldTexts, frameBlank, bandFramebuffer, band, region);
+        writeRAMWindow(0x24, bandFramebuffer, band, region);
+    }
+
+    //Field texts are free for the next frame from now on
+    shownFieldTexts = fieldTexts;
+    shownBlank = frameBlank;
+    shownValid = true;
+
+    writeCommand(0x22, partialRefresh ? 0xCF : 0xC7);   //Display with mode 2 or 1
 
     writeCommand(0x20);
 
-    waitDisplayIdle();
+    refreshState = RefreshState::Refreshing;
+    refreshPartial = partialRefresh;
+}
+
+/*!
+ * \brief Finish a display refresh after the display controller became idle.
+ *
+ * Writes the refreshed regions of the now shown image (rendered band by band again) also to the "old image" RAM
+ * bank (\p 0x26) so that both RAM banks again hold the shown image for the next partial update. Then either starts
+ * the next requested refresh (see queueRefresh()) or sends the display to sleep (see sleep()).
+ */
+void DISPLAY_TYPE::finishRefresh()
+{
+    for (uint8_t band = 0; band < numBands; ++band)
+    {
+        if (!refreshRegions[band].dirty)
+            continue;
+
+        renderBand(shownFieldTexts, shownBlank, bandFramebuffer, band, refreshRegions[band]);
+        writeRAMWindow(0x26, bandFramebuffer, band, refreshRegions[band]);
+    }
+
+    controllerRAMValid = true;
+
+    if (refreshPartial)
+        ++partialRefreshCount;
+    else
+        partialRefreshCount = 0;
+
+    refreshState = RefreshState::Idle;
+
+    if (framePending)
+        startRefresh();
+
+    if (refreshState == RefreshState::Idle)
+        sleep();
+}
+
+/*!
+ * \brief Wait until all requested display refreshes have finished.
+ *
+ * Sleeps until the display controller is idle (see waitDisplayIdle()) and calls
+ * finishRefresh() until no refresh is in progress or pending anymore.
+ */
+void DISPLAY_TYPE::completeRefresh()
+{
+    while (refreshState == RefreshState::Refreshing)
+    {
+        waitDisplayIdle(refreshPartial ? BusyPhase::PartialRefresh : BusyPhase::FullRefresh);
+        finishRefresh();
+    }
+}
+
+/*!
+ * \brief Add a rectangle to the regions to be written by the next refresh.
+ *
+ * Extends the region of every band that intersects the rectangle (see \p refreshRegions)
+ * such that it also covers the intersection. The horizontal extent is rounded to whole bytes
+ * (i.e. 8 pixels), which matches the controller's RAM addressing.
+ *
+ * \param pX1 Left edge x-coordinate.
+ * \param pY1 Top edge y-coordinate.
+ * \param pX2 Right edge x-coordinate.
+ * \param pY2 Bottom edge y-coordinate.
+ */
+void DISPLAY_TYPE::markDirty(int16_t pX1, int16_t pY1, int16_t pX2, int16_t pY2)
+{
+    pX1 = std::max<int16_t>(pX1, 0);
+    pY1 = std::max<int16_t>(pY1, 0);
+    pX2 = std::min<int16_t>(pX2, 199);
+    pY2 = std::min<int16_t>(pY2, 199);
+
+    if ((pX1 > pX2) || (pY1 > pY2))
+        return;
+
+    const uint8_t xByte1 = pX1 / 8;
+    const uint8_t xByte2 = pX2 / 8;
+
+    for (uint8_t band = pY1 / bandRows; band <= pY2 / bandRows; ++band)
+    {
+        BandRegion& region = refreshRegions[band];
+
+        const uint8_t y1 = std::max<int16_t>(pY1 - band*bandRows, 0);
+        const uint8_t y2 = std::min<int16_t>(pY2 - band*bandRows, bandRows-1);
+
+        if (!region.dirty)
+        {
+            region = {true, xByte1, xByte2, y1, y2};
+            continue;
+        }
+
+        region.xByte1 = std::min(region.xByte1, xByte1);
+        region.xByte2 = std::max(region.xByte2, xByte2);
+        region.y1 = std::min(region.y1, y1);
+        region.y2 = std::max(region.y2, y2);
+    }
+}
+
+/*!
+ * \brief Write a rectangular region of a band framebuffer to one of the controller's RAM banks.
+ *
+ * Sets the controller's RAM window (\p 0x44, \p 0x45; only if changed, see writeSetting()) and address counters (\p 0x4E, \p 0x4F)
+ * to the specified region of band \p pBand and then writes only the corresponding rows/bytes of \p pFramebuffer
+ * using RAM write command \p pCmd (\p 0x24 for black/white RAM or \p 0x26 for "red"/old image RAM).
+ *
+ * \param pCmd RAM write command.
+ * \param pFramebuffer Band framebuffer holding the rendered band.
+ * \param pBand Index of the band (0 to \p numBands - 1).
+ * \param pRegion Region within the band.
+ */
+void DISPLAY_TYPE::writeRAMWindow(uint8_t pCmd, const BandFramebuffer& pFramebuffer, uint8_t pBand, const BandRegion& pRegion) const
+{
+    const uint8_t y1 = pBand*bandRows + pRegion.y1;
+    const uint8_t y2 = pBand*bandRows + pRegion.y2;
+
+    writeSetting(0x44, {pRegion.xByte1, pRegion.xByte2});
+    writeSetting(0x45, {y1, 0x00, y2, 0x00});
+
+    writeCommand(0x4E, pRegion.xByte1);
+    writeCommand(0x4F, y1, 0x00);
+
+    writeCommandStrided(pCmd, pFramebuffer.data() + 25*static_cast<size_t>(pRegion.y1) + pRegion.xByte1,
+                        pRegion.xByte2 - pRegion.xByte1 + 1, pRegion.y2 - pRegion.y1 + 1, 25);
 }
 
 //
@@ -449,30 +792,139 @@ void DISPLAY_TYPE::updateDisplay() const
  */
 bool DISPLAY_TYPE::displayBusy() const
 {
-    bool inputHighB = (readRegSX1509(SX1509RegisterAddress::RegDataB) & bankBMaskDspBUSY) != 0b0;
-    bool inputHighA = (readRegSX1509(SX1509RegisterAddress::RegDataA) & bankAMaskDspBUSY) != 0b0;
-
-    return inputHighB || inputHighA;
+    //Only need to read the IO bank that the BUSY pin belongs to
+    if (bankBMaskDspBUSY != 0b0)
+        return (readRegSX1509(SX1509RegisterAddress::RegDataB) & bankBMaskDspBUSY) != 0b0;
+    else
+        return (readRegSX1509(SX1509RegisterAddress::RegDataA) & bankAMaskDspBUSY) != 0b0;
 }
 
 /*!
  * \brief Wait until display controller is not busy.
  *
- * See also displayBusy().
+ * If the SX1509's \p NINT pin is connected, waits via waitDisplayIdleInterrupt().
+ *
+ * Otherwise, for a known duration of \p pPhase (learned from previous waits for the same phase),
+ * first sleeps (delay(), i.e. RTC-based sleep) for most of this expected duration and only then polls
+ * displayBusy() in sparse intervals. The measured duration updates the learned duration afterwards.
+ *
+ * Since a wait like this can never measure less than the sleep duration, the learned duration could only slowly
+ * shrink again after a single slow outlier. Therefore every \p busyCalibrationInterval -th wait of a phase,
+ * and the wait directly after one that found \p BUSY already low after sleeping (i.e. overslept), polls from
+ * the start instead. A shorter duration measured this way replaces the learned duration immediately.
+ *
+ * Phase BusyPhase::Other is always polled in 10ms intervals.
+ *
+ * \param pPhase Type of the operation that is waited for.
  */
-void DISPLAY_TYPE::waitDisplayIdle() const
+void DISPLAY_TYPE::waitDisplayIdle(BusyPhase pPhase) const
 {
+    if (pinSX1509INT != Pins::NotConnected)
+    {
+        waitDisplayIdleInterrupt();
+        return;
+    }
+
+    if (pPhase == BusyPhase::Other)
+    {
+        while (displayBusy())
+            delay(10);
+
+        return;
+    }
+
+    uint32_t& expectedMillis = busyMillis[static_cast<size_t>(pPhase)];
+    uint8_t& waitsUntilCalibration = busyWaitsUntilCalibration[static_cast<size_t>(pPhase)];
+
+    const unsigned long startMillis = millis();
+
+    //Sleep for most of the expected duration (unless calibrating) and then poll with an interval
+    //that is small compared to that duration
+    uint32_t pollMillis = 10;
+
+    if (expectedMillis > 0)
+        pollMillis = std::max(pollMillis, expectedMillis/32);
+
+    const bool calibrate = (expectedMillis == 0 || waitsUntilCalibration == 0);
+
+    if (calibrate)
+        waitsUntilCalibration = busyCalibrationInterval - 1;
+    else
+    {
+        --waitsUntilCalibration;
+
+        delay(expectedMillis - expectedMillis/8);
+    }
+
+    bool overslept = !calibrate;
+
     while (displayBusy())
-        delay(10);
+    {
+        overslept = false;
+        delay(pollMillis);
+    }
+
+    uint32_t measuredMillis = millis() - startMillis;
+
+    if (expectedMillis == 0 || (calibrate && measuredMillis < expectedMillis))
+        expectedMillis = measuredMillis;
+    else
+        expectedMillis = (3*expectedMillis + measuredMillis) / 4;
+
+    //Actual duration is unknown (possibly much shorter); measure it during the next wait
+    if (overslept)
+        waitsUntilCalibration = 0;
+}
+
+/*!
+ * \brief Wait until display controller is not busy using the SX1509 interrupt.
+ *
+ * Clears pending SX1509 interrupts (releasing \p NINT) and the flag set by isrDisplayIdle(), which was attached
+ * to the falling edge of the \p NINT pin in setup(). If the display controller is busy, sleeps (sd_app_evt_wait())
+ * until the interrupt for the falling edge of \p BUSY occurs.
+ */
+void DISPLAY_TYPE::waitDisplayIdleInterrupt() const
+{
+    writeRegSX1509(SX1509RegisterAddress::RegInterruptSourceB, bankBMaskDspBUSY);
+    writeRegSX1509(SX1509RegisterAddress::RegInterruptSourceA, bankAMaskDspBUSY);
+
+    irqDisplayIdle = false;
+
+    //Check BUSY only after arming the interrupt in order to not miss the edge
+    if (displayBusy())
+    {
+        while (!irqDisplayIdle)
+            sd_app_evt_wait();
+    }
+
+    writeRegSX1509(SX1509RegisterAddress::RegInterruptSourceB, bankBMaskDspBUSY);
+    writeRegSX1509(SX1509RegisterAddress::RegInterruptSourceA, bankAMaskDspBUSY);
+}
+
+//
+
+/*!
+ * \brief Interrupt service routine for SX1509 interrupt (\p BUSY pin change).
+ *
+ * Sets the flag that is waited for in waitDisplayIdleInterrupt().
+ */
+void DISPLAY_TYPE::isrDisplayIdle()
+{
+    irqDisplayIdle = true;
 }
 
 //
 
 /*!
  * \brief Reset display controller via hardware reset pin.
+ *
+ * Note: Controller RAM content and settings are considered lost afterwards.
  */
 void DISPLAY_TYPE::hwResetDisplay() const
 {
+    controllerRAMValid = false;
+    invalidateSettings();
+
     setPinsHighSX1509(bankBMaskDspRST, bankAMaskDspRST);    //First set RST high, as constant low RST eventually turns off power
     delay(100);
     setPinsLowSX1509(bankBMaskDspRST, bankAMaskDspRST);
@@ -481,6 +933,24 @@ void DISPLAY_TYPE::hwResetDisplay() const
     delay(10);
 }
 
+/*!
+ * \brief Wake display controller from deep sleep mode via hardware reset pin.
+ *
+ * Unlike hwResetDisplay() this assumes that \p RST is already high (display powered, see sleep())
+ * and therefore only issues the reset pulse, waiting for the controller to become idle afterwards.
+ * Leaving deep sleep mode 1 this way retains the RAM content but resets all settings.
+ */
+void DISPLAY_TYPE::wakeDisplay() const
+{
+    setPinsLowSX1509(bankBMaskDspRST, bankAMaskDspRST);
+    delay(10);
+    setPinsHighSX1509(bankBMaskDspRST, bankAMaskDspRST);
+
+    invalidateSettings();
+
+    waitDisplayIdle(BusyPhase::WakeReset);
+}
+
 /*!
  * \brief Fully turn off the display.
  *
@@ -611,28 +1081,120 @@ void DISPLAY_TYPE::writeCommand(uint8_t pCmd, uint8_t pData1, uint8_t pData2, ui
  */
 void DISPLAY_TYPE::writeCommandRaw(uint8_t pCmd, const uint8_t* pData, uint16_t pLength) const
 {
-    setSPIDCCommand();
+    writeCommandStrided(pCmd, pData, pLength, 1, pLength);
+}
+
+/*!
+ * \brief Write a display command with rows of data bytes.
+ *
+ * Writes \p pCmd followed by \p pNumRows rows of \p pRowLength data bytes each, all within the same transaction.
+ * Consecutive rows start \p pStride bytes apart in \p pData, which allows to write a sub-rectangle of an image buffer.
+ *
+ * Data bytes are sent via AbstractSPIDisplay::transferBulk() (one EasyDMA transfer per row or for all contiguous rows).
+ *
+ * \param pCmd Command byte.
+ * \param pData Data bytes of first row.
+ * \param pRowLength Number of data bytes per row.
+ * \param pNumRows Number of rows.
+ * \param pStride Distance between the beginnings of consecutive rows in \p pData.
+ */
+void DISPLAY_TYPE::writeCommandStrided(uint8_t pCmd, const uint8_t* pData, uint16_t pRowLength, uint16_t pNumRows, uint16_t pStride) const
+{
+    const uint16_t length = pRowLength * pNumRows;
 
     SPI.beginTransaction(spiSettings);
-    selectChip();
+
+    //Select chip and configure DC for "command" with a single SX1509 write (see setSPIDCCommand(), selectChip())
+    setPinsSX1509(0b0, 0b0, (bankBMaskDspCS | bankBMaskDspDC), (bankAMaskDspCS | bankAMaskDspDC));
 
     delayMicroseconds(20);
 
     SPI.transfer(pCmd);
 
-    if (pLength > 0)
+    if (length > 0)
     {
         setSPIDCData();
         delayMicroseconds(20);
     }
 
-    for (uint16_t i = 0; i < pLength; ++i)
-        SPI.transfer(*(pData+i));
+    if (length > 0)
+    {
+        if (pRowLength == pStride)
+            transferBulk(pData, length);
+        else
+        {
+            for (uint16_t row = 0; row < pNumRows; ++row)
+                transferBulk(pData + row*pStride, pRowLength);
+        }
+    }
+
+    //Deselect chip and reset DC to "command" with a single SX1509 write (see deselectChip(), setSPIDCCommand())
+    setPinsSX1509(bankBMaskDspCS, bankAMaskDspCS, bankBMaskDspDC, bankAMaskDspDC);
 
-    deselectChip();
     SPI.endTransaction();
+}
+
+//
+
+/*!
+ * \brief Write a display setting command unless already set.
+ *
+ * Tracks the data bytes last written for a number of setting commands (\p 0x01, \p 0x11, \p 0x1A,
+ * \p 0x3C, \p 0x44, \p 0x45) and skips the transaction if the same data was already written since
+ * the last reset (see invalidateSettings()). Other commands are always written.
+ *
+ * \param pCmd Command byte.
+ * \param pData Data bytes (at most four).
+ */
+void DISPLAY_TYPE::writeSetting(uint8_t pCmd, std::initializer_list<uint8_t> pData) const
+{
+    CachedSetting* setting = nullptr;
+
+    for (CachedSetting& tSetting : settings)
+    {
+        if (tSetting.cmd == pCmd)
+        {
+            setting = &tSetting;
+            break;
+        }
+    }
+
+    if (setting != nullptr && pData.size() > sizeof(setting->data))
+        setting = nullptr;
+
+    if (setting != nullptr && setting->valid && setting->length == pData.size())
+    {
+        bool equal = true;
+
+        for (size_t i = 0; i < pData.size(); ++i)
+            if (setting->data[i] != *(pData.begin()+i))
+                equal = false;
+
+        if (equal)
+            return;
+    }
+
+    writeCommandRaw(pCmd, pData.begin(), pData.size());
+
+    if (setting != nullptr)
+    {
+        for (size_t i = 0; i < pData.size(); ++i)
+            setting->data[i] = *(pData.begin()+i);
 
-    setSPIDCCommand();
+        setting->length = pData.size();
+        setting->valid = true;
+    }
+}
+
+/*!
+ * \brief Forget all tracked display settings.
+ *
+ * Needs to be called whenever the display controller resets its settings (see writeSetting()).
+ */
+void DISPLAY_TYPE::invalidateSettings() const
+{
+    for (CachedSetting& setting : settings)
+        setting.valid = false;
 }
 
 //
@@ -680,25 +1242,72 @@ uint8_t DISPLAY_TYPE::readRegSX1509(SX1509RegisterAddress pAddr) const
 
 //
 
+/*!
+ * \brief Write output states of both SX1509 IO banks.
+ *
+ * Writes \p pDataB and \p pDataA to the consecutive registers \p RegDataB and \p RegDataA
+ * in a single I2C transaction (using register address auto-increment) and updates the
+ * output shadow registers accordingly (see setPinsSX1509()).
+ *
+ * \param pDataB New output states for SX1509's IO bank B.
+ * \param pDataA New output states for SX1509's IO bank A.
+ */
+void DISPLAY_TYPE::writeDataSX1509(uint8_t pDataB, uint8_t pDataA) const
+{
+    Wire.beginTransmission(ioExpanderI2CAddr);
+
+    Wire.write(static_cast<uint8_t>(SX1509RegisterAddress::RegDataB));
+    Wire.write(pDataB);
+    Wire.write(pDataA);
+
+    Wire.endTransmission(true);
+
+    dataShadowB = pDataB;
+    dataShadowA = pDataA;
+}
+
+//
+
+/*!
+ * \brief Set some SX1509 output pins to high and some to low state.
+ *
+ * Output pins corresponding to a '1' bit in the bit masks \p pHighBankBMask and \p pHighBankAMask are set
+ * to \e high state and output pins corresponding to a '1' bit in the bit masks \p pLowBankBMask and
+ * \p pLowBankAMask are set to \e low state, while keeping the state of all other pins.
+ *
+ * The output states are not read back from the SX1509 but taken from shadow registers that hold the
+ * last written states. Both IO banks are written at once and only if any state actually changes.
+ *
+ * \param pHighBankBMask Bit mask of pins to set high for SX1509's IO bank B.
+ * \param pHighBankAMask Bit mask of pins to set high for SX1509's IO bank A.
+ * \param pLowBankBMask Bit mask of pins to set low for SX1509's IO bank B.
+ * \param pLowBankAMask Bit mask of pins to set low for SX1509's IO bank A.
+ */
+void DISPLAY_TYPE::setPinsSX1509(uint8_t pHighBankBMask, uint8_t pHighBankAMask, uint8_t pLowBankBMask, uint8_t pLowBankAMask) const
+{
+    uint8_t dataB = (dataShadowB | pHighBankBMask) & ~pLowBankBMask;
+    uint8_t dataA = (dataShadowA | pHighBankAMask) & ~pLowBankAMask;
+
+    if ((dataB == dataShadowB) && (dataA == dataShadowA))
+        return;
+
+    writeDataSX1509(dataB, dataA);
+}
+
 /*!
  * \brief Set some SX1509 output pins to high state.
  *
  * Output pins corresponding to a '1' bit in the bit masks \p pBankBMask and
  * \p pBankAMask are set to \e high state while keeping the state of all other pins.
  *
+ * See also setPinsSX1509().
+ *
  * \param pBankBMask Bit mask for SX1509's IO bank B.
  * \param pBankAMask Bit mask for SX1509's IO bank A.
  */
 void DISPLAY_TYPE::setPinsHighSX1509(uint8_t pBankBMask, uint8_t pBankAMask) const
 {
-    uint8_t dataB = readRegSX1509(SX1509RegisterAddress::RegDataB);
-    uint8_t dataA = readRegSX1509(SX1509RegisterAddress::RegDataA);
-
-    dataB |= pBankBMask;
-    dataA |= pBankAMask;
-
-    writeRegSX1509(SX1509RegisterAddress::RegDataB, dataB);
-    writeRegSX1509(SX1509RegisterAddress::RegDataA, dataA);
+    setPinsSX1509(pBankBMask, pBankAMask, 0b0, 0b0);
 }
 
 /*!
@@ -707,19 +1316,14 @@ void DISPLAY_TYPE::setPinsHighSX1509(uint8_t pBankBMask, uint8_t pBankAMask) con
  * Output pins corresponding to a '1' bit in the bit masks \p pBankBMask and
  * \p pBankAMask are set to \e low state while keeping the state of all other pins.
  *
+ * See also setPinsSX1509().
+ *
  * \param pBankBMask Bit mask for SX1509's IO bank B.
  * \param pBankAMask Bit mask for SX1509's IO bank A.
  */
 void DISPLAY_TYPE::setPinsLowSX1509(uint8_t pBankBMask, uint8_t pBankAMask) const
 {
-    uint8_t dataB = readRegSX1509(SX1509RegisterAddress::RegDataB);
-    uint8_t dataA = readRegSX1509(SX1509RegisterAddress::RegDataA);
-
-    dataB &= ~pBankBMask;
-    dataA &= ~pBankAMask;
-
-    writeRegSX1509(SX1509RegisterAddress::RegDataB, dataB);
-    writeRegSX1509(SX1509RegisterAddress::RegDataA, dataA);
+    setPinsSX1509(0b0, 0b0, pBankBMask, pBankAMask);
 }
 
 //
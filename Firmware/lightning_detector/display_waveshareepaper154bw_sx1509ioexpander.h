@@ -28,9 +28,16 @@
 
 #include "as3935.h"
 #include "auxil.h"
+#include "fonts.h"
+#include "monoframebuffer.h"
+#include "pins.h"
+#include "statusscreenlayout.h"
 
 #include <Arduino.h>
 
+#include <array>
+#include <initializer_list>
+
 #define DISPLAY_TYPE Display_WaveshareEPaper154BW_SX1509IOExpander
 
 /*!
@@ -43,33 +50,90 @@
  * The size of 200x200 pixels is large enough for all information that is passed to
  * the update function to be simultaneously shown on the display (see also update()).
  *
+ * The status screen is retained rather than redrawn: Its static parts (frame, caption, labels, lines) are prerendered
+ * into flash (see StatusScreenBackground) and the variable information is placed in a fixed table of text fields (see \p statusFields).
+ * update() only formats the field texts, and a refresh re-renders and transfers only the regions of those fields whose
+ * text differs from the shown one. The image is not held in a full display buffer but rendered in horizontal bands of
+ * \p bandRows rows into a small MonoFramebuffer and streamed band by band to the display controller's RAM (see startRefresh()).
+ *
+ * Display refreshes run asynchronously (see update(), service()) and use the partial refresh waveform for the changed region of the image whenever possible
+ * and fall back to a full refresh after a configurable number of partial refreshes (see startRefresh()).
+ *
+ * sleep() puts the display controller into deep sleep mode 1, which retains its RAM, such that a following init()
+ * can take a fast "warm" path and the next partial refresh only needs to transfer the changed region. As long
+ * as the display is not turned off via powerOff(), however, the module draws ~2mA of current (see turnOffDisplay()).
+ * Already configured controller settings are tracked and not sent again (see writeSetting()).
+ *
+ * While the display controller is busy the MCU sleeps. If the SX1509's interrupt output (\p NINT) is connected to an MCU pin,
+ * the MCU is woken up by a \p BUSY pin change interrupt. Otherwise it sleeps for the learned, expected duration of the
+ * respective operation and only then starts polling the \p BUSY pin (see waitDisplayIdle()).
+ *
  * \attention You must call setup() before using the class.
  */
 class DISPLAY_TYPE : public AbstractSPIDisplay
 {
 public:
-    DISPLAY_TYPE(uint8_t pSX1509Addr, uint8_t pPinNumDspCS, uint8_t pPinNumDspDC, uint8_t pPinNumDspRST, uint8_t pPinNumDspBUSY);
+    DISPLAY_TYPE(uint8_t pSX1509Addr, uint8_t pPinNumDspCS, uint8_t pPinNumDspDC, uint8_t pPinNumDspRST, uint8_t pPinNumDspBUSY,
+                 Pin pPinSX1509INT, uint8_t pFullRefreshInterval);
                                         ///< Constructor.
     //
     void setup() const override final;  ///< \copybrief AbstractSPIDisplay::setup()
     //
     void init() const override final;   ///< \copybrief AbstractSPIDisplay::init()
     void sleep() const override final;  ///< \copybrief AbstractSPIDisplay::sleep()
+    void powerOff() const override final;   ///< \copybrief AbstractSPIDisplay::powerOff()
     //
     void clear() override final;        ///< \copybrief AbstractSPIDisplay::clear()
     void update(size_t pNumLightnings, float pLightningRate, uint8_t pStormDist, float pBatteryPercentage, float pBatteryVoltage,
                 float pRunTimeHours, Auxil::RunMode pMode, bool pSerialEnabled, AS3935::InterruptType pLastInterrupt) override final;
                                         ///< \copybrief AbstractSPIDisplay::update()
+    //
+    void service() override final;          ///< \copybrief AbstractSPIDisplay::service()
+    bool refreshing() const override final; ///< \copybrief AbstractSPIDisplay::refreshing()
+
+private:
+    enum class BusyPhase : uint8_t;
+    enum class StatusField : uint8_t;
+    struct BandRegion;
+
+private:
+    static constexpr uint8_t bandRows = 25;             ///< Number of display rows per render band.
+    static constexpr uint8_t numBands = 200 / bandRows; ///< Number of render bands.
+    //
+    typedef MonoFramebuffer<200, bandRows> BandFramebuffer; ///< Framebuffer type for a single render band.
+    //
+    static constexpr uint8_t numStatusFields = 7;           ///< Number of text fields of the status screen.
+    static constexpr uint8_t statusFieldMaxChars = 10;      ///< Maximum number of characters of a status screen text field.
+    //
+    typedef std::array<std::array<char, statusFieldMaxChars+1>, numStatusFields> FieldTexts;  ///< Texts of all status screen fields.
+    //
+    static constexpr uint8_t busyCalibrationInterval = 8;   ///< Every n-th busy wait of a phase is polled from the start (see waitDisplayIdle()).
 
 private:
     void setPixel(size_t pX, size_t pY, uint8_t pR, uint8_t pG, uint8_t pB) override final; ///< \copybrief AbstractSPIDisplay::setPixel()
     //
-    void updateDisplay() const;                 ///< Update the display according to the current buffer content.
+    void setField(StatusField pField, const char* pText);              ///< Set the text of a status screen field for the next frame.
+    //
+    void renderBand(const FieldTexts& pFieldTexts, bool pBlank, BandFramebuffer& pFramebuffer, uint8_t pBand, const BandRegion& pRegion);
+                                                    ///< Render a region of one band of an image into a band framebuffer.
+    //
+    void queueRefresh(bool pForceFullRefresh);      ///< Request an asynchronous display refresh for the current field texts.
+    void startRefresh();                            ///< Start a display refresh according to the current field texts.
+    void finishRefresh();                           ///< Finish a display refresh after the display controller became idle.
+    void completeRefresh();                         ///< Wait until all requested display refreshes have finished.
+    void markDirty(int16_t pX1, int16_t pY1, int16_t pX2, int16_t pY2);
+                                                    ///< Add a rectangle to the regions to be written by the next refresh.
+    void writeRAMWindow(uint8_t pCmd, const BandFramebuffer& pFramebuffer, uint8_t pBand, const BandRegion& pRegion) const;
+                                                    ///< Write a rectangular region of a band framebuffer to one of the controller's RAM banks.
     //
     bool displayBusy() const;                   ///< Check if display controller is busy.
-    void waitDisplayIdle() const;               ///< Wait until display controller is not busy.
+    void waitDisplayIdle(BusyPhase pPhase) const;   ///< Wait until display controller is not busy.
+    void waitDisplayIdleInterrupt() const;          ///< Wait until display controller is not busy using the SX1509 interrupt.
+    //
+    static void isrDisplayIdle();                   ///< Interrupt service routine for SX1509 interrupt (\p BUSY pin change).
     //
     void hwResetDisplay() const;                ///< Reset display controller via hardware reset pin.
+    void wakeDisplay() const;                   ///< Wake display controller from deep sleep mode via hardware reset pin.
     void turnOffDisplay() const;                ///< Fully turn off the display.
     //
     void selectChip() const override final;     ///< \copybrief AbstractSPIDisplay::selectChip()
@@ -86,6 +150,120 @@ private:
     void writeCommand(uint8_t pCmd, uint8_t pData1, uint8_t pData2, uint8_t pData3, uint8_t pData4) const;
                                                                                         ///< Write a display command with four data bytes.
     void writeCommandRaw(uint8_t pCmd, const uint8_t* pData, uint16_t pLength) const;   ///< Write a display command with many data bytes.
+    void writeCommandStrided(uint8_t pCmd, const uint8_t* pData, uint16_t pRowLength, uint16_t pNumRows, uint16_t pStride) const;
+                                                                                        ///< Write a display command with rows of data bytes.
+    //
+    void writeSetting(uint8_t pCmd, std::initializer_list<uint8_t> pData) const;   ///< Write a display setting command unless already set.
+    void invalidateSettings() const;                                                ///< Forget all tracked display settings.
+
+private:
+    /*!
+     * \brief Power/sleep state of the display controller.
+     */
+    enum class PanelState : uint8_t
+    {
+        Off = 0,        ///< Power turned off (RAM content lost).
+        DeepSleep = 1,  ///< In deep sleep mode 1 (RAM content retained).
+        Active = 2      ///< Initialized and ready to receive commands.
+    };
+
+    /*!
+     * \brief State of the asynchronous display refresh.
+     */
+    enum class RefreshState : uint8_t
+    {
+        Idle = 0,       ///< No refresh in progress.
+        Refreshing = 1  ///< Display controller is refreshing the panel.
+    };
+
+    /*!
+     * \brief Display controller operation types with different, characteristic busy durations.
+     */
+    enum class BusyPhase : uint8_t
+    {
+        Other = 0,          ///< Any short/unspecified operation (duration not learned).
+        ColdReset = 1,      ///< Software reset command after power-up (see init()).
+        WakeReset = 2,      ///< Hardware reset pulse waking from deep sleep mode (see wakeDisplay()).
+        LoadWaveform = 3,   ///< Loading temperature and waveform.
+        FullRefresh = 4,    ///< Full display refresh (display mode 1).
+        PartialRefresh = 5  ///< Partial display refresh (display mode 2).
+    };
+
+    /*!
+     * \brief Last written value of a display setting command.
+     */
+    struct CachedSetting
+    {
+        uint8_t cmd;        ///< Command byte.
+        bool valid;         ///< Setting is known to be currently applied.
+        uint8_t length;     ///< Number of data bytes.
+        uint8_t data[4];    ///< Data bytes.
+    };
+
+    /*!
+     * \brief Rectangular region within a render band.
+     */
+    struct BandRegion
+    {
+        bool dirty;         ///< Region is non-empty (band needs to be written).
+        uint8_t xByte1;     ///< First byte column (0 to 24).
+        uint8_t xByte2;     ///< Last byte column (0 to 24).
+        uint8_t y1;         ///< First row relative to the band (0 to \p bandRows - 1).
+        uint8_t y2;         ///< Last row relative to the band (0 to \p bandRows - 1).
+    };
+
+    /*!
+     * \brief Text fields of the status screen (index into \p statusFields).
+     */
+    enum class StatusField : uint8_t
+    {
+        NumLightnings = 0,      ///< Accumulated number of lightnings.
+        LightningRate = 1,      ///< Lightning rate.
+        BatteryVoltage = 2,     ///< Battery voltage.
+        StormDistance = 3,      ///< Storm distance.
+        BatteryPercentage = 4,  ///< Battery charge percentage.
+        Status = 5,             ///< Short status information.
+        RunTime = 6             ///< Run time.
+    };
+
+    /*!
+     * \brief Horizontal alignment of the text within a status screen field.
+     */
+    enum class FieldAlignment : uint8_t
+    {
+        Left = 0,   ///< Left-aligned.
+        Right = 1   ///< Right-aligned.
+    };
+
+    /*!
+     * \brief Layout of a status screen text field.
+     */
+    struct StatusFieldLayout
+    {
+        int16_t x;                  ///< X-coordinate of the left edge of the field.
+        int16_t y;                  ///< Y-coordinate of the top edge of the field.
+        uint8_t numChars;           ///< Field width in characters (at most \p statusFieldMaxChars).
+        const Font* font;           ///< %Font of the field text.
+        FieldAlignment alignment;   ///< Alignment of the text within the field.
+    };
+
+private:
+    static constexpr StatusFieldLayout statusFields[numStatusFields] = {
+        {StatusScreenLayout::textOfsX,                                      StatusScreenLayout::rowY0 + 1*StatusScreenLayout::rowPitch, 10,
+         &Font_TerminASCII24Status, FieldAlignment::Left},
+        {StatusScreenLayout::textOfsX + 11*StatusScreenLayout::charWidth,   StatusScreenLayout::rowY0 + 1*StatusScreenLayout::rowPitch,  5,
+         &Font_TerminASCII24Status, FieldAlignment::Right},
+        {StatusScreenLayout::textOfsX,                                      StatusScreenLayout::rowY0 + 3*StatusScreenLayout::rowPitch,  7,
+         &Font_TerminASCII24Status, FieldAlignment::Left},
+        {StatusScreenLayout::textOfsX + 8*StatusScreenLayout::charWidth,    StatusScreenLayout::rowY0 + 3*StatusScreenLayout::rowPitch,  8,
+         &Font_TerminASCII24Status, FieldAlignment::Right},
+        {StatusScreenLayout::textOfsX,                                      StatusScreenLayout::rowY0 + 4*StatusScreenLayout::rowPitch,  7,
+         &Font_TerminASCII24Status, FieldAlignment::Left},
+        {StatusScreenLayout::textOfsX,                                      StatusScreenLayout::rowY0 + 5*StatusScreenLayout::rowPitch,  7,
+         &Font_TerminASCII24Status, FieldAlignment::Left},
+        {StatusScreenLayout::textOfsX + 8*StatusScreenLayout::charWidth,    StatusScreenLayout::rowY0 + 5*StatusScreenLayout::rowPitch,  8,
+         &Font_TerminASCII24Status, FieldAlignment::Right}
+    };                                                          ///< Layout of the status screen text fields (see StatusField).
 
 private:
     enum class SX1509RegisterAddress : uint8_t;
@@ -94,6 +272,10 @@ private:
     void writeRegSX1509(SX1509RegisterAddress pAddr, uint8_t pVal) const;   ///< Write to SX1509 register.
     uint8_t readRegSX1509(SX1509RegisterAddress pAddr) const;               ///< Read from SX1509 register.
     //
+    void writeDataSX1509(uint8_t pDataB, uint8_t pDataA) const;             ///< Write output states of both SX1509 IO banks.
+    //
+    void setPinsSX1509(uint8_t pHighBankBMask, uint8_t pHighBankAMask, uint8_t pLowBankBMask, uint8_t pLowBankAMask) const;
+                                                                            ///< Set some SX1509 output pins to high and some to low state.
     void setPinsHighSX1509(uint8_t pBankBMask, uint8_t pBankAMask) const;   ///< Set some SX1509 output pins to high state.
     void setPinsLowSX1509(uint8_t pBankBMask, uint8_t pBankAMask) const;    ///< Set some SX1509 output pins to low state.
     //
@@ -106,6 +288,7 @@ private:
     const uint8_t pinNumDspDC;      ///< SX1509 pin for display's DC pin.
     const uint8_t pinNumDspRST;     ///< SX1509 pin for display's RST pin.
     const uint8_t pinNumDspBUSY;    ///< SX1509 pin for display's BUSY pin.
+    const Pin pinSX1509INT;         ///< MCU pin connected to SX1509's NINT pin (or Pins::NotConnected).
     //
     const uint8_t bankAMaskDspCS;   ///< SX1509 IO bank A bit mask for display's CS pin.
     const uint8_t bankBMaskDspCS;   ///< SX1509 IO bank B bit mask for display's CS pin.
@@ -116,7 +299,35 @@ private:
     const uint8_t bankAMaskDspBUSY; ///< SX1509 IO bank A bit mask for display's BUSY pin.
     const uint8_t bankBMaskDspBUSY; ///< SX1509 IO bank B bit mask for display's BUSY pin.
     //
-    uint8_t displayBuffer[5000];    ///< Monochrome linear display buffer with one bit per pixel.
+    mutable uint8_t dataShadowB;    ///< Last written SX1509 output states [IO bank B].
+    mutable uint8_t dataShadowA;    ///< Last written SX1509 output states [IO bank A].
+    //
+    const uint8_t fullRefreshInterval;  ///< Number of consecutive partial refreshes before a full refresh is forced.
+    //
+    FieldTexts fieldTexts;          ///< Status screen field texts of the newest frame.
+    FieldTexts shownFieldTexts;     ///< Status screen field texts of the image that is currently shown on the display (or being refreshed).
+    bool frameBlank;                ///< Newest frame is a blank (all white) image instead of the status screen.
+    bool shownBlank;                ///< Shown image is a blank (all white) image instead of the status screen.
+    bool shownValid;                ///< Display content is known, i.e. \p shownFieldTexts and \p shownBlank are valid.
+    uint8_t partialRefreshCount;    ///< Number of partial refreshes since last full refresh.
+    //
+    BandFramebuffer bandFramebuffer;    ///< Framebuffer for rendering one band.
+    //
+    mutable bool controllerRAMValid;    ///< Both controller RAM banks hold the displayed image (not lost by power-off/reset).
+    mutable PanelState panelState;      ///< Current power/sleep state of the display controller.
+    //
+    RefreshState refreshState;      ///< State of the asynchronous display refresh.
+    bool framePending;              ///< Another refresh with the current field texts was requested.
+    bool framePendingFullRefresh;   ///< A full refresh was requested for the pending frame.
+    bool refreshPartial;            ///< Refresh in progress is a partial refresh.
+    BandRegion refreshRegions[numBands];    ///< Regions of each band written by the refresh in progress (or to be written by the next one).
+    //
+    mutable CachedSetting settings[6];  ///< Tracked display settings (see writeSetting()).
+    //
+    mutable uint32_t busyMillis[6];     ///< Learned durations of busy phases in milliseconds (0 if unknown; see BusyPhase).
+    mutable uint8_t busyWaitsUntilCalibration[6];   ///< Remaining waits per busy phase until it is polled from the start again.
+    //
+    static volatile bool irqDisplayIdle;    ///< SX1509 interrupt (\p BUSY pin change) occurred.
 
 private:
     /*!
@@ -134,6 +345,14 @@ private:
         RegDirA = 0x0F,             ///< Configure as input bit mask [IO bank A].
         RegDataB = 0x10,            ///< Set/read IO state [IO bank B].
         RegDataA = 0x11,            ///< Set/read IO state [IO bank A].
+        RegInterruptMaskB = 0x12,   ///< Disable interrupt bit mask [IO bank B].
+        RegInterruptMaskA = 0x13,   ///< Disable interrupt bit mask [IO bank A].
+        RegSenseHighB = 0x14,       ///< Interrupt edge sensitivity for IO[15:12].
+        RegSenseLowB = 0x15,        ///< Interrupt edge sensitivity for IO[11:8].
+        RegSenseHighA = 0x16,       ///< Interrupt edge sensitivity for IO[7:4].
+        RegSenseLowA = 0x17,        ///< Interrupt edge sensitivity for IO[3:0].
+        RegInterruptSourceB = 0x18, ///< Interrupt source / clear interrupt bit mask [IO bank B].
+        RegInterruptSourceA = 0x19, ///< Interrupt source / clear interrupt bit mask [IO bank A].
         RegReset = 0x7D             ///< Software reset.
     };
 };
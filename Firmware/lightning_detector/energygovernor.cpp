@@ -0,0 +1,227 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "energygovernor.h"
+
+#include <limits>
+
+/*!
+ * \brief Constructor.
+ *
+ * Starts with the first (i.e. highest) tier selected.
+ *
+ * \param pTiers Energy tier table, ordered by decreasing Tier::minBatteryPercentage.
+ * \param pNumTiers Number of tiers in \p pTiers (must be at least 1).
+ * \param pHysteresisPercent Additional battery percentage required to return to a higher tier.
+ */
+EnergyGovernor::EnergyGovernor(const Tier* pTiers, size_t pNumTiers, float pHysteresisPercent) :
+    tiers(pTiers),
+    numTiers(pNumTiers),
+    hysteresis(pHysteresisPercent),
+    tierIdx(0),
+    secsSinceLastBeep(std::numeric_limits<size_t>::max()),
+    secsSinceLastDisplay(std::numeric_limits<size_t>::max()),
+    secsInAS3935Phase(0),
+    as3935On(true)
+{
+}
+
+//Public
+
+/*!
+ * \brief Select the energy tier for a new battery percentage estimate.
+ *
+ * Moving to a lower tier happens as soon as \p pBatteryPercentage drops below the current tier's threshold.
+ * Moving to a higher tier requires \p pBatteryPercentage to exceed that tier's threshold by the hysteresis margin.
+ *
+ * Restarts the AS3935 duty cycle with the "on" phase if the tier changed.
+ *
+ * \param pBatteryPercentage Estimated remaining battery charge as percentage from 0 to 100.
+ * \return True if the selected tier changed and false otherwise.
+ */
+bool EnergyGovernor::updateBatteryPercentage(float pBatteryPercentage)
+{
+    size_t newTierIdx = tierIdx;
+
+    while ((newTierIdx+1 < numTiers) && (pBatteryPercentage < tiers[newTierIdx].minBatteryPercentage))
+        ++newTierIdx;
+
+    while ((newTierIdx > 0) && (pBatteryPercentage >= tiers[newTierIdx-1].minBatteryPercentage + hysteresis))
+        --newTierIdx;
+
+    if (newTierIdx == tierIdx)
+        return false;
+
+    tierIdx = newTierIdx;
+
+    secsInAS3935Phase = 0;
+    as3935On = true;
+
+    return true;
+}
+
+/*!
+ * \brief Account for elapsed time.
+ *
+ * Advances the timers for beep coalescing, display update interval and AS3935 duty cycle.
+ *
+ * \param pSecs Elapsed time in seconds.
+ */
+void EnergyGovernor::advanceTime(size_t pSecs)
+{
+    auto saturatingAdd = [](size_t& pVal, size_t pAdd) -> void
+    {
+        if (pVal > std::numeric_limits<size_t>::max() - pAdd)
+            pVal = std::numeric_limits<size_t>::max();
+        else
+            pVal += pAdd;
+    };
+
+    saturatingAdd(secsSinceLastBeep, pSecs);
+    saturatingAdd(secsSinceLastDisplay, pSecs);
+
+    if (tier().as3935OffMins == 0)
+    {
+        secsInAS3935Phase = 0;
+        as3935On = true;
+        return;
+    }
+
+    secsInAS3935Phase += pSecs;
+
+    //Switch phase(s); a phase always lasts for at least one call
+    while (true)
+    {
+        size_t phaseSecs = 60 * (as3935On ? tier().as3935OnMins : tier().as3935OffMins);
+
+        if (secsInAS3935Phase < phaseSecs)
+            break;
+
+        secsInAS3935Phase -= phaseSecs;
+        as3935On = !as3935On;
+
+        if (phaseSecs == 0)
+            break;
+    }
+}
+
+//
+
+/*!
+ * \brief Get the index of the currently selected tier.
+ *
+ * \return Index into the tier table passed to EnergyGovernor().
+ */
+size_t EnergyGovernor::getTierIndex() const
+{
+    return tierIdx;
+}
+
+//
+
+/*!
+ * \brief Get the current notification beep duration.
+ *
+ * \return Beep duration in seconds.
+ */
+float EnergyGovernor::getBeepSecs() const
+{
+    return tier().beepSecs;
+}
+
+/*!
+ * \brief Check if a notification beep shall be played now.
+ *
+ * Beeps are coalesced during bursts: a beep is only granted if at least Tier::beepCoalesceSecs
+ * have passed since the last granted beep. A granted beep restarts the coalescing interval.
+ *
+ * \return True if the beep should be played.
+ */
+bool EnergyGovernor::requestBeep()
+{
+    if (secsSinceLastBeep < tier().beepCoalesceSecs)
+        return false;
+
+    secsSinceLastBeep = 0;
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Stretch a VDD measurement interval according to the current tier.
+ *
+ * \param pIntervalSecs Nominal interval in seconds.
+ * \return \p pIntervalSecs multiplied by Tier::vddMeasIntervalFactor.
+ */
+size_t EnergyGovernor::scaleVDDMeasInterval(size_t pIntervalSecs) const
+{
+    return pIntervalSecs * tier().vddMeasIntervalFactor;
+}
+
+//
+
+/*!
+ * \brief Check if a display update is currently allowed.
+ *
+ * \return True if at least Tier::displayMinIntervalSecs have passed since the last registerDisplayUpdate().
+ */
+bool EnergyGovernor::displayUpdateAllowed() const
+{
+    return secsSinceLastDisplay >= tier().displayMinIntervalSecs;
+}
+
+/*!
+ * \brief Restart the minimum display update interval.
+ *
+ * Call this whenever the display was updated.
+ */
+void EnergyGovernor::registerDisplayUpdate()
+{
+    secsSinceLastDisplay = 0;
+}
+
+//
+
+/*!
+ * \brief Check if the AS3935 should currently be powered.
+ *
+ * \return False during the "off" phase of the current tier's AS3935 duty cycle and true otherwise.
+ */
+bool EnergyGovernor::as3935Enabled() const
+{
+    return as3935On;
+}
+
+//Private
+
+/*!
+ * \brief Get the currently selected tier.
+ *
+ * \return Current tier table entry.
+ */
+const EnergyGovernor::Tier& EnergyGovernor::tier() const
+{
+    return tiers[tierIdx];
+}
@@ -0,0 +1,97 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef ENERGYGOVERNOR_H
+#define ENERGYGOVERNOR_H
+
+#include <Arduino.h>
+
+/*!
+ * \brief Energy-aware degradation policy for the notification features.
+ *
+ * Selects one of several "energy tiers" depending on the estimated remaining battery charge and
+ * derives from the selected tier how the power-hungry features should currently behave (beep length,
+ * coalescing of beeps during lightning bursts, VDD measurement interval, minimum interval between
+ * display updates and an optional on/off duty cycle for the AS3935).
+ *
+ * The tiers are passed as a table (see Tier) that must be ordered by decreasing Tier::minBatteryPercentage.
+ * The last tier should use a threshold of 0 so that any non-negative percentage selects some tier.
+ * Returning to a higher tier requires exceeding its threshold by a hysteresis margin to avoid
+ * switching back and forth due to voltage fluctuations of the coin cells.
+ *
+ * The class does not access any hardware. Elapsed time must be passed via advanceTime() and
+ * the resulting decisions are to be applied by the caller. The policy can thus also be
+ * simulated on a host system by feeding it percentage and time sequences.
+ */
+class EnergyGovernor
+{
+public:
+    /*!
+     * \brief Settings for a single energy tier.
+     */
+    struct Tier
+    {
+        float minBatteryPercentage;     ///< Tier is used while estimated battery percentage is at least this value.
+        float beepSecs;                 ///< Buzzer beep duration for lightning notification in seconds.
+        size_t beepCoalesceSecs;        ///< Minimum time between two notification beeps in seconds (0: beep for every lightning).
+        size_t vddMeasIntervalFactor;   ///< Factor to stretch the VDD measurement interval with.
+        size_t displayMinIntervalSecs;  ///< Minimum time between two display updates in seconds.
+        size_t as3935OnMins;            ///< Duration of the AS3935 "on" phase of the duty cycle in minutes.
+        size_t as3935OffMins;           ///< Duration of the AS3935 "off" phase of the duty cycle in minutes (0: always on).
+    };
+
+public:
+    EnergyGovernor(const Tier* pTiers, size_t pNumTiers, float pHysteresisPercent);    ///< Constructor.
+    //
+    bool updateBatteryPercentage(float pBatteryPercentage);     ///< Select the energy tier for a new battery percentage estimate.
+    void advanceTime(size_t pSecs);                             ///< Account for elapsed time.
+    //
+    size_t getTierIndex() const;                                ///< Get the index of the currently selected tier.
+    //
+    float getBeepSecs() const;                                  ///< Get the current notification beep duration.
+    bool requestBeep();                                         ///< Check if a notification beep shall be played now.
+    //
+    size_t scaleVDDMeasInterval(size_t pIntervalSecs) const;    ///< Stretch a VDD measurement interval according to the current tier.
+    //
+    bool displayUpdateAllowed() const;                          ///< Check if a display update is currently allowed.
+    void registerDisplayUpdate();                               ///< Restart the minimum display update interval.
+    //
+    bool as3935Enabled() const;                                 ///< Check if the AS3935 should currently be powered.
+
+private:
+    const Tier& tier() const;   ///< Get the currently selected tier.
+
+private:
+    const Tier *const tiers;    ///< Energy tier table.
+    const size_t numTiers;      ///< Number of entries in 'tiers'.
+    const float hysteresis;     ///< Additional percentage required to return to a higher tier.
+    //
+    size_t tierIdx;             ///< Index of the currently selected tier.
+    //
+    size_t secsSinceLastBeep;       ///< Elapsed time since the last notification beep.
+    size_t secsSinceLastDisplay;    ///< Elapsed time since the last display update.
+    size_t secsInAS3935Phase;       ///< Elapsed time in the current AS3935 duty cycle phase.
+    bool as3935On;                  ///< Current AS3935 duty cycle phase is the "on" phase.
+};
+
+#endif // ENERGYGOVERNOR_H
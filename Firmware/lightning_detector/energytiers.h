@@ -0,0 +1,49 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef ENERGYTIERS_H
+#define ENERGYTIERS_H
+
+#include "energygovernor.h"
+
+/*
+ * Energy tier table of the firmware (see EnergyGovernor).
+ *
+ * Kept separate from lightning_detector.ino so that the host simulation 'tools/test_energy_governor.cpp'
+ * checks exactly the shipped tiers.
+ */
+
+constexpr float buzzerLightBeepSecs = 0.2;      //Buzzer beep duration for lightning notification in seconds (highest energy tier)
+
+//Energy tiers for graceful degradation with decreasing battery percentage (ordered by decreasing threshold, see EnergyGovernor::Tier)
+constexpr EnergyGovernor::Tier energyTiers[] = {
+    //minBatteryPercentage, beepSecs, beepCoalesceSecs, vddMeasIntervalFactor, displayMinIntervalSecs, as3935OnMins, as3935OffMins
+    {40.,   buzzerLightBeepSecs,      0,  1,     0,   0,   0},
+    {20.,   0.15,                    10,  1,    60,   0,   0},
+    {10.,   0.1,                     30,  2,   300,   0,   0},
+    { 5.,   0.05,                    60,  3,   900,  30,  10},
+    { 0.,   0.05,                   120,  4,  1800,  20,  20}
+};
+constexpr float energyTierHysteresisPercent = 5.;   //Additional battery percentage required to return to a higher energy tier
+
+#endif // ENERGYTIERS_H
@@ -0,0 +1,80 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "eventlog.h"
+
+constexpr size_t EventLog::capacity;
+
+//
+
+/*!
+ * \brief Constructor.
+ */
+EventLog::EventLog() :
+    events(),
+    first(0),
+    count(0)
+{
+}
+
+//Public
+
+/*!
+ * \brief Add an event.
+ *
+ * Overwrites the oldest event if the log is full.
+ *
+ * \param pEvent New event.
+ */
+void EventLog::add(const Event& pEvent)
+{
+    events[(first + count) % capacity] = pEvent;
+
+    if (count < capacity)
+        ++count;
+    else
+        first = (first + 1) % capacity;
+}
+
+//
+
+/*!
+ * \brief Get the number of logged events.
+ *
+ * \return Number of logged events (at most \p capacity).
+ */
+size_t EventLog::size() const
+{
+    return count;
+}
+
+/*!
+ * \brief Get a logged event.
+ *
+ * \param pIdx Event index from 0 (oldest) to size()-1 (newest).
+ * \return Logged event number \p pIdx.
+ */
+const EventLog::Event& EventLog::get(size_t pIdx) const
+{
+    return events[(first + pIdx) % capacity];
+}
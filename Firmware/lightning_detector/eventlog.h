@@ -0,0 +1,70 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include "as3935.h"
+
+#include <Arduino.h>
+
+#include <array>
+
+/*!
+ * \brief Fixed-size in-memory log of the most recent %AS3935 events.
+ *
+ * Keeps the last \p capacity events in a ring buffer (older events are overwritten),
+ * e.g. to export them later on via the serial console.
+ */
+class EventLog
+{
+public:
+    /*!
+     * \brief Single logged %AS3935 event.
+     */
+    struct Event
+    {
+        uint32_t timeSecs;              ///< Estimated run time at the event in seconds.
+        AS3935::InterruptType type;     ///< Interrupt type.
+        uint8_t distance;               ///< Storm distance in km (AS3935::stormDistanceOutOfRange if out of range).
+        uint32_t energy;                ///< Lightning energy (raw value).
+    };
+
+public:
+    EventLog();                                 ///< Constructor.
+    //
+    void add(const Event& pEvent);              ///< Add an event.
+    //
+    size_t size() const;                        ///< Get the number of logged events.
+    const Event& get(size_t pIdx) const;        ///< Get a logged event.
+
+public:
+    static constexpr size_t capacity = 64;      ///< Maximum number of logged events.
+
+private:
+    std::array<Event, capacity> events;         ///< Ring buffer of logged events.
+    size_t first;                               ///< Index of the oldest event in 'events'.
+    size_t count;                               ///< Number of logged events.
+};
+
+#endif // EVENTLOG_H
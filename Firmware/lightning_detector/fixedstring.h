@@ -0,0 +1,263 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef FIXEDSTRING_H
+#define FIXEDSTRING_H
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/*!
+ * \brief Heap-free string with fixed capacity and number formatting.
+ *
+ * Stores up to \p N characters (plus terminating null character) in an internal array and
+ * can hence be used instead of Arduino's \p String without any dynamic memory allocation.
+ * Characters that do not fit are dropped and the string is marked as overflowed (see overflowed()).
+ *
+ * Numbers are formatted like \p String / \p Print would do (see appendUInt(), appendInt(), appendFixed()).
+ *
+ * \tparam N Maximum number of characters.
+ */
+template<size_t N>
+class FixedString
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * Creates an empty string.
+     */
+    FixedString() :
+        len(0),
+        overflow(false)
+    {
+        buffer[0] = '\0';
+    }
+    //
+    /*!
+     * \brief Get the maximum number of characters.
+     *
+     * \return \p N.
+     */
+    static constexpr size_t capacity()
+    {
+        return N;
+    }
+    /*!
+     * \brief Get the number of characters.
+     *
+     * \return String length.
+     */
+    size_t length() const
+    {
+        return len;
+    }
+    /*!
+     * \brief Get the null-terminated character array.
+     *
+     * \return Pointer to the string.
+     */
+    const char* c_str() const
+    {
+        return buffer;
+    }
+    /*!
+     * \brief Check if any character had to be dropped.
+     *
+     * \return If an append operation did not fit into the capacity since the last clear().
+     */
+    bool overflowed() const
+    {
+        return overflow;
+    }
+    //
+    /*!
+     * \brief Remove all characters.
+     *
+     * Also resets the overflow flag (see overflowed()).
+     */
+    void clear()
+    {
+        len = 0;
+        overflow = false;
+        buffer[0] = '\0';
+    }
+    /*!
+     * \brief Replace the content with a string.
+     *
+     * \param pStr Null-terminated string.
+     */
+    void assign(const char* pStr)
+    {
+        clear();
+        append(pStr);
+    }
+    //
+    /*!
+     * \brief Append a character.
+     *
+     * \param pChar The character.
+     */
+    void append(char pChar)
+    {
+        if (len >= N)
+        {
+            overflow = true;
+            return;
+        }
+
+        buffer[len++] = pChar;
+        buffer[len] = '\0';
+    }
+    /*!
+     * \brief Append a string.
+     *
+     * \param pStr Null-terminated string.
+     */
+    void append(const char* pStr)
+    {
+        size_t strLen = strlen(pStr);
+
+        if (strLen > N - len)
+        {
+            strLen = N - len;
+            overflow = true;
+        }
+
+        memcpy(&buffer[len], pStr, strLen);
+
+        len += strLen;
+        buffer[len] = '\0';
+    }
+    //
+    /*!
+     * \brief Append an unsigned integer in decimal representation.
+     *
+     * \param pValue The number.
+     * \param pWidth Minimum number of characters, padded on the left with \p pFill.
+     * \param pFill Padding character.
+     */
+    void appendUInt(uint32_t pValue, uint8_t pWidth = 0, char pFill = ' ')
+    {
+        char digits[10];
+        uint8_t numDigits = 0;
+
+        do
+        {
+            digits[numDigits++] = '0' + static_cast<char>(pValue % 10);
+            pValue /= 10;
+        }
+        while (pValue > 0);
+
+        for (uint8_t i = numDigits; i < pWidth; ++i)
+            append(pFill);
+
+        while (numDigits > 0)
+            append(digits[--numDigits]);
+    }
+    /*!
+     * \brief Append a signed integer in decimal representation.
+     *
+     * \param pValue The number.
+     */
+    void appendInt(int32_t pValue)
+    {
+        if (pValue < 0)
+        {
+            append('-');
+            appendUInt(static_cast<uint32_t>(-(pValue + 1)) + 1);
+        }
+        else
+            appendUInt(static_cast<uint32_t>(pValue));
+    }
+    /*!
+     * \brief Append a floating point number in fixed-point decimal representation.
+     *
+     * Rounds to \p pDecPlaces decimal places like \p printf("%.*f") (ties to even), which is
+     * what \p String(float, unsigned int) does. NaN and infinity are appended as "nan" and "inf".
+     * Numbers whose magnitude (times 10^\p pDecPlaces) exceeds the 32 bit range are not appended
+     * at all but the string is marked as overflowed instead (see overflowed()).
+     *
+     * \param pValue The number.
+     * \param pDecPlaces Number of decimal places (at most 9).
+     */
+    void appendFixed(float pValue, uint8_t pDecPlaces)
+    {
+        if (std::isnan(pValue))
+        {
+            append("nan");
+            return;
+        }
+
+        if (std::signbit(pValue))
+        {
+            append('-');
+            pValue = -pValue;
+        }
+
+        if (std::isinf(pValue))
+        {
+            append("inf");
+            return;
+        }
+
+        pDecPlaces = std::min<uint8_t>(pDecPlaces, 9);
+
+        uint32_t scale = 1;
+        for (uint8_t i = 0; i < pDecPlaces; ++i)
+            scale *= 10;
+
+        //Exact, since a float mantissa (24 bits) times at most 10^9 (30 bits) fits into a double mantissa (53 bits)
+        double scaled = static_cast<double>(pValue) * scale;
+
+        if (scaled >= 4294967295.0)
+        {
+            overflow = true;
+            return;
+        }
+
+        uint32_t rounded = static_cast<uint32_t>(scaled);
+        double remainder = scaled - rounded;
+
+        if ((remainder > 0.5) || ((remainder == 0.5) && (rounded % 2 == 1)))
+            ++rounded;
+
+        appendUInt(rounded / scale);
+
+        if (pDecPlaces > 0)
+        {
+            append('.');
+            appendUInt(rounded % scale, pDecPlaces, '0');
+        }
+    }
+
+private:
+    char buffer[N+1];   ///< Characters including terminating null character.
+    size_t len;         ///< Number of characters.
+    bool overflow;      ///< Characters had to be dropped.
+};
+
+#endif // FIXEDSTRING_H
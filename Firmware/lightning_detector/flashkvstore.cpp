@@ -0,0 +1,454 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "flashkvstore.h"
+
+#include "auxil.h"
+
+#include <algorithm>
+#include <cstring>
+
+constexpr size_t FlashKVStore::pageSize;
+constexpr uint32_t FlashKVStore::pageMagic;
+constexpr size_t FlashKVStore::headerWords;
+constexpr size_t FlashKVStore::maxLength;
+constexpr uint16_t FlashKVStore::removedLength;
+
+//
+
+/*!
+ * \brief Constructor.
+ *
+ * \attention The flash region must be reserved exclusively for the store (i.e. not overlap with the firmware).
+ *
+ * \param pRegionAddr Start address of the flash region (must be page-aligned).
+ * \param pNumPages Number of flash pages of the region (at least 2).
+ */
+FlashKVStore::FlashKVStore(uintptr_t pRegionAddr, size_t pNumPages) :
+    regionAddr(pRegionAddr),
+    numPages(pNumPages),
+    activePage(0),
+    activeSequence(0),
+    writeAddr(0)
+{
+}
+
+//Public
+
+/*!
+ * \brief Find the active page or initialize the region.
+ *
+ * Selects the page with a valid header and the highest sequence number as active page
+ * and determines the end of its records. If no page has a valid header (i.e. on first use),
+ * the first page is erased and initialized as empty active page.
+ */
+void FlashKVStore::setup()
+{
+    bool found = false;
+
+    for (size_t i = 0; i < numPages; ++i)
+    {
+        if (readWord(pageAddr(i) + 4) != pageMagic)
+            continue;
+
+        uint32_t sequence = readWord(pageAddr(i));
+
+        if (!found || (sequence > activeSequence))
+        {
+            found = true;
+            activePage = i;
+            activeSequence = sequence;
+        }
+    }
+
+    if (!found)
+    {
+        activePage = 0;
+        activeSequence = 0;
+
+        erasePage(pageAddr(0));
+        writeWord(pageAddr(0), activeSequence);
+        writeWord(pageAddr(0) + 4, pageMagic);
+    }
+
+    //Find end of records (corrupted record headers also end the records, the page is then considered full)
+
+    const uintptr_t pageEnd = pageAddr(activePage) + pageSize;
+
+    uintptr_t addr = pageAddr(activePage) + 4*headerWords;
+
+    while ((addr != 0) && (addr < pageEnd) && (readWord(addr) != 0xFFFFFFFF))
+        addr = nextRecord(addr);
+
+    writeAddr = (addr != 0) ? addr : pageEnd;
+}
+
+//
+
+/*!
+ * \brief Read the current value of a key.
+ *
+ * \param pKey Key to read.
+ * \param pData Destination for the value.
+ * \param pLength Expected length of the value in bytes.
+ * \return If a value with length \p pLength is stored for \p pKey (\p pData is not modified otherwise).
+ */
+bool FlashKVStore::read(uint16_t pKey, void* pData, size_t pLength) const
+{
+    uintptr_t record = findRecord(pKey);
+
+    if (record == 0)
+        return false;
+
+    uint16_t length = static_cast<uint16_t>(readWord(record) & 0xFFFF);
+
+    if ((length == removedLength) || (length != pLength))
+        return false;
+
+    std::memcpy(pData, reinterpret_cast<const void*>(record + 4), pLength);
+
+    return true;
+}
+
+/*!
+ * \brief Store a new value for a key.
+ *
+ * Appends a new record for \p pKey, if the value differs from the current one (saves erase cycles).
+ * If the active page is full, the newest records are first moved to the next page (see compact()).
+ *
+ * \note The CPU is halted during flash write/erase operations (~40us per word, ~85ms per page erase).
+ *
+ * \param pKey Key to write (0 to 0xFFFE).
+ * \param pData Value to store.
+ * \param pLength Length of \p pData in bytes (at most \p maxLength).
+ * \return If the value was stored (false for invalid arguments or if all values do not fit into a page).
+ */
+bool FlashKVStore::write(uint16_t pKey, const void* pData, size_t pLength)
+{
+    if ((pKey == 0xFFFF) || (pLength > maxLength))
+        return false;
+
+    uintptr_t record = findRecord(pKey);
+
+    if ((record != 0) && ((readWord(record) & 0xFFFF) == pLength) &&
+        (std::memcmp(reinterpret_cast<const void*>(record + 4), pData, pLength) == 0))
+    {
+        return true;
+    }
+
+    const uint8_t* data = static_cast<const uint8_t*>(pData);
+
+    if (appendRecord(pKey, data, pLength))
+        return true;
+
+    return compact() && appendRecord(pKey, data, pLength);
+}
+
+/*!
+ * \brief Remove a key.
+ *
+ * Appends a record that marks \p pKey as removed (see write()).
+ *
+ * \param pKey Key to remove.
+ * \return If the key is not stored anymore.
+ */
+bool FlashKVStore::remove(uint16_t pKey)
+{
+    uintptr_t record = findRecord(pKey);
+
+    if ((record == 0) || ((readWord(record) & 0xFFFF) == removedLength))
+        return true;
+
+    if (appendRecord(pKey, nullptr, removedLength))
+        return true;
+
+    return compact() && appendRecord(pKey, nullptr, removedLength);
+}
+
+//Private
+
+/*!
+ * \brief Find the newest valid record of a key on the active page.
+ *
+ * Records after a corrupted record header cannot be found (see nextRecord()).
+ *
+ * \param pKey Key to find.
+ * \return Address of the record or 0 if there is none.
+ */
+uintptr_t FlashKVStore::findRecord(uint16_t pKey) const
+{
+    uintptr_t found = 0;
+
+    for (uintptr_t addr = pageAddr(activePage) + 4*headerWords; (addr != 0) && (addr < writeAddr); addr = nextRecord(addr))
+        if (((readWord(addr) >> 16) == pKey) && recordValid(addr))
+            found = addr;
+
+    return found;
+}
+
+/*!
+ * \brief Get the address of the record following another record.
+ *
+ * \param pRecordAddr Address of a record.
+ * \return Address of the next record or 0 if the record's header is corrupted.
+ */
+uintptr_t FlashKVStore::nextRecord(uintptr_t pRecordAddr) const
+{
+    uint16_t length = static_cast<uint16_t>(readWord(pRecordAddr) & 0xFFFF);
+
+    if ((length != removedLength) && (length > maxLength))
+        return 0;
+
+    uintptr_t next = pRecordAddr + 4*recordWords(length);
+
+    if (next > pageAddr(activePage) + pageSize)
+        return 0;
+
+    return next;
+}
+
+/*!
+ * \brief Check if a record is complete.
+ *
+ * \param pRecordAddr Address of a record.
+ * \return If the record header is intact (see nextRecord()) and the stored CRC-32 of the record matches.
+ */
+bool FlashKVStore::recordValid(uintptr_t pRecordAddr) const
+{
+    //Check length first, as the CRC-32 location depends on it
+    if (nextRecord(pRecordAddr) == 0)
+        return false;
+
+    uint16_t length = static_cast<uint16_t>(readWord(pRecordAddr) & 0xFFFF);
+
+    return readWord(pRecordAddr + 4*(recordWords(length) - 1)) == recordCRC(pRecordAddr, length);
+}
+
+//
+
+/*!
+ * \brief Append a record to the active page.
+ *
+ * Writes the record header first (so that an incomplete record can still be skipped), then the value and the CRC-32 last.
+ *
+ * \param pKey Key of the record.
+ * \param pData Value of the record.
+ * \param pLength Length of \p pData in bytes or \p removedLength.
+ * \return If the record fits into the active page.
+ */
+bool FlashKVStore::appendRecord(uint16_t pKey, const uint8_t* pData, size_t pLength)
+{
+    const uint16_t length = static_cast<uint16_t>(pLength);
+    const size_t numWords = recordWords(length);
+
+    if (writeAddr + 4*numWords > pageAddr(activePage) + pageSize)
+        return false;
+
+    const uintptr_t record = writeAddr;
+
+    //Skip the record also if writing it gets interrupted
+    writeAddr += 4*numWords;
+
+    writeWord(record, (static_cast<uint32_t>(pKey) << 16) | length);
+
+    const size_t dataLength = (length == removedLength) ? 0 : length;
+
+    for (size_t i = 0; i < dataLength; i += 4)
+    {
+        uint32_t word = 0xFFFFFFFF;
+        std::memcpy(&word, &pData[i], std::min<size_t>(4, dataLength - i));
+        writeWord(record + 4 + i, word);
+    }
+
+    writeWord(record + 4*(numWords - 1), recordCRC(record, length));
+
+    return true;
+}
+
+/*!
+ * \brief Copy newest records to the next page and activate it.
+ *
+ * Erases the next page of the region, copies the newest valid record of each (not removed) key to it
+ * and finally writes its header with an incremented sequence number, which makes it the active page.
+ * The magic word of an old header on the next page is cleared before the erase, since an interrupted erase
+ * could otherwise leave the magic word intact while bits of the sequence number have already flipped to 1
+ * (setup() would then select the half-erased page as active page).
+ * Records after a corrupted record header are lost (see nextRecord()).
+ * The previously active page stays intact until it gets erased again in a later compaction.
+ *
+ * \return If there is a free page to move to (false if the region only has a single page).
+ */
+bool FlashKVStore::compact()
+{
+    if (numPages < 2)
+        return false;
+
+    const size_t newPage = (activePage + 1) % numPages;
+    const uintptr_t newPageAddr = pageAddr(newPage);
+
+    //Invalidate the old header first (clearing bits needs no erase; second and last write of that word before the erase)
+    if (readWord(newPageAddr + 4) == pageMagic)
+        writeWord(newPageAddr + 4, 0);
+
+    erasePage(newPageAddr);
+
+    uintptr_t dst = newPageAddr + 4*headerWords;
+
+    for (uintptr_t src = pageAddr(activePage) + 4*headerWords; (src != 0) && (src < writeAddr); src = nextRecord(src))
+    {
+        if (!recordValid(src))
+            continue;
+
+        const uint32_t header = readWord(src);
+        const uint16_t length = static_cast<uint16_t>(header & 0xFFFF);
+
+        if (length == removedLength)
+            continue;
+
+        //Skip records that are superseded by a later valid record with the same key
+
+        bool superseded = false;
+
+        for (uintptr_t later = nextRecord(src); (later != 0) && (later < writeAddr); later = nextRecord(later))
+        {
+            if (((readWord(later) >> 16) == (header >> 16)) && recordValid(later))
+            {
+                superseded = true;
+                break;
+            }
+        }
+
+        if (superseded)
+            continue;
+
+        for (size_t i = 0; i < recordWords(length); ++i)
+            writeWord(dst + 4*i, readWord(src + 4*i));
+
+        dst += 4*recordWords(length);
+    }
+
+    writeWord(newPageAddr, activeSequence + 1);
+    writeWord(newPageAddr + 4, pageMagic);
+
+    activePage = newPage;
+    activeSequence += 1;
+    writeAddr = dst;
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Get the start address of a page of the region.
+ *
+ * \param pPage Page index.
+ * \return Address of page \p pPage.
+ */
+uintptr_t FlashKVStore::pageAddr(size_t pPage) const
+{
+    return regionAddr + pPage*pageSize;
+}
+
+//
+
+/*!
+ * \brief Read a word from flash.
+ *
+ * \param pAddr Word-aligned address.
+ * \return Word at \p pAddr.
+ */
+uint32_t FlashKVStore::readWord(uintptr_t pAddr)
+{
+    return *reinterpret_cast<const volatile uint32_t*>(pAddr);
+}
+
+/*!
+ * \brief Write a word to (erased) flash.
+ *
+ * Can only clear bits of the current value (i.e. may also be used to clear a written word to 0).
+ *
+ * \param pAddr Word-aligned address.
+ * \param pValue Value to write.
+ */
+void FlashKVStore::writeWord(uintptr_t pAddr, uint32_t pValue)
+{
+    NRF_NVMC->CONFIG = NVMC_CONFIG_WEN_Wen;
+    while (NRF_NVMC->READY == 0)
+        ;
+
+    *reinterpret_cast<volatile uint32_t*>(pAddr) = pValue;
+
+    while (NRF_NVMC->READY == 0)
+        ;
+    NRF_NVMC->CONFIG = NVMC_CONFIG_WEN_Ren;
+}
+
+/*!
+ * \brief Erase a flash page.
+ *
+ * \param pAddr Page-aligned address.
+ */
+void FlashKVStore::erasePage(uintptr_t pAddr)
+{
+    NRF_NVMC->CONFIG = NVMC_CONFIG_WEN_Een;
+    while (NRF_NVMC->READY == 0)
+        ;
+
+    NRF_NVMC->ERASEPAGE = pAddr;
+
+    while (NRF_NVMC->READY == 0)
+        ;
+    NRF_NVMC->CONFIG = NVMC_CONFIG_WEN_Ren;
+}
+
+//
+
+/*!
+ * \brief Calculate the CRC-32 of a stored record.
+ *
+ * The CRC-32 covers the record header and the value (without padding).
+ *
+ * \param pRecordAddr Address of the record.
+ * \param pLength Value length in bytes or \p removedLength.
+ * \return CRC-32 of the record.
+ */
+uint32_t FlashKVStore::recordCRC(uintptr_t pRecordAddr, uint16_t pLength)
+{
+    const size_t dataLength = (pLength == removedLength) ? 0 : pLength;
+
+    return Auxil::crc32(reinterpret_cast<const uint8_t*>(pRecordAddr), 4 + dataLength);
+}
+
+/*!
+ * \brief Get the total size of a record in words.
+ *
+ * \param pLength Value length in bytes or \p removedLength.
+ * \return Number of words of header, padded value and CRC-32.
+ */
+size_t FlashKVStore::recordWords(uint16_t pLength)
+{
+    const size_t dataLength = (pLength == removedLength) ? 0 : pLength;
+
+    return 1 + (dataLength + 3) / 4 + 1;
+}
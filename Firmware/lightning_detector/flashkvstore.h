@@ -0,0 +1,94 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef FLASHKVSTORE_H
+#define FLASHKVSTORE_H
+
+#include <Arduino.h>
+
+/*!
+ * \brief Small wear-levelled key-value store in a reserved region of the internal flash.
+ *
+ * Stores short binary values (e.g. a Configuration) under 16 bit keys. The region consists of \p numPages
+ * flash pages, of which always one is the "active" page. Values are appended to the active page as records
+ * and a record supersedes all earlier records with the same key. Once the active page is full, the newest
+ * records of all keys are copied to the next page of the region (round robin, which spreads the erase cycles
+ * over all pages) and that page becomes the new active page.
+ *
+ * Page layout (all entries are 32 bit words, as the flash is written word-wise via the NVMC):
+ * - Header: {sequence number, \p pageMagic}
+ * - Records: {key (upper 16 bits) and value length in bytes (lower 16 bits), value (padded to whole words), CRC-32}
+ * - Erased words (0xFFFFFFFF) after the last record.
+ *
+ * Updates are atomic with respect to resets/power loss: a record only counts once its CRC-32 (written last) matches,
+ * and a new page only becomes active once its header (written after all copied records, magic word last) is complete.
+ * Before a page is erased for reuse, the magic word of its old header is cleared (see compact()).
+ * The active page is the one with a valid header and the highest sequence number.
+ *
+ * \attention You must call setup() before using the class.
+ */
+class FlashKVStore
+{
+public:
+    FlashKVStore(uintptr_t pRegionAddr, size_t pNumPages);  ///< Constructor.
+    //
+    void setup();                                                   ///< Find the active page or initialize the region.
+    //
+    bool read(uint16_t pKey, void* pData, size_t pLength) const;    ///< Read the current value of a key.
+    bool write(uint16_t pKey, const void* pData, size_t pLength);   ///< Store a new value for a key.
+    bool remove(uint16_t pKey);                                     ///< Remove a key.
+
+private:
+    uintptr_t findRecord(uint16_t pKey) const;                      ///< Find the newest valid record of a key on the active page.
+    uintptr_t nextRecord(uintptr_t pRecordAddr) const;              ///< Get the address of the record following another record.
+    bool recordValid(uintptr_t pRecordAddr) const;                  ///< Check if a record is complete.
+    //
+    bool appendRecord(uint16_t pKey, const uint8_t* pData, size_t pLength);     ///< Append a record to the active page.
+    bool compact();                                                 ///< Copy newest records to the next page and activate it.
+    //
+    uintptr_t pageAddr(size_t pPage) const;                         ///< Get the start address of a page of the region.
+    //
+    static uint32_t readWord(uintptr_t pAddr);                      ///< Read a word from flash.
+    static void writeWord(uintptr_t pAddr, uint32_t pValue);        ///< Write a word to (erased) flash.
+    static void erasePage(uintptr_t pAddr);                         ///< Erase a flash page.
+    //
+    static uint32_t recordCRC(uintptr_t pRecordAddr, uint16_t pLength);         ///< Calculate the CRC-32 of a stored record.
+    static size_t recordWords(uint16_t pLength);                                ///< Get the total size of a record in words.
+
+private:
+    const uintptr_t regionAddr;     ///< Start address of the flash region.
+    const size_t numPages;          ///< Number of flash pages of the region.
+    //
+    size_t activePage;              ///< Index of the active page.
+    uint32_t activeSequence;        ///< Sequence number of the active page.
+    uintptr_t writeAddr;            ///< Address for the next record on the active page.
+
+public:
+    static constexpr size_t pageSize = 4096;            ///< Flash page size of the nRF52840.
+    static constexpr uint32_t pageMagic = 0x4C444B56;   ///< Marks a page header as complete ("LDKV").
+    static constexpr size_t headerWords = 2;            ///< Size of a page header in words.
+    static constexpr size_t maxLength = pageSize - 4*headerWords - 2*4;     ///< Maximum value length in bytes.
+    static constexpr uint16_t removedLength = 0xFFFF;   ///< Value length of a record that removes its key.
+};
+
+#endif // FLASHKVSTORE_H
@@ -28,22 +28,166 @@
 
 #include <Arduino.h>
 
+#include <cstring>
+
 /*!
  * \brief ASCII font object for use with ArduinoGraphics.
  *
- * Consists of an array of monospaced, monochrome font character bitmaps.
+ * Consists of packed, monospaced, monochrome font character bitmaps for the character codes
+ * \p firstChar to \p lastChar (ISO 8859-1), as generated by 'tools/bdf2font.cpp'.
+ *
+ * For each character code, \p index holds the offset of the glyph in \p bitmaps (or \p noGlyph if the font has
+ * no glyph for that character). A glyph consists of its first non-blank row, the number of non-blank rows and those
+ * rows with \p width bits each, contiguously packed without padding (the leftmost pixel of the first row being the
+ * MSB of the first byte) and padded to whole bytes only at the end of the glyph. \p bitmaps ends with three padding
+ * bytes such that a row can always be read as a whole 32 bit word. Use GlyphReader or decodeGlyph() to unpack a glyph.
  *
- * The font width is limited to maximally 16 pixels.
+ * The font width is limited to maximally 16 pixels and the font height to maximally \p maxHeight pixels.
+ *
+ * A bold variant of a font can be synthesized at render time by setting \p bold for the same glyph data, in which case
+ * each row is ORed with itself shifted right by one pixel (see GlyphReader::next()). For Terminus this matches
+ * the actual bold weight for most ASCII glyphs, so separate bold glyph data is not needed.
  */
 struct Font
 {
-    const size_t width;     ///< %Font width in pixels.
-    const size_t height;    ///< %Font height in pixels.
-    const uint16_t** data;  ///< \brief %Font data as array of bitmaps.
-                            ///  \details Each bitmap is an array of whole lines
-                            ///  with each line being represented by a \p uint16_t.
-                            ///  The MSB corresponds to the leftmost pixel of a line.
-                            ///  Line index 0 corresponds to the topmost line.
+    static constexpr uint16_t noGlyph = 0xFFFF;     ///< Index entry for characters without glyph.
+    static constexpr size_t maxHeight = 32;         ///< Maximum supported font height.
+    //
+    const size_t width;         ///< %Font width in pixels.
+    const size_t height;        ///< %Font height in pixels.
+    const uint8_t firstChar;    ///< Character code of the first \p index entry.
+    const uint8_t lastChar;     ///< Character code of the last \p index entry.
+    const uint16_t* index;      ///< Glyph offsets in \p bitmaps for the characters \p firstChar to \p lastChar.
+    const uint8_t* bitmaps;     ///< Packed glyph data.
+    const bool bold;            ///< Synthesize bold glyphs from \p bitmaps.
+    //
+    /*!
+     * \brief Sequential reader for the non-blank rows of a packed glyph.
+     *
+     * Returns the non-blank rows (see firstRow(), endRow()) one after the other, with the leftmost pixel in the MSB.
+     * All other rows of the character cell are blank.
+     */
+    class GlyphReader
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * Starts reading at firstRow().
+         *
+         * \param pFont %Font of the glyph.
+         * \param pGlyph Glyph data (see glyph()).
+         */
+        GlyphReader(const Font& pFont, const uint8_t* pGlyph) :
+            width(pFont.width),
+            rowMask(static_cast<uint16_t>(0xFFFF << (16 - pFont.width))),
+            boldMask(pFont.bold ? rowMask : 0),
+            top(pGlyph[0]),
+            end(pGlyph[0] + pGlyph[1]),
+            bits(&pGlyph[2]),
+            bitPos(0)
+        {
+        }
+        //
+        /*!
+         * \brief Get the first non-blank row.
+         *
+         * \return Row index within the character cell.
+         */
+        int firstRow() const
+        {
+            return top;
+        }
+        /*!
+         * \brief Get the row after the last non-blank row.
+         *
+         * \return Row index within the character cell (equals firstRow() for a blank glyph).
+         */
+        int endRow() const
+        {
+            return end;
+        }
+        //
+        /*!
+         * \brief Continue reading at a different row.
+         *
+         * \param pRow Next row to read (firstRow() to endRow() - 1).
+         */
+        void seek(int pRow)
+        {
+            bitPos = static_cast<unsigned int>((pRow - top) * width);
+        }
+        /*!
+         * \brief Get the next row.
+         *
+         * Must not be called more often than there are remaining non-blank rows.
+         * For a synthesized bold font (see Font::bold) the row is already emboldened.
+         *
+         * \return Row bits with the leftmost pixel in the MSB.
+         */
+        uint16_t next()
+        {
+            //Row is contained in (at most) three bytes; reading four bytes (compiles to a single load with byte swap)
+            //beyond the glyph is safe due to the padding of Font::bitmaps
+            const uint8_t* rowBytes = &bits[bitPos / 8];
+            const uint32_t word = (static_cast<uint32_t>(rowBytes[0]) << 24) | (static_cast<uint32_t>(rowBytes[1]) << 16) |
+                                  (static_cast<uint32_t>(rowBytes[2]) << 8) | static_cast<uint32_t>(rowBytes[3]);
+
+            const uint16_t rowBits = static_cast<uint16_t>((word << (bitPos % 8)) >> 16) & rowMask;
+
+            bitPos += width;
+
+            return rowBits | ((rowBits >> 1) & boldMask);
+        }
+
+    private:
+        const unsigned int width;   ///< %Font width.
+        const uint16_t rowMask;     ///< Mask for the \p width leftmost bits of a row.
+        const uint16_t boldMask;    ///< Mask for emboldening a row (equals \p rowMask for synthesized bold and zero else).
+        const int top;              ///< First non-blank row.
+        const int end;              ///< Row after the last non-blank row.
+        const uint8_t* bits;        ///< Packed rows.
+        unsigned int bitPos;        ///< Bit offset of the next row in \p bits.
+    };
+    //
+    /*!
+     * \brief Get the packed glyph data of a character.
+     *
+     * \param pChar Character code.
+     * \return Glyph data for use with GlyphReader or \p nullptr if the font has no glyph for \p pChar.
+     */
+    const uint8_t* glyph(uint8_t pChar) const
+    {
+        if ((pChar < firstChar) || (pChar > lastChar) || (index[pChar - firstChar] == noGlyph))
+            return nullptr;
+
+        return &bitmaps[index[pChar - firstChar]];
+    }
+    /*!
+     * \brief Unpack the bitmap of a character's glyph.
+     *
+     * Writes \p height rows with the leftmost pixel of each row in the MSB to \p pRows (see GlyphReader).
+     *
+     * \param pChar Character code.
+     * \param pRows Destination array for \p height rows.
+     * \return If the font has a glyph for \p pChar (\p pRows is not modified otherwise).
+     */
+    bool decodeGlyph(uint8_t pChar, uint16_t* pRows) const
+    {
+        const uint8_t* glyphData = glyph(pChar);
+
+        if (glyphData == nullptr)
+            return false;
+
+        GlyphReader reader(*this, glyphData);
+
+        memset(pRows, 0, height*sizeof(uint16_t));
+
+        for (int j = reader.firstRow(); j < reader.endRow(); ++j)
+            pRows[j] = reader.next();
+
+        return true;
+    }
 };
 
 #endif // FONT_H
@@ -23,9 +23,51 @@
 
 #include "fonts.h"
 
+#include "fonts/font_terminascii24status.cpp"
+
+#ifdef FONTS_INCLUDE_ALL
 #include "fonts/font_terminascii24.cpp"
-#include "fonts/font_terminascii24bold.cpp"
 #include "fonts/font_terminascii28.cpp"
-#include "fonts/font_terminascii28bold.cpp"
 #include "fonts/font_terminascii32.cpp"
-#include "fonts/font_terminascii32bold.cpp"
+
+//Bold fonts are synthesized from the glyph data of the medium weight fonts (see Font::bold)
+
+/*!
+ * \brief "Terminus Font", size 12x24, synthesized bold weight (see Font_TerminASCII24).
+ */
+const struct Font Font_TerminASCII24Bold = {
+    12,
+    24,
+    0x00,
+    0xFE,
+    Font_TerminASCII24_Index,
+    Font_TerminASCII24_Bitmaps,
+    true
+};
+
+/*!
+ * \brief "Terminus Font", size 14x28, synthesized bold weight (see Font_TerminASCII28).
+ */
+const struct Font Font_TerminASCII28Bold = {
+    14,
+    28,
+    0x00,
+    0xFE,
+    Font_TerminASCII28_Index,
+    Font_TerminASCII28_Bitmaps,
+    true
+};
+
+/*!
+ * \brief "Terminus Font", size 16x32, synthesized bold weight (see Font_TerminASCII32).
+ */
+const struct Font Font_TerminASCII32Bold = {
+    16,
+    32,
+    0x00,
+    0xFE,
+    Font_TerminASCII32_Index,
+    Font_TerminASCII32_Bitmaps,
+    true
+};
+#endif
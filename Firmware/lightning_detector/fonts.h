@@ -23,9 +23,17 @@
 
 #include "font.h"
 
+//Font subsets that contain only the characters actually drawn by the firmware (see StatusScreenLayout::fieldCharacters)
+
+extern const struct Font Font_TerminASCII24Status;
+
+//Full fonts (only built if FONTS_INCLUDE_ALL is defined, e.g. for the host tools, to not waste flash on unused glyphs)
+
+#ifdef FONTS_INCLUDE_ALL
 extern const struct Font Font_TerminASCII24;
 extern const struct Font Font_TerminASCII24Bold;
 extern const struct Font Font_TerminASCII28;
 extern const struct Font Font_TerminASCII28Bold;
 extern const struct Font Font_TerminASCII32;
 extern const struct Font Font_TerminASCII32Bold;
+#endif
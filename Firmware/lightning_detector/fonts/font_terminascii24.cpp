@@ -22,7 +22,7 @@
 //
 //  This file is additionally licensed under the SIL Open Font License, Version 1.1,
 //  because it embeds a subset of the Terminus Font, Version 4.49.1, as converted from
-//  the original font file for size 12x24 (medium weight) using the ArduinoGraphics library.
+//  the original font file for size 12x24 (medium weight) using 'tools/bdf2font.cpp'.
 //
 //  The Terminus Font Software itself is licensed under the SIL Open Font License, Version 1.1.
 //
@@ -35,5425 +35,425 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////
 */
 
+//
+//  Generated by 'tools/bdf2font.cpp'. Do not edit.
+//
+
+static const uint16_t Font_TerminASCII24_Index[] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0019, 0x001B, 0x0034, 0x003E, 0x0057, 0x0073, 0x008A, 0x00A3, 0x00AD, 0x00C6, 0x00DF, 0x00EF, 0x00FF, 0x0109, 0x010D, 0x0114,
+    0x012B, 0x0144, 0x015D, 0x0176, 0x018F, 0x01A8, 0x01C1, 0x01DA, 0x01F3, 0x020C, 0x0225, 0x0236, 0x024A, 0x0263, 0x026E, 0x0287,
+    0x02A0, 0x02B9, 0x02D2, 0x02EB, 0x0304, 0x031D, 0x0336, 0x034F, 0x0368, 0x0381, 0x039A, 0x03B3, 0x03CC, 0x03E5, 0x03FE, 0x0417,
+    0x0430, 0x0449, 0x0465, 0x047E, 0x0497, 0x04B0, 0x04C9, 0x04E2, 0x04FB, 0x0514, 0x052D, 0x0546, 0x055F, 0x0576, 0x058F, 0x0599,
+    0x059D, 0x05A4, 0x05B7, 0x05D0, 0x05E3, 0x05FC, 0x060F, 0x0628, 0x0641, 0x065A, 0x0673, 0x0692, 0x06AB, 0x06C4, 0x06D7, 0x06EA,
+    0x06FD, 0x0716, 0x072F, 0x0742, 0x0755, 0x076E, 0x0781, 0x0794, 0x07A7, 0x07BA, 0x07D3, 0x07E6, 0x07FF, 0x0818, 0x0831, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0839, 0x083B, 0x0854, 0x086D, 0x0886, 0x089A, 0x08B3, 0x08CC, 0x08E6, 0x08ED, 0x0901, 0x0914, 0x0927, 0x0932, 0x0936, 0x094A,
+    0x094E, 0x0959, 0x096D, 0x097D, 0x098D, 0x0994, 0x09AD, 0x09C6, 0x09CD, 0x09D5, 0x09E5, 0x09F8, 0x0A0B, 0x0A27, 0x0A43, 0x0A5F,
+    0x0A78, 0x0A97, 0x0AB6, 0x0AD5, 0x0AF4, 0x0B13, 0x0B32, 0x0B4B, 0x0B6A, 0x0B89, 0x0BA8, 0x0BC7, 0x0BE6, 0x0C05, 0x0C24, 0x0C43,
+    0x0C62, 0x0C7B, 0x0C9A, 0x0CB9, 0x0CD8, 0x0CF7, 0x0D16, 0x0D35, 0x0D45, 0x0D5E, 0x0D7D, 0x0D9C, 0x0DBB, 0x0DDA, 0x0DF9, 0x0E12,
+    0x0E2B, 0x0E44, 0x0E5D, 0x0E76, 0x0E8F, 0x0EA8, 0x0EC1, 0x0ED4, 0x0EED, 0x0F06, 0x0F1F, 0x0F38, 0x0F51, 0x0F6A, 0x0F83, 0x0F9C,
+    0x0FB5, 0x0FCE, 0x0FE7, 0x1000, 0x1019, 0x1032, 0x104B, 0x1064, 0x1077, 0x108A, 0x10A3, 0x10BC, 0x10D5, 0x10EE, 0x110D,
+};
+
+static const uint8_t Font_TerminASCII24_Bitmaps[] = {
+    // 0x00 char0
+    4,15, 0x71,0xC4,0x04,0x40,0x44,0x04,0x00,0x00,0x00,0x40,0x44,0x04,0x40,0x40,0x00,0x00,0x04,0x04,0x40,0x44,0x04,0x71,0xC0,
+    // 0x20 space
+    0,0,
+    // 0x21 exclam
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x00,0x00,0x00,0x04,0x00,0x40,0x04,0x00,
+    // 0x22 quotedbl
+    2,5, 0x11,0x01,0x10,0x11,0x01,0x10,0x11,0x00,
+    // 0x23 numbersign
+    4,15, 0x11,0x01,0x10,0x11,0x01,0x10,0x7F,0xC1,0x10,0x11,0x01,0x10,0x11,0x01,0x10,0x7F,0xC1,0x10,0x11,0x01,0x10,0x11,0x00,
+    // 0x24 dollar
+    3,17, 0x04,0x00,0x40,0x1F,0x02,0x48,0x44,0x44,0x40,0x44,0x02,0x40,0x1F,0x00,0x48,0x04,0x40,0x44,0x44,0x42,0x48,0x1F,0x00,0x40,0x04,0x00,
+    // 0x25 percent
+    5,14, 0x30,0x84,0x88,0x49,0x03,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x08,0x00,0x80,0x11,0x81,0x24,0x22,0x42,0x18,
+    // 0x26 ampersand
+    4,15, 0x1E,0x02,0x10,0x21,0x02,0x10,0x21,0x01,0x20,0x0C,0x01,0x40,0x22,0x44,0x14,0x40,0x84,0x08,0x40,0x82,0x14,0x1E,0x40,
+    // 0x27 quotesingle
+    2,5, 0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x28 parenleft
+    4,15, 0x01,0x00,0x20,0x04,0x00,0x40,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x40,0x04,0x00,0x20,0x01,0x00,
+    // 0x29 parenright
+    4,15, 0x08,0x00,0x40,0x02,0x00,0x20,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x20,0x02,0x00,0x40,0x08,0x00,
+    // 0x2A asterisk
+    7,9, 0x20,0x81,0x10,0x0A,0x00,0x40,0x7F,0xC0,0x40,0x0A,0x01,0x10,0x20,0x80,
+    // 0x2B plus
+    7,9, 0x04,0x00,0x40,0x04,0x00,0x40,0x7F,0xC0,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x2C comma
+    15,5, 0x04,0x00,0x40,0x04,0x00,0x40,0x08,0x00,
+    // 0x2D hyphen
+    11,1, 0x7F,0xC0,
+    // 0x2E period
+    16,3, 0x04,0x00,0x40,0x04,0x00,
+    // 0x2F slash
+    5,14, 0x00,0x80,0x08,0x01,0x00,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x08,0x00,0x80,0x10,0x01,0x00,0x20,0x02,0x00,
+    // 0x30 zero
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0xC4,0x14,0x42,0x44,0x44,0x48,0x45,0x04,0x60,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x31 one
+    4,15, 0x04,0x00,0xC0,0x14,0x02,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x3F,0x80,
+    // 0x32 two
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x40,0x04,0x00,0x80,0x10,0x02,0x00,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x7F,0xC0,
+    // 0x33 three
+    4,15, 0x1F,0x02,0x08,0x40,0x40,0x04,0x00,0x40,0x04,0x00,0x80,0xF0,0x00,0x80,0x04,0x00,0x40,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x34 four
+    4,15, 0x00,0x40,0x0C,0x01,0x40,0x24,0x04,0x40,0x84,0x10,0x42,0x04,0x40,0x44,0x04,0x40,0x47,0xFC,0x00,0x40,0x04,0x00,0x40,
+    // 0x35 five
+    4,15, 0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x00,0x08,0x00,0x40,0x04,0x00,0x40,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x36 six
+    4,15, 0x1F,0x82,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x37 seven
+    4,15, 0x7F,0xC4,0x04,0x40,0x40,0x04,0x00,0x80,0x08,0x01,0x00,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x38 eight
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x20,0x81,0xF0,0x20,0x84,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x39 nine
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,0x04,0x00,0x40,0x04,0x00,0x40,0x08,0x3F,0x00,
+    // 0x3A colon
+    8,10, 0x04,0x00,0x40,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x40,
+    // 0x3B semicolon
+    8,12, 0x04,0x00,0x40,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x80,
+    // 0x3C less
+    4,15, 0x00,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x80,0x10,0x02,0x00,0x10,0x00,0x80,0x04,0x00,0x20,0x01,0x00,0x08,0x00,0x40,
+    // 0x3D equal
+    9,6, 0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,
+    // 0x3E greater
+    4,15, 0x20,0x01,0x00,0x08,0x00,0x40,0x02,0x00,0x10,0x00,0x80,0x04,0x00,0x80,0x10,0x02,0x00,0x40,0x08,0x01,0x00,0x20,0x00,
+    // 0x3F question
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x40,0x00,0x00,0x00,0x04,0x00,0x40,0x04,0x00,
+    // 0x40 at
+    4,15, 0x1F,0x82,0x04,0x40,0x24,0x3E,0x44,0x24,0x82,0x48,0x24,0x82,0x48,0x24,0x82,0x44,0x64,0x3A,0x40,0x02,0x00,0x1F,0xE0,
+    // 0x41 A
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x42 B
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x00,
+    // 0x43 C
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x44 D
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x00,
+    // 0x45 E
+    4,15, 0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0x46 F
+    4,15, 0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x00,
+    // 0x47 G
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x04,0x00,0x40,0x04,0x7C,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x48 H
+    4,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x47,0xFC,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x49 I
+    4,15, 0x1F,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0x4A J
+    4,15, 0x03,0xE0,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x40,0x84,0x08,0x40,0x82,0x10,0x1E,0x00,
+    // 0x4B K
+    4,15, 0x40,0x44,0x08,0x41,0x04,0x20,0x44,0x04,0x80,0x50,0x06,0x00,0x50,0x04,0x80,0x44,0x04,0x20,0x41,0x04,0x08,0x40,0x40,
+    // 0x4C L
+    4,15, 0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0x4D M
+    4,15, 0x40,0x26,0x06,0x50,0xA5,0x0A,0x49,0x24,0x62,0x46,0x24,0x02,0x40,0x24,0x02,0x40,0x24,0x02,0x40,0x24,0x02,0x40,0x20,
+    // 0x4E N
+    4,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x60,0x45,0x04,0x48,0x44,0x44,0x42,0x44,0x14,0x40,0xC4,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x4F O
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x50 P
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x87,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x00,
+    // 0x51 Q
+    4,17, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x44,0x42,0x28,0x1F,0x00,0x08,0x00,0x40,
+    // 0x52 R
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x87,0xF0,0x50,0x04,0x80,0x44,0x04,0x20,0x41,0x04,0x08,0x40,0x40,
+    // 0x53 S
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x00,0x40,0x04,0x00,0x20,0x01,0xF0,0x00,0x80,0x04,0x00,0x40,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x54 T
+    4,15, 0x7F,0xC0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x55 U
+    4,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x56 V
+    4,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x20,0x82,0x08,0x20,0x81,0x10,0x11,0x01,0x10,0x0A,0x00,0xA0,0x0A,0x00,0x40,0x04,0x00,
+    // 0x57 W
+    4,15, 0x40,0x24,0x02,0x40,0x24,0x02,0x40,0x24,0x02,0x40,0x24,0x02,0x46,0x24,0x62,0x49,0x25,0x0A,0x50,0xA6,0x06,0x40,0x20,
+    // 0x58 X
+    4,15, 0x40,0x44,0x04,0x20,0x82,0x08,0x11,0x01,0x10,0x0A,0x00,0x40,0x0A,0x01,0x10,0x11,0x02,0x08,0x20,0x84,0x04,0x40,0x40,
+    // 0x59 Y
+    4,15, 0x40,0x44,0x04,0x20,0x82,0x08,0x11,0x01,0x10,0x0A,0x00,0xA0,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x5A Z
+    4,15, 0x7F,0xC0,0x04,0x00,0x40,0x04,0x00,0x80,0x10,0x02,0x00,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0x5B bracketleft
+    4,15, 0x0F,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x0F,0x00,
+    // 0x5C backslash
+    5,14, 0x20,0x02,0x00,0x10,0x01,0x00,0x08,0x00,0x80,0x04,0x00,0x40,0x02,0x00,0x20,0x01,0x00,0x10,0x00,0x80,0x08,
+    // 0x5D bracketright
+    4,15, 0x0F,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x01,0x00,0x10,0x0F,0x00,
+    // 0x5E asciicircum
+    2,5, 0x04,0x00,0xA0,0x11,0x02,0x08,0x40,0x40,
+    // 0x5F underscore
+    20,1, 0x7F,0xC0,
+    // 0x60 grave
+    1,3, 0x10,0x00,0x80,0x04,0x00,
+    // 0x61 a
+    8,11, 0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0x62 b
+    4,15, 0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x00,
+    // 0x63 c
+    8,11, 0x1F,0x02,0x08,0x40,0x44,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x42,0x08,0x1F,0x00,
+    // 0x64 d
+    4,15, 0x00,0x40,0x04,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0x65 e
+    8,11, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x47,0xFC,0x40,0x04,0x00,0x40,0x02,0x04,0x1F,0x80,
+    // 0x66 f
+    4,15, 0x03,0xC0,0x40,0x04,0x00,0x40,0x3F,0x80,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x67 g
+    8,15, 0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x0C,0x1F,0x40,0x04,0x00,0x40,0x08,0x3F,0x00,
+    // 0x68 h
+    4,15, 0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x69 i
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x00,0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0x6A j
+    4,19, 0x00,0x80,0x08,0x00,0x80,0x00,0x03,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x80,0x08,0x00,0x82,0x08,0x20,0x81,0x10,0x0E,0x00,
+    // 0x6B k
+    4,15, 0x20,0x02,0x00,0x20,0x02,0x00,0x20,0x42,0x08,0x21,0x02,0x20,0x24,0x03,0x80,0x24,0x02,0x20,0x21,0x02,0x08,0x20,0x40,
+    // 0x6C l
+    4,15, 0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0x6D m
+    8,11, 0x7F,0x04,0x48,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x40,
+    // 0x6E n
+    8,11, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x6F o
+    8,11, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x70 p
+    8,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x04,0x00,0x40,0x04,0x00,0x40,0x00,
+    // 0x71 q
+    8,15, 0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,0x04,0x00,0x40,0x04,0x00,0x40,
+    // 0x72 r
+    8,11, 0x47,0xC4,0x80,0x50,0x06,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x00,
+    // 0x73 s
+    8,11, 0x3F,0x84,0x04,0x40,0x04,0x00,0x40,0x03,0xF8,0x00,0x40,0x04,0x00,0x44,0x04,0x3F,0x80,
+    // 0x74 t
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x40,0x3F,0x80,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x03,0xC0,
+    // 0x75 u
+    8,11, 0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0x76 v
+    8,11, 0x40,0x44,0x04,0x40,0x42,0x08,0x20,0x81,0x10,0x11,0x00,0xA0,0x0A,0x00,0x40,0x04,0x00,
+    // 0x77 w
+    8,11, 0x40,0x44,0x04,0x40,0x44,0x04,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x3F,0x80,
+    // 0x78 x
+    8,11, 0x40,0x44,0x04,0x20,0x81,0x10,0x0A,0x00,0x40,0x0A,0x01,0x10,0x20,0x84,0x04,0x40,0x40,
+    // 0x79 y
+    8,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x0C,0x1F,0x40,0x04,0x00,0x40,0x08,0x3F,0x00,
+    // 0x7A z
+    8,11, 0x7F,0xC0,0x04,0x00,0x80,0x10,0x02,0x00,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x7F,0xC0,
+    // 0x7B braceleft
+    4,15, 0x01,0x80,0x20,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x01,0x80,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x20,0x01,0x80,
+    // 0x7C bar
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x7D braceright
+    4,15, 0x18,0x00,0x40,0x02,0x00,0x20,0x02,0x00,0x20,0x02,0x00,0x18,0x02,0x00,0x20,0x02,0x00,0x20,0x02,0x00,0x40,0x18,0x00,
+    // 0x7E asciitilde
+    2,4, 0x38,0x44,0x44,0x44,0x44,0x38,
+    // 0xA0 nbspace
+    0,0,
+    // 0xA1 exclamdown
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0xA2 cent
+    6,15, 0x04,0x00,0x40,0x1F,0x02,0x48,0x44,0x44,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x42,0x48,0x1F,0x00,0x40,0x04,0x00,
+    // 0xA3 sterling
+    4,15, 0x0E,0x01,0x10,0x20,0x82,0x00,0x20,0x02,0x00,0x20,0x07,0xE0,0x20,0x02,0x00,0x20,0x02,0x00,0x20,0x42,0x04,0x7F,0xC0,
+    // 0xA4 currency
+    6,12, 0x40,0x22,0x04,0x1F,0x82,0x04,0x20,0x42,0x04,0x20,0x42,0x04,0x20,0x41,0xF8,0x20,0x44,0x02,
+    // 0xA5 yen
+    4,15, 0x40,0x44,0x04,0x20,0x82,0x08,0x11,0x01,0x10,0x0A,0x00,0x40,0x04,0x03,0xF8,0x04,0x00,0x40,0x3F,0x80,0x40,0x04,0x00,
+    // 0xA6 brokenbar
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0xA7 section
+    3,16, 0x0F,0x01,0x08,0x10,0x01,0x00,0x0E,0x01,0x10,0x10,0x81,0x08,0x10,0x81,0x08,0x08,0x80,0x70,0x00,0x80,0x08,0x10,0x80,0xF0,
+    // 0xA8 dieresis
+    0,3, 0x11,0x01,0x10,0x11,0x00,
+    // 0xA9 copyright
+    6,12, 0x1F,0x82,0x04,0x4F,0x25,0x0A,0x50,0xA5,0x02,0x50,0x25,0x0A,0x50,0xA4,0xF2,0x20,0x41,0xF8,
+    // 0xAA ordfeminine
+    1,11, 0x1F,0x80,0x04,0x00,0x41,0xFC,0x20,0x42,0x04,0x20,0x42,0x04,0x1F,0xC0,0x00,0x3F,0xC0,
+    // 0xAB guillemotleft
+    8,11, 0x02,0x20,0x44,0x08,0x81,0x10,0x22,0x04,0x40,0x22,0x01,0x10,0x08,0x80,0x44,0x02,0x20,
+    // 0xAC logicalnot
+    9,6, 0x7F,0xC0,0x04,0x00,0x40,0x04,0x00,0x40,0x04,
+    // 0xAD softhyphen
+    11,1, 0x3F,0x80,
+    // 0xAE registered
+    6,12, 0x1F,0x82,0x04,0x5F,0x25,0x0A,0x50,0xA5,0x0A,0x5F,0x25,0x22,0x51,0x25,0x0A,0x20,0x41,0xF8,
+    // 0xAF macron
+    1,1, 0x3F,0x80,
+    // 0xB0 degree
+    2,6, 0x0F,0x01,0x08,0x10,0x81,0x08,0x10,0x80,0xF0,
+    // 0xB1 plusminus
+    7,12, 0x04,0x00,0x40,0x04,0x00,0x40,0x7F,0xC0,0x40,0x04,0x00,0x40,0x04,0x00,0x00,0x00,0x07,0xFC,
+    // 0xB2 twosuperior
+    2,9, 0x0F,0x01,0x08,0x10,0x80,0x08,0x01,0x00,0x20,0x04,0x00,0x80,0x1F,0x80,
+    // 0xB3 threesuperior
+    2,9, 0x0F,0x01,0x08,0x00,0x80,0x08,0x07,0x00,0x08,0x00,0x81,0x08,0x0F,0x00,
+    // 0xB4 acute
+    0,3, 0x01,0x00,0x20,0x04,0x00,
+    // 0xB5 mu
+    8,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0xC4,0x14,0x7E,0x44,0x00,0x40,0x04,0x00,0x40,0x00,
+    // 0xB6 paragraph
+    4,15, 0x3F,0xC4,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x43,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,
+    // 0xB7 periodcentered
+    10,3, 0x04,0x00,0x40,0x04,0x00,
+    // 0xB8 cedilla
+    19,4, 0x04,0x00,0x40,0x04,0x00,0x80,
+    // 0xB9 onesuperior
+    2,9, 0x04,0x00,0xC0,0x14,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xBA ordmasculine
+    1,11, 0x0F,0x01,0x08,0x20,0x42,0x04,0x20,0x42,0x04,0x20,0x41,0x08,0x0F,0x00,0x00,0x3F,0xC0,
+    // 0xBB guillemotright
+    8,11, 0x44,0x02,0x20,0x11,0x00,0x88,0x04,0x40,0x22,0x04,0x40,0x88,0x11,0x02,0x20,0x44,0x00,
+    // 0xBC onequarter
+    3,17, 0x08,0x01,0x80,0x28,0x00,0x80,0x08,0x40,0x88,0x09,0x00,0x20,0x04,0x00,0x88,0x11,0x82,0x28,0x44,0x80,0x88,0x0F,0x80,0x08,0x00,0x80,
+    // 0xBD onehalf
+    3,17, 0x08,0x01,0x80,0x28,0x00,0x80,0x08,0x40,0x88,0x09,0x00,0x20,0x04,0x00,0x80,0x13,0x82,0x44,0x44,0x40,0x08,0x01,0x00,0x20,0x07,0xC0,
+    // 0xBE threequarters
+    3,17, 0x1C,0x02,0x20,0x02,0x00,0xC0,0x02,0x02,0x24,0x1C,0x80,0x10,0x02,0x00,0x48,0x09,0x81,0x28,0x24,0x84,0x88,0x0F,0x80,0x08,0x00,0x80,
+    // 0xBF questiondown
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x80,0x10,0x02,0x00,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xC0 Agrave
+    0,19, 0x10,0x00,0x80,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xC1 Aacute
+    0,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xC2 Acircumflex
+    0,19, 0x04,0x00,0xA0,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xC3 Atilde
+    0,19, 0x18,0x82,0x48,0x23,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xC4 Adieresis
+    0,19, 0x11,0x01,0x10,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xC5 Aring
+    0,19, 0x0E,0x01,0x10,0x11,0x00,0xE0,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x7F,0xC4,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xC6 AE
+    4,15, 0x3F,0xE4,0x40,0x84,0x08,0x40,0x84,0x08,0x40,0x84,0x0F,0xFC,0x84,0x08,0x40,0x84,0x08,0x40,0x84,0x08,0x40,0x87,0xE0,
+    // 0xC7 Ccedilla
+    4,19, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x04,0x40,0x42,0x08,0x1F,0x00,0x40,0x04,0x00,0x40,0x08,0x00,
+    // 0xC8 Egrave
+    0,19, 0x10,0x00,0x80,0x04,0x00,0x00,0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0xC9 Eacute
+    0,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0xCA Ecircumflex
+    0,19, 0x04,0x00,0xA0,0x11,0x00,0x00,0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0xCB Edieresis
+    0,19, 0x11,0x01,0x10,0x11,0x00,0x00,0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0xCC Igrave
+    0,19, 0x10,0x00,0x80,0x04,0x00,0x00,0x1F,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xCD Iacute
+    0,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x1F,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xCE Icircumflex
+    0,19, 0x04,0x00,0xA0,0x11,0x00,0x00,0x1F,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xCF Idieresis
+    0,19, 0x11,0x01,0x10,0x11,0x00,0x00,0x1F,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xD0 Eth
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x4F,0xC4,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x00,
+    // 0xD1 Ntilde
+    0,19, 0x18,0x82,0x48,0x23,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x60,0x45,0x04,0x48,0x44,0x44,0x42,0x44,0x14,0x40,0xC4,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xD2 Ograve
+    0,19, 0x10,0x00,0x80,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xD3 Oacute
+    0,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xD4 Ocircumflex
+    0,19, 0x04,0x00,0xA0,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xD5 Otilde
+    0,19, 0x18,0x82,0x48,0x23,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xD6 Odieresis
+    0,19, 0x11,0x01,0x10,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xD7 multiply
+    7,9, 0x40,0x42,0x08,0x11,0x00,0xA0,0x04,0x00,0xA0,0x11,0x02,0x08,0x40,0x40,
+    // 0xD8 Oslash
+    4,15, 0x1F,0x02,0x08,0x40,0x64,0x04,0x40,0xC4,0x14,0x42,0x44,0x44,0x48,0x45,0x04,0x60,0x44,0x04,0xC0,0x42,0x08,0x1F,0x00,
+    // 0xD9 Ugrave
+    0,19, 0x10,0x00,0x80,0x04,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xDA Uacute
+    0,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xDB Ucircumflex
+    0,19, 0x04,0x00,0xA0,0x11,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xDC Udieresis
+    0,19, 0x11,0x01,0x10,0x11,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xDD Yacute
+    0,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x40,0x44,0x04,0x20,0x82,0x08,0x11,0x01,0x10,0x0A,0x00,0xA0,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0xDE Thorn
+    4,15, 0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x84,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x04,0x00,0x40,0x04,0x00,0x40,0x00,
+    // 0xDF germandbls
+    4,15, 0x3E,0x04,0x10,0x40,0x84,0x08,0x40,0x84,0x10,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x60,0x45,0x08,0x4F,0x00,
+    // 0xE0 agrave
+    4,15, 0x10,0x00,0x80,0x04,0x00,0x00,0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xE1 aacute
+    4,15, 0x01,0x00,0x20,0x04,0x00,0x00,0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xE2 acircumflex
+    4,15, 0x04,0x00,0xA0,0x11,0x00,0x00,0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xE3 atilde
+    4,15, 0x18,0x82,0x48,0x23,0x00,0x00,0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xE4 adieresis
+    4,15, 0x11,0x01,0x10,0x11,0x00,0x00,0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xE5 aring
+    4,15, 0x0E,0x01,0x10,0x11,0x00,0xE0,0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xE6 ae
+    8,11, 0x7B,0xC0,0x42,0x04,0x20,0x42,0x7C,0x28,0x7E,0x84,0x08,0x40,0x84,0x08,0x42,0x7B,0xC0,
+    // 0xE7 ccedilla
+    8,15, 0x1F,0x02,0x08,0x40,0x44,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x42,0x08,0x1F,0x00,0x40,0x04,0x00,0x40,0x08,0x00,
+    // 0xE8 egrave
+    4,15, 0x10,0x00,0x80,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x47,0xFC,0x40,0x04,0x00,0x40,0x02,0x04,0x1F,0x80,
+    // 0xE9 eacute
+    4,15, 0x01,0x00,0x20,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x47,0xFC,0x40,0x04,0x00,0x40,0x02,0x04,0x1F,0x80,
+    // 0xEA ecircumflex
+    4,15, 0x04,0x00,0xA0,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x47,0xFC,0x40,0x04,0x00,0x40,0x02,0x04,0x1F,0x80,
+    // 0xEB edieresis
+    4,15, 0x11,0x01,0x10,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x47,0xFC,0x40,0x04,0x00,0x40,0x02,0x04,0x1F,0x80,
+    // 0xEC igrave
+    4,15, 0x10,0x00,0x80,0x04,0x00,0x00,0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xED iacute
+    4,15, 0x01,0x00,0x20,0x04,0x00,0x00,0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xEE icircumflex
+    4,15, 0x04,0x00,0xA0,0x11,0x00,0x00,0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xEF idieresis
+    4,15, 0x11,0x01,0x10,0x11,0x00,0x00,0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0xF0 eth
+    4,15, 0x16,0x00,0x80,0x34,0x00,0x20,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xF1 ntilde
+    4,15, 0x18,0x82,0x48,0x23,0x00,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0xF2 ograve
+    4,15, 0x10,0x00,0x80,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xF3 oacute
+    4,15, 0x01,0x00,0x20,0x04,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xF4 ocircumflex
+    4,15, 0x04,0x00,0xA0,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xF5 otilde
+    4,15, 0x18,0x82,0x48,0x23,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xF6 odieresis
+    4,15, 0x11,0x01,0x10,0x11,0x00,0x00,0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0xF7 divide
+    6,11, 0x04,0x00,0x40,0x04,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,0x00,0x04,0x00,0x40,0x04,0x00,
+    // 0xF8 oslash
+    8,11, 0x1F,0x22,0x0C,0x40,0xC4,0x14,0x42,0x44,0x44,0x48,0x45,0x04,0x60,0x46,0x08,0x9F,0x00,
+    // 0xF9 ugrave
+    4,15, 0x10,0x00,0x80,0x04,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xFA uacute
+    4,15, 0x01,0x00,0x20,0x04,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xFB ucircumflex
+    4,15, 0x04,0x00,0xA0,0x11,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xFC udieresis
+    4,15, 0x11,0x01,0x10,0x11,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0xFD yacute
+    4,19, 0x01,0x00,0x20,0x04,0x00,0x00,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x0C,0x1F,0x40,0x04,0x00,0x40,0x08,0x3F,0x00,
+    // 0xFE thorn
+    4,19, 0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x04,0x00,0x40,0x04,0x00,0x40,0x00,
+    // Padding (rows are read as 32 bit words)
+    0x00,0x00,0x00,
+};
+
 /*!
  * \brief Converted "Terminus Font", size 12x24, medium weight.
  */
 const struct Font Font_TerminASCII24 = {
     12,
     24,
-    (const uint16_t*[])
-    {
-        // char0
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111000111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // space
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclam
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotedbl
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // numbersign
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b111111111000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b111111111000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dollar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b10010010000000,
-            0b100010001000000,
-            0b100010000000000,
-            0b100010000000000,
-            0b10010000000000,
-            0b1111100000000,
-            0b10010000000,
-            0b10001000000,
-            0b10001000000,
-            0b100010001000000,
-            0b10010010000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // percent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000010000000,
-            0b100100010000000,
-            0b100100100000000,
-            0b11000100000000,
-            0b1000000000,
-            0b1000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b100000000000,
-            0b1000110000000,
-            0b1001001000000,
-            0b10001001000000,
-            0b10000110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ampersand
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111000000000,
-            0b10000100000000,
-            0b10000100000000,
-            0b10000100000000,
-            0b10000100000000,
-            0b1001000000000,
-            0b110000000000,
-            0b1010000000000,
-            0b10001001000000,
-            0b100000101000000,
-            0b100000010000000,
-            0b100000010000000,
-            0b100000010000000,
-            0b10000101000000,
-            0b1111001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotesingle
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1000000000,
-            0b100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000,
-            0b10000000000,
-            0b1000000000,
-            0b1000000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b1000000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asterisk
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b101000000000,
-            0b10000000000,
-            0b111111111000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b10000010000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b111111111000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // comma
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // hyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // period
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // slash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000,
-            0b10000000,
-            0b100000000,
-            0b100000000,
-            0b1000000000,
-            0b1000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // zero
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000011000000,
-            0b100000101000000,
-            0b100001001000000,
-            0b100010001000000,
-            0b100100001000000,
-            0b101000001000000,
-            0b110000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // one
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b110000000000,
-            0b1010000000000,
-            0b10010000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // two
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b01000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // three
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b10000000,
-            0b111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // four
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01000000,
-            0b11000000,
-            0b101000000,
-            0b1001000000,
-            0b10001000000,
-            0b100001000000,
-            0b1000001000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // five
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // six
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b10000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // seven
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b01000000,
-            0b10000000,
-            0b10000000,
-            0b100000000,
-            0b100000000,
-            0b1000000000,
-            0b1000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eight
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // nine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b10000000,
-            0b11111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // colon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // semicolon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // less
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b1000000000,
-            0b100000000,
-            0b10000000,
-            0b01000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // equal
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // greater
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b1000000000,
-            0b100000000,
-            0b10000000,
-            0b01000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // question
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // at
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b10000001000000,
-            0b100000000100000,
-            0b100001111100000,
-            0b100010000100000,
-            0b100100000100000,
-            0b100100000100000,
-            0b100100000100000,
-            0b100100000100000,
-            0b100100000100000,
-            0b100010001100000,
-            0b100001110100000,
-            0b100000000000000,
-            0b10000000000000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // A
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // B
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // C
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // D
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // E
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // F
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // G
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100011111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // H
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // I
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // J
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b100000010000000,
-            0b100000010000000,
-            0b100000010000000,
-            0b10000100000000,
-            0b1111000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // K
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b100000100000000,
-            0b100001000000000,
-            0b100010000000000,
-            0b100100000000000,
-            0b101000000000000,
-            0b110000000000000,
-            0b101000000000000,
-            0b100100000000000,
-            0b100010000000000,
-            0b100001000000000,
-            0b100000100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // L
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // M
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000100000,
-            0b110000001100000,
-            0b101000010100000,
-            0b101000010100000,
-            0b100100100100000,
-            0b100011000100000,
-            0b100011000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // N
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b110000001000000,
-            0b101000001000000,
-            0b100100001000000,
-            0b100010001000000,
-            0b100001001000000,
-            0b100000101000000,
-            0b100000011000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // O
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // P
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100010001000000,
-            0b10001010000000,
-            0b1111100000000,
-            0b10000000,
-            0b01000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // R
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b101000000000000,
-            0b100100000000000,
-            0b100010000000000,
-            0b100001000000000,
-            0b100000100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // S
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b10000000000000,
-            0b1111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // T
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // U
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // V
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b101000000000,
-            0b101000000000,
-            0b101000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // W
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100000000100000,
-            0b100011000100000,
-            0b100011000100000,
-            0b100100100100000,
-            0b101000010100000,
-            0b101000010100000,
-            0b110000001100000,
-            0b100000000100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // X
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b101000000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b101000000000,
-            0b101000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b100000000000,
-            0b111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // backslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b1000000000000,
-            0b1000000000000,
-            0b100000000000,
-            0b100000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1000000000,
-            0b1000000000,
-            0b100000000,
-            0b100000000,
-            0b10000000,
-            0b10000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b100000000,
-            0b111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciicircum
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // underscore
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // grave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // a
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // b
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // c
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // d
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // e
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // f
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b11111110000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // g
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000011000000,
-            0b1111101000000,
-            0b01000000,
-            0b01000000,
-            0b10000000,
-            0b11111100000000,
-            0b00000000,
-        },
-        // h
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // i
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b1110000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // j
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b00000000,
-            0b1110000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b111000000000,
-            0b00000000,
-        },
-        // k
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000001000000,
-            0b10000010000000,
-            0b10000100000000,
-            0b10001000000000,
-            0b10010000000000,
-            0b11100000000000,
-            0b10010000000000,
-            0b10001000000000,
-            0b10000100000000,
-            0b10000010000000,
-            0b10000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // l
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // m
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100010010000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // n
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // o
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // p
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-        },
-        // q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b00000000,
-        },
-        // r
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100011111000000,
-            0b100100000000000,
-            0b101000000000000,
-            0b110000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // s
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b11111110000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b100000001000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // t
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b11111110000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // u
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // v
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b101000000000,
-            0b101000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // w
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // x
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b101000000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000011000000,
-            0b1111101000000,
-            0b01000000,
-            0b01000000,
-            0b10000000,
-            0b11111100000000,
-            0b00000000,
-        },
-        // z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b01000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1100000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1000000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b10000000000,
-            0b1000000000,
-            0b1000000000,
-            0b1000000000,
-            0b1000000000,
-            0b1000000000,
-            0b110000000,
-            0b1000000000,
-            0b1000000000,
-            0b1000000000,
-            0b1000000000,
-            0b1000000000,
-            0b10000000000,
-            0b1100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciitilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11100001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100001110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // nbspace
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclamdown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b10010010000000,
-            0b100010001000000,
-            0b100010000000000,
-            0b100010000000000,
-            0b100010000000000,
-            0b100010000000000,
-            0b100010000000000,
-            0b100010001000000,
-            0b10010010000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // sterling
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b1000100000000,
-            0b10000010000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b111111000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000000000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // currency
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000100000,
-            0b10000001000000,
-            0b1111110000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b1111110000000,
-            0b10000001000000,
-            0b100000000100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b101000000000,
-            0b10000000000,
-            0b10000000000,
-            0b11111110000000,
-            0b10000000000,
-            0b10000000000,
-            0b11111110000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // brokenbar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // section
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1000010000000,
-            0b1000000000000,
-            0b1000000000000,
-            0b111000000000,
-            0b1000100000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b100010000000,
-            0b11100000000,
-            0b10000000,
-            0b10000000,
-            0b1000010000000,
-            0b111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dieresis
-        (const uint16_t[])
-        {
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // copyright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b10000001000000,
-            0b100111100100000,
-            0b101000010100000,
-            0b101000010100000,
-            0b101000000100000,
-            0b101000000100000,
-            0b101000010100000,
-            0b101000010100000,
-            0b100111100100000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordfeminine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1111110000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000,
-            0b10001000000,
-            0b100010000000,
-            0b1000100000000,
-            0b10001000000000,
-            0b100010000000000,
-            0b10001000000000,
-            0b1000100000000,
-            0b100010000000,
-            0b10001000000,
-            0b1000100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // logicalnot
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b01000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // softhyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // registered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b10000001000000,
-            0b101111100100000,
-            0b101000010100000,
-            0b101000010100000,
-            0b101000010100000,
-            0b101111100100000,
-            0b101001000100000,
-            0b101000100100000,
-            0b101000010100000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // macron
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // degree
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plusminus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b111111111000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // twosuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1000010000000,
-            0b1000010000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1000010000000,
-            0b10000000,
-            0b10000000,
-            0b11100000000,
-            0b10000000,
-            0b10000000,
-            0b1000010000000,
-            0b111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // mu
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000011000000,
-            0b100000101000000,
-            0b111111001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-        },
-        // paragraph
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b100010001000000,
-            0b11110001000000,
-            0b10001000000,
-            0b10001000000,
-            0b10001000000,
-            0b10001000000,
-            0b10001000000,
-            0b10001000000,
-            0b10001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // periodcentered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b00000000,
-        },
-        // onesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b110000000000,
-            0b1010000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordmasculine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111100000000,
-            0b1000010000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b10000001000000,
-            0b1000010000000,
-            0b111100000000,
-            0b00000000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100010000000000,
-            0b10001000000000,
-            0b1000100000000,
-            0b100010000000,
-            0b10001000000,
-            0b1000100000,
-            0b10001000000,
-            0b100010000000,
-            0b1000100000000,
-            0b10001000000000,
-            0b100010000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onequarter
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000,
-            0b1100000000000,
-            0b10100000000000,
-            0b100000000000,
-            0b100001000000,
-            0b100010000000,
-            0b100100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100010000000,
-            0b1000110000000,
-            0b10001010000000,
-            0b100010010000000,
-            0b100010000000,
-            0b111110000000,
-            0b10000000,
-            0b10000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onehalf
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000,
-            0b1100000000000,
-            0b10100000000000,
-            0b100000000000,
-            0b100001000000,
-            0b100010000000,
-            0b100100000000,
-            0b1000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1001110000000,
-            0b10010001000000,
-            0b100010001000000,
-            0b10000000,
-            0b100000000,
-            0b1000000000,
-            0b11111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threequarters
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110000000000,
-            0b10001000000000,
-            0b1000000000,
-            0b110000000000,
-            0b1000000000,
-            0b10001001000000,
-            0b1110010000000,
-            0b100000000,
-            0b1000000000,
-            0b10010000000,
-            0b100110000000,
-            0b1001010000000,
-            0b10010010000000,
-            0b100100010000000,
-            0b111110000000,
-            0b10000000,
-            0b10000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // questiondown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b1000000000000,
-            0b10000000000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Agrave
-        (const uint16_t[])
-        {
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aacute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Acircumflex
-        (const uint16_t[])
-        {
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Atilde
-        (const uint16_t[])
-        {
-            0b1100010000000,
-            0b10010010000000,
-            0b10001100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Adieresis
-        (const uint16_t[])
-        {
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aring
-        (const uint16_t[])
-        {
-            0b111000000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b111000000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // AE
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111100000,
-            0b100010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1111111111000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000011111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b00000000,
-        },
-        // Egrave
-        (const uint16_t[])
-        {
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eacute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ecircumflex
-        (const uint16_t[])
-        {
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Edieresis
-        (const uint16_t[])
-        {
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Igrave
-        (const uint16_t[])
-        {
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Iacute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Icircumflex
-        (const uint16_t[])
-        {
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Idieresis
-        (const uint16_t[])
-        {
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b1111110001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ntilde
-        (const uint16_t[])
-        {
-            0b1100010000000,
-            0b10010010000000,
-            0b10001100000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b110000001000000,
-            0b101000001000000,
-            0b100100001000000,
-            0b100010001000000,
-            0b100001001000000,
-            0b100000101000000,
-            0b100000011000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ograve
-        (const uint16_t[])
-        {
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oacute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ocircumflex
-        (const uint16_t[])
-        {
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Otilde
-        (const uint16_t[])
-        {
-            0b1100010000000,
-            0b10010010000000,
-            0b10001100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Odieresis
-        (const uint16_t[])
-        {
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // multiply
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b101000000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001100000,
-            0b100000001000000,
-            0b100000011000000,
-            0b100000101000000,
-            0b100001001000000,
-            0b100010001000000,
-            0b100100001000000,
-            0b101000001000000,
-            0b110000001000000,
-            0b100000001000000,
-            0b1100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ugrave
-        (const uint16_t[])
-        {
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Uacute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ucircumflex
-        (const uint16_t[])
-        {
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Udieresis
-        (const uint16_t[])
-        {
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Yacute
-        (const uint16_t[])
-        {
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b10000010000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b101000000000,
-            0b101000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // germandbls
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111000000000,
-            0b100000100000000,
-            0b100000010000000,
-            0b100000010000000,
-            0b100000010000000,
-            0b100000100000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b110000001000000,
-            0b101000010000000,
-            0b100111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // agrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // atilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100010000000,
-            0b10010010000000,
-            0b10001100000000,
-            0b00000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // adieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aring
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b111000000000,
-            0b11111100000000,
-            0b10000000,
-            0b01000000,
-            0b01000000,
-            0b1111111000000,
-            0b10000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ae
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111101111000000,
-            0b10000100000,
-            0b10000100000,
-            0b10000100000,
-            0b111110000100000,
-            0b1000011111100000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000000000,
-            0b1000010000100000,
-            0b111101111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b100000000000,
-            0b00000000,
-        },
-        // egrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ecircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // edieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b111111111000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b10000001000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // igrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b1110000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // iacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b1110000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // icircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b1110000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // idieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b1110000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1011000000000,
-            0b100000000000,
-            0b11010000000000,
-            0b1000000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ntilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100010000000,
-            0b10010010000000,
-            0b10001100000000,
-            0b00000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ograve
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ocircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // otilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100010000000,
-            0b10010010000000,
-            0b10001100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // odieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b1111100000000,
-            0b10000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000010000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // divide
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b10000000000,
-            0b10000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100100000,
-            0b10000011000000,
-            0b100000011000000,
-            0b100000101000000,
-            0b100001001000000,
-            0b100010001000000,
-            0b100100001000000,
-            0b101000001000000,
-            0b110000001000000,
-            0b110000010000000,
-            0b1001111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ugrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000000000000,
-            0b100000000000,
-            0b10000000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // uacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ucircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b10000000000,
-            0b101000000000,
-            0b1000100000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // udieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b1000100000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000001000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000,
-            0b1000000000,
-            0b10000000000,
-            0b00000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b10000011000000,
-            0b1111101000000,
-            0b01000000,
-            0b01000000,
-            0b10000000,
-            0b11111100000000,
-            0b00000000,
-        },
-        // thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b111111100000000,
-            0b100000010000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000001000000,
-            0b100000010000000,
-            0b111111100000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b100000000000000,
-            0b00000000,
-        },
-    }
+    0x00,
+    0xFE,
+    Font_TerminASCII24_Index,
+    Font_TerminASCII24_Bitmaps,
+    false
 };
@@ -1,5459 +0,0 @@
-/*
-///////////////////////////////////////////////////////////////////////////////////////////////
-//
-//  This file is part of the firmware of Lightning Detector, an experimental open
-//  hardware project for early notification about approaching thunderstorm activity.
-//  Copyright (C) 2024–2025 M. Frohne
-//
-//  Lightning Detector's firmware is free software: you can redistribute it
-//  and/or modify it under the terms of the GNU General Public License
-//  as published by the Free Software Foundation, either version 3
-//  of the License, or (at your option) any later version.
-//
-//  Lightning Detector's firmware is distributed in the hope that it
-//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
-//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
-//  See the GNU General Public License for more details.
-//
-//  You should have received a copy of the GNU General Public License
-//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
-//
-///////////////////////////////////////////////////////////////////////////////////////////////
-//
-//  This file is additionally licensed under the SIL Open Font License, Version 1.1,
-//  because it embeds a subset of the Terminus Font, Version 4.49.1, as converted from
-//  the original font file for size 12x24 (bold weight) using the ArduinoGraphics library.
-//
-//  The Terminus Font Software itself is licensed under the SIL Open Font License, Version 1.1.
-//
-//  Terminus Font, Copyright (C) 2020 Dimitar Toshkov Zhekov,
-//  with Reserved Font Name "Terminus Font"
-//
-//  You should have received a copy of the SIL Open Font License along with Lightning Detector.
-//  If not, see <https://openfontlicense.org/>.
-//
-///////////////////////////////////////////////////////////////////////////////////////////////
-*/
-
-/*!
- * \brief Converted "Terminus Font", size 12x24, bold weight.
- */
-const struct Font Font_TerminASCII24Bold = {
-    12,
-    24,
-    (const uint16_t*[])
-    {
-        // char0
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111100111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // space
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclam
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotedbl
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // numbersign
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111111111100000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111111111100000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dollar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b11011011000000,
-            0b110011001100000,
-            0b110011000000000,
-            0b110011000000000,
-            0b11011000000000,
-            0b1111110000000,
-            0b11011000000,
-            0b11001100000,
-            0b11001100000,
-            0b110011001100000,
-            0b11011011000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // percent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100011000000,
-            0b110110011000000,
-            0b110110110000000,
-            0b11100110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b1100111000000,
-            0b1101101100000,
-            0b11001101100000,
-            0b11000111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ampersand
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b1101100000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b1101100000000,
-            0b111000000000,
-            0b1111001100000,
-            0b11001101100000,
-            0b110000111000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000111000000,
-            0b11001101100000,
-            0b1111001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotesingle
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asterisk
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000011000000,
-            0b11000110000000,
-            0b1101100000000,
-            0b111000000000,
-            0b1111111111100000,
-            0b111000000000,
-            0b1101100000000,
-            0b11000110000000,
-            0b110000011000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b111111111100000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // comma
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // hyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // period
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // slash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // zero
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011100000,
-            0b110000111100000,
-            0b110001101100000,
-            0b110011001100000,
-            0b110110001100000,
-            0b111100001100000,
-            0b111000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // one
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111000000000,
-            0b1111000000000,
-            0b11011000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // two
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // three
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // four
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01100000,
-            0b11100000,
-            0b111100000,
-            0b1101100000,
-            0b11001100000,
-            0b110001100000,
-            0b1100001100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // five
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // six
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // seven
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b01100000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eight
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // nine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // colon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // semicolon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // less
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b110000000,
-            0b11000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // equal
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // greater
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b110000000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // question
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // at
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b110000011000000,
-            0b1100000001100000,
-            0b1100001111100000,
-            0b1100011001100000,
-            0b1100110001100000,
-            0b1100110001100000,
-            0b1100110001100000,
-            0b1100110001100000,
-            0b1100110001100000,
-            0b1100011001100000,
-            0b1100001111100000,
-            0b1100000000000000,
-            0b110000000000000,
-            0b11111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // A
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // B
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // C
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // D
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // E
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // F
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // G
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110001111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // H
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // I
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // J
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b11000110000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // K
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000011000000,
-            0b110000110000000,
-            0b110001100000000,
-            0b110011000000000,
-            0b110110000000000,
-            0b111100000000000,
-            0b111000000000000,
-            0b111100000000000,
-            0b110110000000000,
-            0b110011000000000,
-            0b110001100000000,
-            0b110000110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // L
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // M
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1000000000100000,
-            0b1100000001100000,
-            0b1110000011100000,
-            0b1111000111100000,
-            0b1101101101100000,
-            0b1100111001100000,
-            0b1100010001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // N
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111000001100000,
-            0b111100001100000,
-            0b110110001100000,
-            0b110011001100000,
-            0b110001101100000,
-            0b110000111100000,
-            0b110000011100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // O
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // P
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110011001100000,
-            0b11001111000000,
-            0b1111110000000,
-            0b11000000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // R
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b111100000000000,
-            0b110110000000000,
-            0b110011000000000,
-            0b110001100000000,
-            0b110000110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // S
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000000000,
-            0b1111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // T
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // U
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // V
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b111100000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // W
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100000001100000,
-            0b1100010001100000,
-            0b1100111001100000,
-            0b1101101101100000,
-            0b1111000111100000,
-            0b1110000011100000,
-            0b1100000001100000,
-            0b1000000000100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // X
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b111100000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // backslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1100000000,
-            0b1100000000,
-            0b110000000,
-            0b110000000,
-            0b11000000,
-            0b11000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciicircum
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // underscore
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // grave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // a
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // b
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // c
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // d
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // e
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // f
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // g
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011100000,
-            0b1111111100000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11111110000000,
-            0b00000000,
-        },
-        // h
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // i
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // j
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b00000000,
-            0b1111000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b111100000000,
-            0b00000000,
-        },
-        // k
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000001100000,
-            0b11000011000000,
-            0b11000110000000,
-            0b11001100000000,
-            0b11011000000000,
-            0b11110000000000,
-            0b11011000000000,
-            0b11001100000000,
-            0b11000110000000,
-            0b11000011000000,
-            0b11000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // l
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // m
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110011011000000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // n
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // o
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // p
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-        },
-        // q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b00000000,
-        },
-        // r
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110011111100000,
-            0b110110000000000,
-            0b111100000000000,
-            0b111000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // s
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111000000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11111111000000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b110000001100000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // t
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b111111110000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // u
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // v
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b111100000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // w
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // x
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1100110000000,
-            0b111100000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011100000,
-            0b1111111100000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11111110000000,
-            0b00000000,
-        },
-        // z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11100000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b11100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciitilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11110001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110001111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // nbspace
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclamdown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b11011011000000,
-            0b110011001100000,
-            0b110011000000000,
-            0b110011000000000,
-            0b110011000000000,
-            0b110011000000000,
-            0b110011000000000,
-            0b110011001100000,
-            0b11011011000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // sterling
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1100110000000,
-            0b11000011000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b111111100000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000001100000,
-            0b11000001100000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // currency
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000001100000,
-            0b110000011000000,
-            0b11111110000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b11111110000000,
-            0b110000011000000,
-            0b1100000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b11000000000,
-            0b11000000000,
-            0b11111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b11111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // brokenbar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // section
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b11000110000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b1111000000000,
-            0b11001100000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b110000000,
-            0b110000000,
-            0b11000110000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dieresis
-        (const uint16_t[])
-        {
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // copyright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b100000001000000,
-            0b1001111100100000,
-            0b1011000110100000,
-            0b1011000110100000,
-            0b1011000000100000,
-            0b1011000000100000,
-            0b1011000110100000,
-            0b1011000110100000,
-            0b1001111100100000,
-            0b100000001000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordfeminine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b11000000,
-            0b11111111000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b11111111000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11001100000,
-            0b110011000000,
-            0b1100110000000,
-            0b11001100000000,
-            0b110011000000000,
-            0b1100110000000000,
-            0b110011000000000,
-            0b11001100000000,
-            0b1100110000000,
-            0b110011000000,
-            0b11001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // logicalnot
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // softhyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // registered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b100000001000000,
-            0b1011111100100000,
-            0b1011000110100000,
-            0b1011000110100000,
-            0b1011000110100000,
-            0b1011111100100000,
-            0b1011011000100000,
-            0b1011001100100000,
-            0b1011000110100000,
-            0b100000001000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // macron
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // degree
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plusminus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b111111111100000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // twosuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1111100000000,
-            0b11000110000000,
-            0b110000000,
-            0b110000000,
-            0b111100000000,
-            0b110000000,
-            0b110000000,
-            0b11000110000000,
-            0b1111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // mu
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011100000,
-            0b110000111100000,
-            0b111111101100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-        },
-        // paragraph
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b110011001100000,
-            0b11111001100000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // periodcentered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-        },
-        // onesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111000000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordmasculine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1111100000000,
-            0b11000110000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b11000110000000,
-            0b1111100000000,
-            0b00000000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000000,
-            0b110011000000000,
-            0b11001100000000,
-            0b1100110000000,
-            0b110011000000,
-            0b11001100000,
-            0b110011000000,
-            0b1100110000000,
-            0b11001100000000,
-            0b110011000000000,
-            0b1100110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onequarter
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b1110000000000,
-            0b11110000000000,
-            0b110000000000,
-            0b110000100000,
-            0b110001100000,
-            0b110011000000,
-            0b110000000,
-            0b1100000000,
-            0b11001100000,
-            0b110011100000,
-            0b1100111100000,
-            0b11001101100000,
-            0b110011001100000,
-            0b100011111100000,
-            0b01100000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onehalf
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b1110000000000,
-            0b11110000000000,
-            0b110000100000,
-            0b110001100000,
-            0b110011000000,
-            0b110110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1101111000000,
-            0b11011001100000,
-            0b110011001100000,
-            0b100000011000000,
-            0b110000000,
-            0b1100000000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threequarters
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000000,
-            0b110011000000000,
-            0b11000000000,
-            0b1110000000000,
-            0b11000100000,
-            0b110011001100000,
-            0b11110011000000,
-            0b110000000,
-            0b1100000000,
-            0b11001100000,
-            0b110011100000,
-            0b1100111100000,
-            0b11001101100000,
-            0b110011001100000,
-            0b100011111100000,
-            0b01100000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // questiondown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Agrave
-        (const uint16_t[])
-        {
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Acircumflex
-        (const uint16_t[])
-        {
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Atilde
-        (const uint16_t[])
-        {
-            0b1110011000000,
-            0b11011011000000,
-            0b11001110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Adieresis
-        (const uint16_t[])
-        {
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aring
-        (const uint16_t[])
-        {
-            0b111100000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // AE
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b110001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1111111111110000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-        },
-        // Egrave
-        (const uint16_t[])
-        {
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ecircumflex
-        (const uint16_t[])
-        {
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Edieresis
-        (const uint16_t[])
-        {
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Igrave
-        (const uint16_t[])
-        {
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Iacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Icircumflex
-        (const uint16_t[])
-        {
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Idieresis
-        (const uint16_t[])
-        {
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b1111111001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ntilde
-        (const uint16_t[])
-        {
-            0b1110011000000,
-            0b11011011000000,
-            0b11001110000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111000001100000,
-            0b111100001100000,
-            0b110110001100000,
-            0b110011001100000,
-            0b110001101100000,
-            0b110000111100000,
-            0b110000011100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ograve
-        (const uint16_t[])
-        {
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ocircumflex
-        (const uint16_t[])
-        {
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Otilde
-        (const uint16_t[])
-        {
-            0b1110011000000,
-            0b11011011000000,
-            0b11001110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Odieresis
-        (const uint16_t[])
-        {
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // multiply
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1100110000000,
-            0b111100000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001110000,
-            0b110000001100000,
-            0b110000011100000,
-            0b110000111100000,
-            0b110001101100000,
-            0b110011001100000,
-            0b110110001100000,
-            0b111100001100000,
-            0b111000001100000,
-            0b110000001100000,
-            0b1110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ugrave
-        (const uint16_t[])
-        {
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Uacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ucircumflex
-        (const uint16_t[])
-        {
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Udieresis
-        (const uint16_t[])
-        {
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Yacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b111100000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // germandbls
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000000,
-            0b110000110000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000110000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111000001100000,
-            0b110100011000000,
-            0b110111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // agrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // atilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110011000000,
-            0b11011011000000,
-            0b11001110000000,
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // adieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aring
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b111100000000,
-            0b11111110000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b1111111100000,
-            0b11000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ae
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111101111100000,
-            0b111000110000,
-            0b11000110000,
-            0b11000110000,
-            0b111111000110000,
-            0b1100011111110000,
-            0b1100011000000000,
-            0b1100011000000000,
-            0b1100011000000000,
-            0b1100011100110000,
-            0b111110111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-        },
-        // egrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ecircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // edieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b111111111100000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // igrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // iacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // icircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // idieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11011000000000,
-            0b1110000000000,
-            0b11011000000000,
-            0b1100000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ntilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110011000000,
-            0b11011011000000,
-            0b11001110000000,
-            0b00000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ograve
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ocircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // otilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110011000000,
-            0b11011011000000,
-            0b11001110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // odieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b1111110000000,
-            0b11000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // divide
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110100000,
-            0b11000011000000,
-            0b110000011100000,
-            0b110000111100000,
-            0b110001101100000,
-            0b110011001100000,
-            0b110110001100000,
-            0b111100001100000,
-            0b111000001100000,
-            0b11000011000000,
-            0b101111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ugrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // uacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ucircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b111100000000,
-            0b1100110000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // udieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b1100110000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000001100000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011100000,
-            0b1111111100000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11111110000000,
-            0b00000000,
-        },
-        // thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-        },
-    }
-};
@@ -0,0 +1,139 @@
+/*
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is additionally licensed under the SIL Open Font License, Version 1.1,
+//  because it embeds a subset of the Terminus Font, Version 4.49.1, as converted from
+//  the original font file for size 12x24 (medium weight) using 'tools/bdf2font.cpp'.
+//
+//  The Terminus Font Software itself is licensed under the SIL Open Font License, Version 1.1.
+//
+//  Terminus Font, Copyright (C) 2020 Dimitar Toshkov Zhekov,
+//  with Reserved Font Name "Terminus Font"
+//
+//  You should have received a copy of the SIL Open Font License along with Lightning Detector.
+//  If not, see <https://openfontlicense.org/>.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+//
+//  Generated by 'tools/bdf2font.cpp'. Do not edit.
+//
+
+static const uint16_t Font_TerminASCII24Status_Index[] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0019, 0x001D, 0x0024,
+    0x003B, 0x0054, 0x006D, 0x0086, 0x009F, 0x00B8, 0x00D1, 0x00EA, 0x0103, 0x011C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0135,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x014E, 0x0167, 0xFFFF, 0xFFFF, 0xFFFF, 0x0180, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0199, 0x01B2,
+    0xFFFF, 0xFFFF, 0x01CB, 0x01E4, 0x01FD, 0xFFFF, 0x0216, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x022F, 0xFFFF, 0xFFFF, 0x0242, 0xFFFF, 0x025B, 0xFFFF, 0x0274, 0x028D, 0xFFFF, 0x02A6, 0xFFFF, 0x02BF, 0x02D2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x02E5, 0x02F8,
+};
+
+static const uint8_t Font_TerminASCII24Status_Bitmaps[] = {
+    // 0x20 space
+    0,0,
+    // 0x25 percent
+    5,14, 0x30,0x84,0x88,0x49,0x03,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x08,0x00,0x80,0x11,0x81,0x24,0x22,0x42,0x18,
+    // 0x2D hyphen
+    11,1, 0x7F,0xC0,
+    // 0x2E period
+    16,3, 0x04,0x00,0x40,0x04,0x00,
+    // 0x2F slash
+    5,14, 0x00,0x80,0x08,0x01,0x00,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x08,0x00,0x80,0x10,0x01,0x00,0x20,0x02,0x00,
+    // 0x30 zero
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0xC4,0x14,0x42,0x44,0x44,0x48,0x45,0x04,0x60,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x31 one
+    4,15, 0x04,0x00,0xC0,0x14,0x02,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x3F,0x80,
+    // 0x32 two
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x40,0x04,0x00,0x80,0x10,0x02,0x00,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x7F,0xC0,
+    // 0x33 three
+    4,15, 0x1F,0x02,0x08,0x40,0x40,0x04,0x00,0x40,0x04,0x00,0x80,0xF0,0x00,0x80,0x04,0x00,0x40,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x34 four
+    4,15, 0x00,0x40,0x0C,0x01,0x40,0x24,0x04,0x40,0x84,0x10,0x42,0x04,0x40,0x44,0x04,0x40,0x47,0xFC,0x00,0x40,0x04,0x00,0x40,
+    // 0x35 five
+    4,15, 0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x00,0x08,0x00,0x40,0x04,0x00,0x40,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x36 six
+    4,15, 0x1F,0x82,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x37 seven
+    4,15, 0x7F,0xC4,0x04,0x40,0x40,0x04,0x00,0x80,0x08,0x01,0x00,0x10,0x02,0x00,0x20,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x38 eight
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x20,0x81,0xF0,0x20,0x84,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x39 nine
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,0x04,0x00,0x40,0x04,0x00,0x40,0x08,0x3F,0x00,
+    // 0x3F question
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x40,0x08,0x01,0x00,0x20,0x04,0x00,0x40,0x00,0x00,0x00,0x04,0x00,0x40,0x04,0x00,
+    // 0x44 D
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x08,0x7F,0x00,
+    // 0x45 E
+    4,15, 0x7F,0xC4,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x07,0xF0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0xC0,
+    // 0x49 I
+    4,15, 0x1F,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0x4E N
+    4,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x60,0x45,0x04,0x48,0x44,0x44,0x42,0x44,0x14,0x40,0xC4,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x4F O
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x52 R
+    4,15, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x87,0xF0,0x50,0x04,0x80,0x44,0x04,0x20,0x41,0x04,0x08,0x40,0x40,
+    // 0x53 S
+    4,15, 0x1F,0x02,0x08,0x40,0x44,0x00,0x40,0x04,0x00,0x20,0x01,0xF0,0x00,0x80,0x04,0x00,0x40,0x04,0x40,0x42,0x08,0x1F,0x00,
+    // 0x54 T
+    4,15, 0x7F,0xC0,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x56 V
+    4,15, 0x40,0x44,0x04,0x40,0x44,0x04,0x20,0x82,0x08,0x20,0x81,0x10,0x11,0x01,0x10,0x0A,0x00,0xA0,0x0A,0x00,0x40,0x04,0x00,
+    // 0x61 a
+    8,11, 0x3F,0x00,0x08,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0x64 d
+    4,15, 0x00,0x40,0x04,0x00,0x40,0x04,0x1F,0xC2,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x42,0x04,0x1F,0xC0,
+    // 0x66 f
+    4,15, 0x03,0xC0,0x40,0x04,0x00,0x40,0x3F,0x80,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,
+    // 0x68 h
+    4,15, 0x40,0x04,0x00,0x40,0x04,0x00,0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x69 i
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x00,0x1C,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x1F,0x00,
+    // 0x6B k
+    4,15, 0x20,0x02,0x00,0x20,0x02,0x00,0x20,0x42,0x08,0x21,0x02,0x20,0x24,0x03,0x80,0x24,0x02,0x20,0x21,0x02,0x08,0x20,0x40,
+    // 0x6D m
+    8,11, 0x7F,0x04,0x48,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x40,
+    // 0x6E n
+    8,11, 0x7F,0x04,0x08,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x44,0x04,0x40,0x40,
+    // 0x73 s
+    8,11, 0x3F,0x84,0x04,0x40,0x04,0x00,0x40,0x03,0xF8,0x00,0x40,0x04,0x00,0x44,0x04,0x3F,0x80,
+    // 0x74 t
+    4,15, 0x04,0x00,0x40,0x04,0x00,0x40,0x3F,0x80,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x03,0xC0,
+    // Padding (rows are read as 32 bit words)
+    0x00,0x00,0x00,
+};
+
+/*!
+ * \brief Converted "Terminus Font", size 12x24, medium weight.
+ *
+ * Contains only the glyphs of the characters " %-./0123456789?DEINORSTVadfhikmnst".
+ */
+const struct Font Font_TerminASCII24Status = {
+    12,
+    24,
+    0x20,
+    0x74,
+    Font_TerminASCII24Status_Index,
+    Font_TerminASCII24Status_Bitmaps,
+    false
+};
@@ -22,7 +22,7 @@
 //
 //  This file is additionally licensed under the SIL Open Font License, Version 1.1,
 //  because it embeds a subset of the Terminus Font, Version 4.49.1, as converted from
-//  the original font file for size 14x28 (medium weight) using the ArduinoGraphics library.
+//  the original font file for size 14x28 (medium weight) using 'tools/bdf2font.cpp'.
 //
 //  The Terminus Font Software itself is licensed under the SIL Open Font License, Version 1.1.
 //
@@ -35,6189 +35,425 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////
 */
 
+//
+//  Generated by 'tools/bdf2font.cpp'. Do not edit.
+//
+
+static const uint16_t Font_TerminASCII28_Index[] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0022, 0x0024, 0x0046, 0x0053, 0x0075, 0x00A0, 0x00C2, 0x00E4, 0x00F1, 0x0113, 0x0135, 0x014B, 0x0161, 0x016E, 0x0172, 0x017B,
+    0x019D, 0x01BF, 0x01E1, 0x0203, 0x0225, 0x0247, 0x0269, 0x028B, 0x02AD, 0x02CF, 0x02F1, 0x030A, 0x0327, 0x0347, 0x0356, 0x0376,
+    0x0398, 0x03BA, 0x03DC, 0x03FE, 0x0420, 0x0442, 0x0464, 0x0486, 0x04A8, 0x04CA, 0x04EC, 0x050E, 0x0530, 0x0552, 0x0574, 0x0596,
+    0x05B8, 0x05DA, 0x05FF, 0x0621, 0x0643, 0x0665, 0x0687, 0x06A9, 0x06CB, 0x06ED, 0x070F, 0x0731, 0x0753, 0x0775, 0x0797, 0x07A4,
+    0x07A8, 0x07B1, 0x07CA, 0x07EC, 0x0805, 0x0827, 0x0840, 0x0862, 0x0884, 0x08A6, 0x08C8, 0x08F3, 0x0915, 0x0937, 0x0950, 0x0969,
+    0x0982, 0x09A4, 0x09C6, 0x09DF, 0x09F8, 0x0A1A, 0x0A33, 0x0A4C, 0x0A65, 0x0A7E, 0x0AA0, 0x0AB9, 0x0ADB, 0x0AFD, 0x0B1F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0B2A, 0x0B2C, 0x0B4E, 0x0B6E, 0x0B90, 0x0BA9, 0x0BCB, 0x0BED, 0x0C12, 0x0C1A, 0x0C35, 0x0C4E, 0x0C67, 0x0C76, 0x0C7A, 0x0C95,
+    0x0C99, 0x0CA8, 0x0CC5, 0x0CD9, 0x0CED, 0x0CF5, 0x0D17, 0x0D39, 0x0D42, 0x0D4D, 0x0D61, 0x0D7A, 0x0D93, 0x0DB5, 0x0DD7, 0x0DF9,
+    0x0E1B, 0x0E44, 0x0E6D, 0x0E96, 0x0EBF, 0x0EE8, 0x0F11, 0x0F33, 0x0F5E, 0x0F87, 0x0FB0, 0x0FD9, 0x1002, 0x102B, 0x1054, 0x107D,
+    0x10A6, 0x10C8, 0x10F1, 0x111A, 0x1143, 0x116C, 0x1195, 0x11BE, 0x11D4, 0x11F6, 0x121F, 0x1248, 0x1271, 0x129A, 0x12C3, 0x12E5,
+    0x1307, 0x1327, 0x1347, 0x1367, 0x1387, 0x13A7, 0x13C7, 0x13E0, 0x1402, 0x1422, 0x1442, 0x1462, 0x1482, 0x14A2, 0x14C2, 0x14E2,
+    0x1502, 0x1524, 0x1544, 0x1564, 0x1584, 0x15A4, 0x15C4, 0x15E4, 0x15FD, 0x1616, 0x1636, 0x1656, 0x1676, 0x1696, 0x16BF,
+};
+
+static const uint8_t Font_TerminASCII28_Bitmaps[] = {
+    // 0x00 char0
+    4,18, 0x78,0xF1,0x80,0xC6,0x03,0x18,0x0C,0x00,0x00,0x00,0x00,0x00,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x00,0x00,0x00,0x00,0x00,0x06,0x03,0x18,0x0C,0x60,0x31,0xE3,0xC0,
+    // 0x20 space
+    0,0,
+    // 0x21 exclam
+    4,18, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x22 quotedbl
+    2,6, 0x18,0xC0,0x63,0x01,0x8C,0x06,0x30,0x18,0xC0,0x63,0x00,
+    // 0x23 numbersign
+    4,18, 0x18,0xC0,0x63,0x01,0x8C,0x06,0x30,0x18,0xC1,0xFF,0xC1,0x8C,0x06,0x30,0x18,0xC0,0x63,0x01,0x8C,0x06,0x30,0x7F,0xF0,0x63,0x01,0x8C,0x06,0x30,0x18,0xC0,0x63,0x00,
+    // 0x24 dollar
+    2,23, 0x03,0x00,0x0C,0x00,0x30,0x07,0xF8,0x33,0x31,0x8C,0x66,0x30,0x18,0xC0,0x63,0x01,0x8C,0x03,0x30,0x07,0xF8,0x03,0x30,0x0C,0x60,0x31,0x80,0xC6,0x03,0x19,0x8C,0x63,0x33,0x07,0xF8,0x03,0x00,0x0C,0x00,0x30,0x00,
+    // 0x25 percent
+    4,18, 0x3C,0x31,0x98,0xC6,0x66,0x19,0x98,0x3C,0xC0,0x03,0x00,0x18,0x00,0x60,0x03,0x00,0x0C,0x00,0x60,0x01,0x80,0x0C,0x00,0x33,0xC1,0x99,0x86,0x66,0x31,0x98,0xC3,0xC0,
+    // 0x26 ampersand
+    4,18, 0x0F,0x00,0x66,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC3,0x01,0x98,0x03,0xC0,0x0E,0x00,0x6C,0x63,0x19,0x98,0x3C,0x60,0x61,0x81,0x86,0x06,0x18,0x3C,0x31,0x98,0x7C,0x60,
+    // 0x27 quotesingle
+    2,6, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x28 parenleft
+    4,18, 0x01,0x80,0x0C,0x00,0x60,0x01,0x80,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0x60,0x01,0x80,0x03,0x00,0x06,0x00,
+    // 0x29 parenright
+    4,18, 0x0C,0x00,0x18,0x00,0x30,0x00,0xC0,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x30,0x00,0xC0,0x06,0x00,0x30,0x00,
+    // 0x2A asterisk
+    8,11, 0x30,0x30,0x61,0x80,0xCC,0x01,0xE0,0x03,0x01,0xFF,0xE0,0x30,0x01,0xE0,0x0C,0xC0,0x61,0x83,0x03,0x00,
+    // 0x2B plus
+    8,11, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x01,0xFF,0xE0,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,
+    // 0x2C comma
+    18,6, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x06,0x00,0x30,0x00,
+    // 0x2D hyphen
+    13,1, 0x7F,0xF0,
+    // 0x2E period
+    18,4, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,
+    // 0x2F slash
+    4,18, 0x00,0x30,0x00,0xC0,0x06,0x00,0x18,0x00,0xC0,0x03,0x00,0x18,0x00,0x60,0x03,0x00,0x0C,0x00,0x60,0x01,0x80,0x0C,0x00,0x30,0x01,0x80,0x06,0x00,0x30,0x00,0xC0,0x00,
+    // 0x30 zero
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x81,0xC6,0x0F,0x18,0x6C,0x63,0x31,0x98,0xC6,0xC3,0x1E,0x0C,0x70,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x31 one
+    4,18, 0x03,0x00,0x1C,0x00,0xF0,0x06,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x7F,0x80,
+    // 0x32 two
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0x33 three
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x18,0x0F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x34 four
+    4,18, 0x00,0x30,0x01,0xC0,0x0F,0x00,0x6C,0x03,0x30,0x18,0xC0,0xC3,0x06,0x0C,0x30,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,
+    // 0x35 five
+    4,18, 0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x1F,0xF0,0x00,0x60,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x36 six
+    4,18, 0x1F,0xE0,0xC0,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x1F,0xF0,0x60,0x61,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x37 seven
+    4,18, 0x7F,0xF1,0x80,0xC6,0x03,0x18,0x0C,0x60,0x30,0x01,0x80,0x06,0x00,0x30,0x00,0xC0,0x06,0x00,0x18,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x38 eight
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x39 nine
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x30,0xC0,0xC1,0xFF,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x60,0xFF,0x00,
+    // 0x3A colon
+    9,13, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,
+    // 0x3B semicolon
+    9,15, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x18,0x00,0xC0,0x00,
+    // 0x3C less
+    5,17, 0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,
+    // 0x3D equal
+    10,7, 0x7F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x00,
+    // 0x3E greater
+    5,17, 0x30,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x00,
+    // 0x3F question
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x40 at
+    4,18, 0x1F,0xE0,0xC0,0xC6,0x01,0x98,0x06,0x61,0xF9,0x8C,0x66,0x61,0x99,0x86,0x66,0x19,0x98,0x66,0x61,0x99,0x86,0x63,0x19,0x87,0xA6,0x00,0x18,0x00,0x30,0x00,0x7F,0xE0,
+    // 0x41 A
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0x42 B
+    4,18, 0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x18,0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x61,0xFF,0x00,
+    // 0x43 C
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x44 D
+    4,18, 0x7F,0x01,0x87,0x06,0x06,0x18,0x18,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x06,0x18,0x18,0x61,0xC1,0xFC,0x00,
+    // 0x45 E
+    4,18, 0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0x81,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0x46 F
+    4,18, 0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0x81,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x00,
+    // 0x47 G
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x8F,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x48 H
+    4,18, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x7F,0xF1,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0x49 I
+    4,18, 0x0F,0xC0,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0x4A J
+    4,18, 0x01,0xF8,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x60,0x61,0x81,0x86,0x06,0x18,0x18,0x30,0xC0,0x7E,0x00,
+    // 0x4B K
+    4,18, 0x60,0x31,0x81,0x86,0x0C,0x18,0x60,0x63,0x01,0x98,0x06,0xC0,0x1E,0x00,0x70,0x01,0xC0,0x07,0x80,0x1B,0x00,0x66,0x01,0x8C,0x06,0x18,0x18,0x30,0x60,0x61,0x80,0xC0,
+    // 0x4C L
+    4,18, 0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0x4D M
+    4,18, 0x60,0x19,0x80,0x67,0x03,0x9E,0x1E,0x6C,0xD9,0xB3,0x66,0x79,0x98,0xC6,0x63,0x19,0x80,0x66,0x01,0x98,0x06,0x60,0x19,0x80,0x66,0x01,0x98,0x06,0x60,0x19,0x80,0x60,
+    // 0x4E N
+    4,18, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xC0,0xC7,0x83,0x1B,0x0C,0x66,0x31,0x8C,0xC6,0x1B,0x18,0x3C,0x60,0x71,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0x4F O
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x50 P
+    4,18, 0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x61,0xFF,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x00,
+    // 0x51 Q
+    4,20, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0xCC,0x31,0xE0,0x7F,0x00,0x06,0x00,0x0C,
+    // 0x52 R
+    4,18, 0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x61,0xFF,0x07,0x80,0x1B,0x00,0x66,0x01,0x8C,0x06,0x18,0x18,0x30,0x60,0x61,0x80,0xC0,
+    // 0x53 S
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x01,0x80,0x06,0x00,0x0C,0x00,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x00,0x30,0x00,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x54 T
+    4,18, 0x7F,0xF8,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x55 U
+    4,18, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0x56 V
+    4,18, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0xC1,0x83,0x06,0x0C,0x18,0x18,0xC0,0x63,0x01,0x8C,0x06,0x30,0x0D,0x80,0x36,0x00,0xD8,0x01,0xC0,0x07,0x00,0x1C,0x00,
+    // 0x57 W
+    4,18, 0x60,0x19,0x80,0x66,0x01,0x98,0x06,0x60,0x19,0x80,0x66,0x01,0x98,0x06,0x60,0x19,0x8C,0x66,0x31,0x99,0xE6,0x6C,0xD9,0xB3,0x67,0x87,0x9C,0x0E,0x60,0x19,0x80,0x60,
+    // 0x58 X
+    4,18, 0x60,0x31,0x80,0xC3,0x06,0x0C,0x18,0x18,0xC0,0x63,0x00,0xD8,0x03,0x60,0x07,0x00,0x1C,0x00,0xD8,0x03,0x60,0x18,0xC0,0x63,0x03,0x06,0x0C,0x18,0x60,0x31,0x80,0xC0,
+    // 0x59 Y
+    4,18, 0x60,0x19,0x80,0x63,0x03,0x0C,0x0C,0x18,0x60,0x61,0x80,0xCC,0x03,0x30,0x07,0x80,0x1E,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x5A Z
+    4,18, 0x7F,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0x5B bracketleft
+    4,18, 0x0F,0xC0,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x3F,0x00,
+    // 0x5C backslash
+    4,18, 0x30,0x00,0xC0,0x01,0x80,0x06,0x00,0x0C,0x00,0x30,0x00,0x60,0x01,0x80,0x03,0x00,0x0C,0x00,0x18,0x00,0x60,0x00,0xC0,0x03,0x00,0x06,0x00,0x18,0x00,0x30,0x00,0xC0,
+    // 0x5D bracketright
+    4,18, 0x0F,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x3F,0x00,
+    // 0x5E asciicircum
+    2,6, 0x02,0x00,0x1C,0x00,0xD8,0x06,0x30,0x30,0x61,0x80,0xC0,
+    // 0x5F underscore
+    24,1, 0x7F,0xF0,
+    // 0x60 grave
+    0,4, 0x18,0x00,0x30,0x00,0x60,0x00,0xC0,
+    // 0x61 a
+    9,13, 0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0x62 b
+    4,18, 0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0x06,0x06,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x61,0xFF,0x00,
+    // 0x63 c
+    9,13, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0x64 d
+    4,18, 0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x7F,0xC3,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x30,0x7F,0xC0,
+    // 0x65 e
+    9,13, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC7,0xFF,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x0C,0x0C,0x1F,0xE0,
+    // 0x66 f
+    4,18, 0x03,0xF0,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0xFF,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,
+    // 0x67 g
+    9,18, 0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x60,0xFF,0x00,
+    // 0x68 h
+    4,18, 0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0x06,0x06,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0x69 i
+    4,18, 0x03,0x00,0x0C,0x00,0x30,0x00,0x00,0x00,0x00,0x3C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0x6A j
+    4,23, 0x00,0x60,0x01,0x80,0x06,0x00,0x00,0x00,0x00,0x07,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x83,0x06,0x0C,0x18,0x30,0x60,0x63,0x00,0xF8,0x00,
+    // 0x6B k
+    4,18, 0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0xC3,0x06,0x0C,0x30,0x31,0x80,0xCC,0x03,0x60,0x0F,0x00,0x36,0x00,0xCC,0x03,0x18,0x0C,0x30,0x30,0x60,0xC0,0xC0,
+    // 0x6C l
+    4,18, 0x0F,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0x6D m
+    9,13, 0x7F,0xE1,0x8C,0xC6,0x31,0x98,0xC6,0x63,0x19,0x8C,0x66,0x31,0x98,0xC6,0x63,0x19,0x8C,0x66,0x31,0x98,0xC6,0x63,0x18,
+    // 0x6E n
+    9,13, 0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x30,
+    // 0x6F o
+    9,13, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0x70 p
+    9,18, 0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x18,0x7F,0xC1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x00,
+    // 0x71 q
+    9,18, 0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,
+    // 0x72 r
+    9,13, 0x67,0xF1,0xB0,0x07,0x80,0x1C,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x00,
+    // 0x73 s
+    9,13, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x00,0x60,0x00,0xC0,0x01,0xFC,0x00,0x18,0x00,0x30,0x00,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0x74 t
+    4,18, 0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0xFF,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x0F,0x80,
+    // 0x75 u
+    9,13, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0x76 v
+    9,13, 0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x30,0x60,0xC1,0x81,0x8C,0x06,0x30,0x18,0xC0,0x36,0x00,0xD8,0x01,0xC0,0x07,0x00,
+    // 0x77 w
+    9,13, 0x60,0x19,0x80,0x66,0x01,0x98,0x06,0x63,0x19,0x8C,0x66,0x31,0x98,0xC6,0x63,0x19,0x8C,0x66,0x31,0x8C,0xCC,0x1F,0xE0,
+    // 0x78 x
+    9,13, 0x60,0x31,0x80,0xC3,0x06,0x06,0x30,0x0D,0x80,0x1C,0x00,0x70,0x01,0xC0,0x0D,0x80,0x63,0x03,0x06,0x18,0x0C,0x60,0x30,
+    // 0x79 y
+    9,18, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x60,0xFF,0x00,
+    // 0x7A z
+    9,13, 0x7F,0xF0,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x18,0x00,0x7F,0xF0,
+    // 0x7B braceleft
+    4,18, 0x01,0xC0,0x0C,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x1C,0x00,0x70,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x03,0x00,0x07,0x00,
+    // 0x7C bar
+    4,18, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0x7D braceright
+    4,18, 0x1C,0x00,0x18,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x01,0xC0,0x07,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x06,0x00,0x70,0x00,
+    // 0x7E asciitilde
+    2,5, 0x3C,0x31,0x98,0xC6,0x33,0x18,0xCC,0x61,0xE0,
+    // 0xA0 nbspace
+    0,0,
+    // 0xA1 exclamdown
+    4,18, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0xA2 cent
+    7,17, 0x03,0x00,0x0C,0x00,0xFC,0x06,0xD8,0x33,0x30,0xCC,0x03,0x30,0x0C,0xC0,0x33,0x00,0xCC,0x03,0x30,0x0C,0xC0,0x33,0x30,0x6D,0x80,0xFC,0x00,0xC0,0x03,0x00,
+    // 0xA3 sterling
+    4,18, 0x07,0x80,0x33,0x01,0x86,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x3F,0x80,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x0C,0x38,0x30,0xFF,0xC0,
+    // 0xA4 currency
+    7,13, 0x60,0x18,0xC0,0xC1,0xFE,0x0C,0x0C,0x30,0x30,0xC0,0xC3,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC1,0xFE,0x0C,0x0C,0x60,0x18,
+    // 0xA5 yen
+    4,18, 0x60,0x19,0x80,0x63,0x03,0x0C,0x0C,0x18,0x60,0x61,0x80,0xCC,0x03,0x30,0x07,0x80,0x0C,0x00,0x30,0x0F,0xFC,0x03,0x00,0x0C,0x03,0xFF,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0xA6 brokenbar
+    4,18, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0xA7 section
+    3,20, 0x07,0x80,0x33,0x01,0x86,0x06,0x00,0x1C,0x00,0x3C,0x00,0xD8,0x06,0x30,0x18,0x60,0x61,0x81,0x86,0x06,0x18,0x0C,0x60,0x1B,0x00,0x3C,0x00,0x38,0x00,0x60,0x61,0x80,0xCC,0x01,0xE0,
+    // 0xA8 dieresis
+    0,3, 0x18,0xC0,0x63,0x01,0x8C,0x00,
+    // 0xA9 copyright
+    7,14, 0x3F,0xE1,0x80,0xCC,0xF9,0xB6,0x36,0xD8,0xDB,0x60,0x6D,0x81,0xB6,0x06,0xD8,0x1B,0x63,0x6D,0x8D,0xB3,0xE6,0x60,0x30,0xFF,0x80,
+    // 0xAA ordfeminine
+    1,13, 0x1F,0xC0,0x01,0x80,0x03,0x03,0xFC,0x18,0x30,0xC0,0xC3,0x03,0x0C,0x0C,0x18,0x30,0x3F,0xC0,0x00,0x00,0x00,0x3F,0xF0,
+    // 0xAB guillemotleft
+    9,13, 0x01,0x98,0x0C,0xC0,0x66,0x03,0x30,0x19,0x80,0xCC,0x06,0x60,0x0C,0xC0,0x19,0x80,0x33,0x00,0x66,0x00,0xCC,0x01,0x98,
+    // 0xAC logicalnot
+    10,7, 0x7F,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,
+    // 0xAD softhyphen
+    13,1, 0x3F,0xF0,
+    // 0xAE registered
+    7,14, 0x3F,0xE1,0x80,0xCD,0xF9,0xB6,0x36,0xD8,0xDB,0x63,0x6D,0x8D,0xB7,0xE6,0xDE,0x1B,0x6C,0x6D,0x99,0xB6,0x36,0x60,0x30,0xFF,0x80,
+    // 0xAF macron
+    1,1, 0x1F,0xC0,
+    // 0xB0 degree
+    2,7, 0x0F,0x80,0x63,0x01,0x8C,0x06,0x30,0x18,0xC0,0x63,0x00,0xF8,0x00,
+    // 0xB1 plusminus
+    7,15, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x01,0xFF,0xE0,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x80,
+    // 0xB2 twosuperior
+    2,10, 0x0F,0x80,0x63,0x01,0x8C,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0x7F,0x00,
+    // 0xB3 threesuperior
+    2,10, 0x0F,0x80,0x63,0x00,0x0C,0x00,0x30,0x07,0x80,0x03,0x00,0x0C,0x00,0x30,0x18,0xC0,0x3E,0x00,
+    // 0xB4 acute
+    0,3, 0x01,0x80,0x0C,0x00,0x60,0x00,
+    // 0xB5 mu
+    9,18, 0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x81,0xC6,0x0F,0x18,0x6C,0x7F,0x31,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x00,
+    // 0xB6 paragraph
+    4,18, 0x3F,0xF9,0x8C,0x66,0x31,0x98,0xC6,0x63,0x19,0x8C,0x66,0x31,0x98,0xC6,0x63,0x18,0xFC,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,
+    // 0xB7 periodcentered
+    12,4, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,
+    // 0xB8 cedilla
+    22,5, 0x06,0x00,0x18,0x00,0x60,0x03,0x00,0x18,0x00,
+    // 0xB9 onesuperior
+    2,10, 0x03,0x00,0x1C,0x00,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0xBA ordmasculine
+    1,13, 0x0F,0xC0,0x61,0x83,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC3,0x03,0x0C,0x0C,0x18,0x60,0x3F,0x00,0x00,0x00,0x00,0x3F,0xF0,
+    // 0xBB guillemotright
+    9,13, 0x66,0x00,0xCC,0x01,0x98,0x03,0x30,0x06,0x60,0x0C,0xC0,0x19,0x80,0xCC,0x06,0x60,0x33,0x01,0x98,0x0C,0xC0,0x66,0x00,
+    // 0xBC onequarter
+    4,18, 0x0C,0x00,0x70,0x03,0xC0,0x03,0x00,0x0C,0x10,0x30,0xC0,0xC6,0x03,0x30,0x01,0x80,0x0C,0xC0,0x67,0x03,0x3C,0x19,0xB0,0xCC,0xC6,0x63,0x11,0xFC,0x00,0x30,0x00,0xC0,
+    // 0xBD onehalf
+    4,18, 0x18,0x00,0xE0,0x07,0x81,0x06,0x0C,0x18,0x60,0x63,0x01,0x98,0x06,0xC0,0x06,0x00,0x30,0x01,0xBE,0x0D,0x8C,0x66,0x31,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x1F,0xC0,
+    // 0xBE threequarters
+    4,18, 0x3E,0x01,0x8C,0x00,0x30,0x07,0x80,0x03,0x08,0x0C,0x66,0x33,0x0F,0x98,0x00,0xC0,0x06,0x60,0x33,0x81,0x9E,0x0C,0xD8,0x66,0x63,0x31,0x98,0xFE,0x00,0x18,0x00,0x60,
+    // 0xBF questiondown
+    4,18, 0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x00,0x00,0x00,0x00,0x60,0x01,0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xC0 Agrave
+    0,22, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xC1 Aacute
+    0,22, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xC2 Acircumflex
+    0,22, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xC3 Atilde
+    0,22, 0x1C,0x60,0xDD,0x83,0x1C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xC4 Adieresis
+    0,22, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xC5 Aring
+    0,22, 0x07,0x80,0x33,0x00,0xCC,0x01,0xE0,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xFF,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xC6 AE
+    4,18, 0x3F,0xF9,0x8C,0x0C,0x30,0x30,0xC0,0xC3,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xFF,0xF3,0x0C,0x0C,0x30,0x30,0xC0,0xC3,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC3,0x03,0x0F,0xE0,
+    // 0xC7 Ccedilla
+    4,23, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,0x60,0x01,0x80,0x06,0x00,0x30,0x01,0x80,0x00,
+    // 0xC8 Egrave
+    0,22, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0x81,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0xC9 Eacute
+    0,22, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0x81,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0xCA Ecircumflex
+    0,22, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0x81,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0xCB Edieresis
+    0,22, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x7F,0xF1,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0x81,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0xC0,
+    // 0xCC Igrave
+    0,22, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x0F,0xC0,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0xCD Iacute
+    0,22, 0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x0F,0xC0,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0xCE Icircumflex
+    0,22, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x0F,0xC0,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0xCF Idieresis
+    0,22, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x0F,0xC0,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x3F,0x00,
+    // 0xD0 Eth
+    4,18, 0x7F,0x01,0x87,0x06,0x06,0x18,0x18,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0xFE,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x06,0x18,0x18,0x61,0xC1,0xFC,0x00,
+    // 0xD1 Ntilde
+    0,22, 0x1C,0x60,0xDD,0x83,0x1C,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0xC0,0xC7,0x83,0x1B,0x0C,0x66,0x31,0x8C,0xC6,0x1B,0x18,0x3C,0x60,0x71,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC0,
+    // 0xD2 Ograve
+    0,22, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xD3 Oacute
+    0,22, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xD4 Ocircumflex
+    0,22, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xD5 Otilde
+    0,22, 0x1C,0x60,0xDD,0x83,0x1C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xD6 Odieresis
+    0,22, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xD7 multiply
+    8,11, 0x60,0x18,0xC0,0xC1,0x86,0x03,0x30,0x07,0x80,0x0C,0x00,0x78,0x03,0x30,0x18,0x60,0xC0,0xC6,0x01,0x80,
+    // 0xD8 Oslash
+    4,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0E,0x60,0x31,0x81,0xC6,0x0F,0x18,0x6C,0x63,0x31,0x98,0xC6,0xC3,0x1E,0x0C,0x70,0x31,0x80,0xCE,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xD9 Ugrave
+    0,22, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xDA Uacute
+    0,22, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xDB Ucircumflex
+    0,22, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xDC Udieresis
+    0,22, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xDD Yacute
+    0,22, 0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x60,0x19,0x80,0x63,0x03,0x0C,0x0C,0x18,0x60,0x61,0x80,0xCC,0x03,0x30,0x07,0x80,0x1E,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,
+    // 0xDE Thorn
+    4,18, 0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x61,0xFF,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x00,
+    // 0xDF germandbls
+    4,18, 0x3F,0x81,0x83,0x06,0x06,0x18,0x18,0x60,0x61,0x81,0x86,0x0C,0x1F,0xF0,0x60,0x61,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x1C,0x0C,0x6C,0x61,0x9F,0x00,
+    // 0xE0 agrave
+    5,17, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xE1 aacute
+    5,17, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xE2 acircumflex
+    5,17, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xE3 atilde
+    5,17, 0x1C,0x60,0xDD,0x83,0x1C,0x00,0x00,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xE4 adieresis
+    5,17, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xE5 aring
+    5,17, 0x07,0x80,0x33,0x00,0xCC,0x01,0xE0,0x1F,0xC0,0x01,0x80,0x03,0x00,0x0C,0x1F,0xF0,0xC0,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xE6 ae
+    9,13, 0x7D,0xE0,0x1C,0xC0,0x31,0x80,0xC6,0x03,0x18,0xFC,0x66,0x3F,0xB0,0xC0,0xC3,0x03,0x0C,0x0C,0x30,0x18,0xE6,0x3E,0xF0,
+    // 0xE7 ccedilla
+    9,18, 0x1F,0xC0,0xC1,0x86,0x03,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x03,0x0C,0x18,0x1F,0xC0,0x18,0x00,0x60,0x01,0x80,0x0C,0x00,0x60,0x00,
+    // 0xE8 egrave
+    5,17, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC7,0xFF,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x0C,0x0C,0x1F,0xE0,
+    // 0xE9 eacute
+    5,17, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC7,0xFF,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x0C,0x0C,0x1F,0xE0,
+    // 0xEA ecircumflex
+    5,17, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC7,0xFF,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x0C,0x0C,0x1F,0xE0,
+    // 0xEB edieresis
+    5,17, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC7,0xFF,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x0C,0x0C,0x1F,0xE0,
+    // 0xEC igrave
+    5,17, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x0F,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x0F,0xC0,
+    // 0xED iacute
+    5,17, 0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x0F,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x0F,0xC0,
+    // 0xEE icircumflex
+    5,17, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x0F,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x0F,0xC0,
+    // 0xEF idieresis
+    5,17, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x0F,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x0F,0xC0,
+    // 0xF0 eth
+    4,18, 0x19,0x80,0x3C,0x01,0xE0,0x0C,0xC0,0x01,0x80,0x7F,0x03,0x06,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x30,0x60,0x7F,0x00,
+    // 0xF1 ntilde
+    5,17, 0x3C,0x61,0x99,0x86,0x3C,0x00,0x00,0x7F,0xC1,0x81,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x30,
+    // 0xF2 ograve
+    5,17, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0xF3 oacute
+    5,17, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0xF4 ocircumflex
+    5,17, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0xF5 otilde
+    5,17, 0x1C,0x60,0xDD,0x83,0x1C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0xF6 odieresis
+    5,17, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x1F,0xC0,0xC1,0x86,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x18,0x1F,0xC0,
+    // 0xF7 divide
+    7,13, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x07,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,
+    // 0xF8 oslash
+    9,13, 0x1F,0xD8,0xC1,0xE6,0x07,0x18,0x3C,0x61,0xB1,0x8C,0xC6,0x63,0x1B,0x0C,0x78,0x31,0xC0,0xC6,0x03,0x3C,0x18,0xDF,0xC0,
+    // 0xF9 ugrave
+    5,17, 0x0C,0x00,0x18,0x00,0x30,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xFA uacute
+    5,17, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xFB ucircumflex
+    5,17, 0x07,0x00,0x36,0x01,0x8C,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xFC udieresis
+    5,17, 0x18,0xC0,0x63,0x01,0x8C,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,
+    // 0xFD yacute
+    5,22, 0x01,0x80,0x0C,0x00,0x60,0x00,0x00,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x0C,0x0C,0x1F,0xF0,0x00,0xC0,0x03,0x00,0x0C,0x00,0x60,0xFF,0x00,
+    // 0xFE thorn
+    4,23, 0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x01,0xFF,0x06,0x06,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x31,0x80,0xC6,0x03,0x18,0x0C,0x60,0x61,0xFF,0x06,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x00,
+    // Padding (rows are read as 32 bit words)
+    0x00,0x00,0x00,
+};
+
 /*!
  * \brief Converted "Terminus Font", size 14x28, medium weight.
  */
 const struct Font Font_TerminASCII28 = {
     14,
     28,
-    (const uint16_t*[])
-    {
-        // char0
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100011110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111100011110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // space
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclam
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotedbl
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // numbersign
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b111111111110000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b111111111110000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dollar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1111111100000,
-            0b11001100110000,
-            0b110001100011000,
-            0b110001100000000,
-            0b110001100000000,
-            0b110001100000000,
-            0b110001100000000,
-            0b11001100000000,
-            0b1111111100000,
-            0b1100110000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b110001100011000,
-            0b11001100110000,
-            0b1111111100000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // percent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000110000,
-            0b110011000110000,
-            0b110011001100000,
-            0b110011001100000,
-            0b11110011000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b110011110000,
-            0b1100110011000,
-            0b1100110011000,
-            0b11000110011000,
-            0b11000011110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ampersand
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1100110000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b11000011000000,
-            0b1100110000000,
-            0b111100000000,
-            0b111000000000,
-            0b1101100011000,
-            0b11000110011000,
-            0b110000011110000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011110000,
-            0b11000110011000,
-            0b1111100011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotesingle
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1100000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b1100000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asterisk
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000110000,
-            0b1100001100000,
-            0b110011000000,
-            0b11110000000,
-            0b1100000000,
-            0b111111111111000,
-            0b1100000000,
-            0b11110000000,
-            0b110011000000,
-            0b1100001100000,
-            0b11000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111111111000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // comma
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // hyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // period
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // slash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // zero
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001110000,
-            0b110000011110000,
-            0b110000110110000,
-            0b110001100110000,
-            0b110011000110000,
-            0b110110000110000,
-            0b111100000110000,
-            0b111000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // one
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b11100000000,
-            0b111100000000,
-            0b1101100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // two
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00110000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // three
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // four
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00110000,
-            0b01110000,
-            0b11110000,
-            0b110110000,
-            0b1100110000,
-            0b11000110000,
-            0b110000110000,
-            0b1100000110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // five
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // six
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111100000,
-            0b11000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // seven
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eight
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // nine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // colon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // semicolon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // less
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00110000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b110000000,
-            0b11000000,
-            0b01100000,
-            0b00110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // equal
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // greater
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b110000000,
-            0b11000000,
-            0b01100000,
-            0b00110000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // question
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // at
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111100000,
-            0b11000000110000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000111111000,
-            0b110001100011000,
-            0b110011000011000,
-            0b110011000011000,
-            0b110011000011000,
-            0b110011000011000,
-            0b110011000011000,
-            0b110011000011000,
-            0b110001100011000,
-            0b110000111101000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000000000,
-            0b1111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // A
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // B
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // C
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // D
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b110000111000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000111000000,
-            0b111111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // E
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // F
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // G
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110001111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // H
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // I
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // J
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b11000011000000,
-            0b1111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // K
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000001100000,
-            0b110000011000000,
-            0b110000110000000,
-            0b110001100000000,
-            0b110011000000000,
-            0b110110000000000,
-            0b111100000000000,
-            0b111000000000000,
-            0b111000000000000,
-            0b111100000000000,
-            0b110110000000000,
-            0b110011000000000,
-            0b110001100000000,
-            0b110000110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // L
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // M
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b110000000011000,
-            0b111000000111000,
-            0b111100001111000,
-            0b110110011011000,
-            0b110110011011000,
-            0b110011110011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // N
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111000000110000,
-            0b111100000110000,
-            0b110110000110000,
-            0b110011000110000,
-            0b110001100110000,
-            0b110000110110000,
-            0b110000011110000,
-            0b110000001110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // O
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // P
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110001100110000,
-            0b11000111100000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // R
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b111100000000000,
-            0b110110000000000,
-            0b110011000000000,
-            0b110001100000000,
-            0b110000110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // S
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // T
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111111000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // U
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // V
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b110110000000,
-            0b110110000000,
-            0b110110000000,
-            0b11100000000,
-            0b11100000000,
-            0b11100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // W
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110011110011000,
-            0b110110011011000,
-            0b110110011011000,
-            0b111100001111000,
-            0b111000000111000,
-            0b110000000011000,
-            0b110000000011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // X
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b11000001100000,
-            0b1100011000000,
-            0b1100011000000,
-            0b110110000000,
-            0b110110000000,
-            0b11100000000,
-            0b11100000000,
-            0b110110000000,
-            0b110110000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b11000001100000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b110000000011000,
-            0b11000000110000,
-            0b11000000110000,
-            0b1100001100000,
-            0b1100001100000,
-            0b110011000000,
-            0b110011000000,
-            0b11110000000,
-            0b11110000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // backslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1100000000,
-            0b1100000000,
-            0b110000000,
-            0b110000000,
-            0b11000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciicircum
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1000000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // underscore
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // grave
-        (const uint16_t[])
-        {
-            0b1100000000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // a
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // b
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // c
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // d
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // e
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000110000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // f
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111110000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // g
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b11111111000000,
-            0b00000000,
-        },
-        // h
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // i
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // j
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b1100011000000,
-            0b111110000000,
-            0b00000000,
-        },
-        // k
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000110000,
-            0b11000001100000,
-            0b11000011000000,
-            0b11000110000000,
-            0b11001100000000,
-            0b11011000000000,
-            0b11110000000000,
-            0b11011000000000,
-            0b11001100000000,
-            0b11000110000000,
-            0b11000011000000,
-            0b11000001100000,
-            0b11000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // l
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // m
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100000,
-            0b110001100110000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // n
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // o
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // p
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-        },
-        // q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00000000,
-        },
-        // r
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110011111110000,
-            0b110110000000000,
-            0b111100000000000,
-            0b111000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // s
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // t
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // u
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // v
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b110110000000,
-            0b110110000000,
-            0b11100000000,
-            0b11100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // w
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110000000011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b11001100110000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // x
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1100011000000,
-            0b110110000000,
-            0b11100000000,
-            0b11100000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b11111111000000,
-            0b00000000,
-        },
-        // z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00110000,
-            0b01100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1110000000000,
-            0b1110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1100000000,
-            0b111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111000000,
-            0b111000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b1110000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciitilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11110000110000,
-            0b110011000110000,
-            0b110001100110000,
-            0b110001100110000,
-            0b110000111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // nbspace
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclamdown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b1101101100000,
-            0b11001100110000,
-            0b11001100000000,
-            0b11001100000000,
-            0b11001100000000,
-            0b11001100000000,
-            0b11001100000000,
-            0b11001100000000,
-            0b11001100000000,
-            0b11001100110000,
-            0b1101101100000,
-            0b111111000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // sterling
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b110011000000,
-            0b1100001100000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b11111110000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000110000,
-            0b11100000110000,
-            0b11111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // currency
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b11000000110000,
-            0b1111111100000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b1111111100000,
-            0b11000000110000,
-            0b110000000011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b110000000011000,
-            0b11000000110000,
-            0b11000000110000,
-            0b1100001100000,
-            0b1100001100000,
-            0b110011000000,
-            0b110011000000,
-            0b11110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11111111110000,
-            0b1100000000,
-            0b1100000000,
-            0b11111111110000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // brokenbar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // section
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b110011000000,
-            0b1100001100000,
-            0b1100000000000,
-            0b1110000000000,
-            0b111100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b1100001100000,
-            0b1100001100000,
-            0b1100001100000,
-            0b1100001100000,
-            0b110001100000,
-            0b11011000000,
-            0b1111000000,
-            0b11100000,
-            0b01100000,
-            0b1100001100000,
-            0b110011000000,
-            0b11110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dieresis
-        (const uint16_t[])
-        {
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // copyright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111100000,
-            0b110000000110000,
-            0b1100111110011000,
-            0b1101100011011000,
-            0b1101100011011000,
-            0b1101100000011000,
-            0b1101100000011000,
-            0b1101100000011000,
-            0b1101100000011000,
-            0b1101100011011000,
-            0b1101100011011000,
-            0b1100111110011000,
-            0b110000000110000,
-            0b11111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordfeminine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b111111110000,
-            0b1100000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b1100000110000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110011000,
-            0b1100110000,
-            0b11001100000,
-            0b110011000000,
-            0b1100110000000,
-            0b11001100000000,
-            0b110011000000000,
-            0b11001100000000,
-            0b1100110000000,
-            0b110011000000,
-            0b11001100000,
-            0b1100110000,
-            0b110011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // logicalnot
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // softhyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // registered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111100000,
-            0b110000000110000,
-            0b1101111110011000,
-            0b1101100011011000,
-            0b1101100011011000,
-            0b1101100011011000,
-            0b1101100011011000,
-            0b1101111110011000,
-            0b1101111000011000,
-            0b1101101100011000,
-            0b1101100110011000,
-            0b1101100011011000,
-            0b110000000110000,
-            0b11111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // macron
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // degree
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111110000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plusminus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111111111000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // twosuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111110000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111110000000,
-            0b1100011000000,
-            0b11000000,
-            0b11000000,
-            0b11110000000,
-            0b11000000,
-            0b11000000,
-            0b11000000,
-            0b1100011000000,
-            0b111110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // mu
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001110000,
-            0b110000011110000,
-            0b110000110110000,
-            0b111111100110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-        },
-        // paragraph
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b110001100011000,
-            0b11111100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // periodcentered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b00000000,
-        },
-        // onesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b11100000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordmasculine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111111000000,
-            0b1100001100000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b11000000110000,
-            0b1100001100000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110011000000000,
-            0b11001100000000,
-            0b1100110000000,
-            0b110011000000,
-            0b11001100000,
-            0b1100110000,
-            0b110011000,
-            0b1100110000,
-            0b11001100000,
-            0b110011000000,
-            0b1100110000000,
-            0b11001100000000,
-            0b110011000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onequarter
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b1110000000000,
-            0b11110000000000,
-            0b110000000000,
-            0b110000010000,
-            0b110000110000,
-            0b110001100000,
-            0b110011000000,
-            0b110000000,
-            0b1100110000,
-            0b11001110000,
-            0b110011110000,
-            0b1100110110000,
-            0b11001100110000,
-            0b110011000110000,
-            0b100011111110000,
-            0b00110000,
-            0b00110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onehalf
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b11100000000000,
-            0b111100000010000,
-            0b1100000110000,
-            0b1100001100000,
-            0b1100011000000,
-            0b1100110000000,
-            0b1101100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1101111100000,
-            0b11011000110000,
-            0b110011000110000,
-            0b100000001100000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b11111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threequarters
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111000000000,
-            0b110001100000000,
-            0b1100000000,
-            0b1111000000000,
-            0b1100001000,
-            0b1100011000,
-            0b110001100110000,
-            0b11111001100000,
-            0b11000000,
-            0b110011000,
-            0b1100111000,
-            0b11001111000,
-            0b110011011000,
-            0b1100110011000,
-            0b11001100011000,
-            0b110001111111000,
-            0b00011000,
-            0b00011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // questiondown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Agrave
-        (const uint16_t[])
-        {
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Acircumflex
-        (const uint16_t[])
-        {
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Atilde
-        (const uint16_t[])
-        {
-            0b1110001100000,
-            0b11011101100000,
-            0b11000111000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Adieresis
-        (const uint16_t[])
-        {
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aring
-        (const uint16_t[])
-        {
-            0b11110000000,
-            0b110011000000,
-            0b110011000000,
-            0b11110000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // AE
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111000,
-            0b110001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1111111111110000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b00000000,
-        },
-        // Egrave
-        (const uint16_t[])
-        {
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ecircumflex
-        (const uint16_t[])
-        {
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Edieresis
-        (const uint16_t[])
-        {
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111110000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Igrave
-        (const uint16_t[])
-        {
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b111111000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Iacute
-        (const uint16_t[])
-        {
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b00000000,
-            0b111111000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Icircumflex
-        (const uint16_t[])
-        {
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b111111000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Idieresis
-        (const uint16_t[])
-        {
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b111111000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000000,
-            0b110000111000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b1111111000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000111000000,
-            0b111111100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ntilde
-        (const uint16_t[])
-        {
-            0b1110001100000,
-            0b11011101100000,
-            0b11000111000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111000000110000,
-            0b111100000110000,
-            0b110110000110000,
-            0b110011000110000,
-            0b110001100110000,
-            0b110000110110000,
-            0b110000011110000,
-            0b110000001110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ograve
-        (const uint16_t[])
-        {
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ocircumflex
-        (const uint16_t[])
-        {
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Otilde
-        (const uint16_t[])
-        {
-            0b1110001100000,
-            0b11011101100000,
-            0b11000111000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Odieresis
-        (const uint16_t[])
-        {
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // multiply
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000011000,
-            0b11000000110000,
-            0b1100001100000,
-            0b110011000000,
-            0b11110000000,
-            0b1100000000,
-            0b11110000000,
-            0b110011000000,
-            0b1100001100000,
-            0b11000000110000,
-            0b110000000011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000111000,
-            0b110000000110000,
-            0b110000001110000,
-            0b110000011110000,
-            0b110000110110000,
-            0b110001100110000,
-            0b110011000110000,
-            0b110110000110000,
-            0b111100000110000,
-            0b111000000110000,
-            0b110000000110000,
-            0b1110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ugrave
-        (const uint16_t[])
-        {
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Uacute
-        (const uint16_t[])
-        {
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ucircumflex
-        (const uint16_t[])
-        {
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Udieresis
-        (const uint16_t[])
-        {
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Yacute
-        (const uint16_t[])
-        {
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b00000000,
-            0b110000000011000,
-            0b110000000011000,
-            0b11000000110000,
-            0b11000000110000,
-            0b1100001100000,
-            0b1100001100000,
-            0b110011000000,
-            0b110011000000,
-            0b11110000000,
-            0b11110000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // germandbls
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111110000000,
-            0b110000011000000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000001100000,
-            0b110000011000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111000000110000,
-            0b110110001100000,
-            0b110011111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // agrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // atilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110001100000,
-            0b11011101100000,
-            0b11000111000000,
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // adieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aring
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b110011000000,
-            0b110011000000,
-            0b11110000000,
-            0b1111111000000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b1111111110000,
-            0b11000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ae
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111110111100000,
-            0b11100110000,
-            0b1100011000,
-            0b1100011000,
-            0b1100011000,
-            0b11111100011000,
-            0b110001111111000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b1100001100000000,
-            0b110001110011000,
-            0b11111011110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b00000000,
-        },
-        // egrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000110000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000110000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ecircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000110000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // edieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b111111111110000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b11000000110000,
-            0b1111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // igrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // iacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000,
-            0b110000000,
-            0b1100000000,
-            0b00000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // icircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // idieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b111100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100110000000,
-            0b111100000000,
-            0b1111000000000,
-            0b11001100000000,
-            0b110000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ntilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110001100000,
-            0b110011001100000,
-            0b110001111000000,
-            0b00000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ograve
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ocircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // otilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110001100000,
-            0b11011101100000,
-            0b11000111000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // odieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b1111111000000,
-            0b11000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000001100000,
-            0b1111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // divide
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b111111111111000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111011000,
-            0b11000001111000,
-            0b110000001110000,
-            0b110000011110000,
-            0b110000110110000,
-            0b110001100110000,
-            0b110011000110000,
-            0b110110000110000,
-            0b111100000110000,
-            0b111000000110000,
-            0b110000000110000,
-            0b1111000001100000,
-            0b1101111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ugrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b11000000000,
-            0b1100000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // uacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ucircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000,
-            0b110110000000,
-            0b1100011000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // udieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b1100011000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b11000000110000,
-            0b1111111110000,
-            0b00110000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b11111111000000,
-            0b00000000,
-        },
-        // thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b111111111000000,
-            0b110000001100000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001100000,
-            0b111111111000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b110000000000000,
-            0b00000000,
-        },
-    }
+    0x00,
+    0xFE,
+    Font_TerminASCII28_Index,
+    Font_TerminASCII28_Bitmaps,
+    false
 };
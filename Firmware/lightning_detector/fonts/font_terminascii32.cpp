@@ -22,7 +22,7 @@
 //
 //  This file is additionally licensed under the SIL Open Font License, Version 1.1,
 //  because it embeds a subset of the Terminus Font, Version 4.49.1, as converted from
-//  the original font file for size 16x32 (medium weight) using the ArduinoGraphics library.
+//  the original font file for size 16x32 (medium weight) using 'tools/bdf2font.cpp'.
 //
 //  The Terminus Font Software itself is licensed under the SIL Open Font License, Version 1.1.
 //
@@ -35,6953 +35,425 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////
 */
 
+//
+//  Generated by 'tools/bdf2font.cpp'. Do not edit.
+//
+
+static const uint16_t Font_TerminASCII32_Index[] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x002A, 0x002C, 0x0056, 0x0064, 0x008E, 0x00C0, 0x00EA, 0x0114, 0x0122, 0x014C, 0x0176, 0x0190, 0x01AA, 0x01B8, 0x01BE, 0x01C8,
+    0x01F2, 0x021C, 0x0246, 0x0270, 0x029A, 0x02C4, 0x02EE, 0x0318, 0x0342, 0x036C, 0x0396, 0x03B4, 0x03D6, 0x0400, 0x0412, 0x043C,
+    0x0466, 0x0490, 0x04BA, 0x04E4, 0x050E, 0x0538, 0x0562, 0x058C, 0x05B6, 0x05E0, 0x060A, 0x0634, 0x065E, 0x0688, 0x06B2, 0x06DC,
+    0x0706, 0x0730, 0x075E, 0x0788, 0x07B2, 0x07DC, 0x0806, 0x0830, 0x085A, 0x0884, 0x08AE, 0x08D8, 0x0902, 0x092C, 0x0956, 0x0964,
+    0x096A, 0x0974, 0x0992, 0x09BC, 0x09DA, 0x0A04, 0x0A22, 0x0A4C, 0x0A74, 0x0A9E, 0x0AC8, 0x0AFC, 0x0B26, 0x0B50, 0x0B6E, 0x0B8C,
+    0x0BAA, 0x0BD2, 0x0BFA, 0x0C18, 0x0C36, 0x0C60, 0x0C7E, 0x0C9C, 0x0CBA, 0x0CD8, 0x0D00, 0x0D1E, 0x0D48, 0x0D72, 0x0D9C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0DAA, 0x0DAC, 0x0DD6, 0x0E00, 0x0E2A, 0x0E48, 0x0E72, 0x0E9C, 0x0ECC, 0x0ED6, 0x0EF8, 0x0F18, 0x0F36, 0x0F48, 0x0F4E, 0x0F70,
+    0x0F76, 0x0F88, 0x0FAA, 0x0FC2, 0x0FDA, 0x0FE4, 0x100C, 0x1036, 0x1040, 0x104C, 0x1064, 0x1084, 0x10A2, 0x10CC, 0x10F6, 0x1120,
+    0x114A, 0x117E, 0x11B2, 0x11E6, 0x121A, 0x124E, 0x1282, 0x12AC, 0x12E0, 0x1314, 0x1348, 0x137C, 0x13B0, 0x13E4, 0x1418, 0x144C,
+    0x1480, 0x14AA, 0x14DE, 0x1512, 0x1546, 0x157A, 0x15AE, 0x15E2, 0x15FA, 0x1624, 0x1658, 0x168C, 0x16C0, 0x16F4, 0x1728, 0x1752,
+    0x177C, 0x17A6, 0x17D0, 0x17FA, 0x1824, 0x184E, 0x1878, 0x1896, 0x18BE, 0x18E8, 0x1912, 0x193C, 0x1966, 0x1990, 0x19BA, 0x19E4,
+    0x1A0E, 0x1A38, 0x1A62, 0x1A8C, 0x1AB6, 0x1AE0, 0x1B0A, 0x1B34, 0x1B52, 0x1B70, 0x1B9A, 0x1BC4, 0x1BEE, 0x1C18, 0x1C4C,
+};
+
+static const uint8_t Font_TerminASCII32_Bitmaps[] = {
+    // 0x00 char0
+    6,20, 0x3C,0x3C,0x3C,0x3C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3C,0x3C,0x3C,0x3C,
+    // 0x20 space
+    0,0,
+    // 0x21 exclam
+    6,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x22 quotedbl
+    4,6, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,
+    // 0x23 numbersign
+    6,20, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,0xFC,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,0xFC,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,
+    // 0x24 dollar
+    4,24, 0x01,0x80,0x01,0x80,0x01,0x80,0x0F,0xF0,0x1F,0xF8,0x39,0x9C,0x31,0x8C,0x31,0x80,0x31,0x80,0x31,0x80,0x39,0x80,0x1F,0xF0,0x0F,0xF8,0x01,0x9C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x31,0x8C,0x39,0x9C,0x1F,0xF8,0x0F,0xF0,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x25 percent
+    6,20, 0x1E,0x18,0x3F,0x18,0x33,0x30,0x33,0x30,0x3F,0x60,0x1E,0x60,0x00,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x0C,0xF0,0x0D,0xF8,0x19,0x98,0x19,0x98,0x31,0xF8,0x30,0xF0,
+    // 0x26 ampersand
+    6,20, 0x0F,0x80,0x1F,0xC0,0x38,0xE0,0x30,0x60,0x30,0x60,0x30,0x60,0x38,0xE0,0x1D,0xC0,0x0F,0x80,0x0F,0x00,0x1F,0x8C,0x39,0xDC,0x70,0xF8,0x60,0x70,0x60,0x30,0x60,0x30,0x60,0x70,0x70,0xF8,0x3F,0xDC,0x1F,0x8C,
+    // 0x27 quotesingle
+    4,6, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x28 parenleft
+    6,20, 0x00,0x60,0x00,0xE0,0x01,0xC0,0x03,0x80,0x03,0x00,0x07,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x03,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x60,
+    // 0x29 parenright
+    6,20, 0x06,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xC0,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xE0,0x00,0xC0,0x01,0xC0,0x03,0x80,0x07,0x00,0x06,0x00,
+    // 0x2A asterisk
+    10,12, 0x38,0x38,0x1C,0x70,0x0E,0xE0,0x07,0xC0,0x03,0x80,0x7F,0xFC,0x7F,0xFC,0x03,0x80,0x07,0xC0,0x0E,0xE0,0x1C,0x70,0x38,0x38,
+    // 0x2B plus
+    10,12, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3F,0xFC,0x3F,0xFC,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x2C comma
+    22,6, 0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x80,0x03,0x00,0x06,0x00,
+    // 0x2D hyphen
+    15,2, 0x3F,0xFC,0x3F,0xFC,
+    // 0x2E period
+    22,4, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x2F slash
+    6,20, 0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,
+    // 0x30 zero
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x30,0x3C,0x30,0x7C,0x30,0xEC,0x31,0xCC,0x33,0x8C,0x37,0x0C,0x3E,0x0C,0x3C,0x0C,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x31 one
+    6,20, 0x01,0x80,0x03,0x80,0x07,0x80,0x0F,0x80,0x0D,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x0F,0xF0,0x0F,0xF0,
+    // 0x32 two
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x00,0x0C,0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0x33 three
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x1C,0x07,0xF8,0x07,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x34 four
+    6,20, 0x00,0x0C,0x00,0x1C,0x00,0x3C,0x00,0x7C,0x00,0xEC,0x01,0xCC,0x03,0x8C,0x07,0x0C,0x0E,0x0C,0x1C,0x0C,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,
+    // 0x35 five
+    6,20, 0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xF0,0x3F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xF8,0x0F,0xF0,
+    // 0x36 six
+    6,20, 0x0F,0xF8,0x1F,0xF8,0x38,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x37 seven
+    6,20, 0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x38 eight
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x39 nine
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x1C,0x1F,0xF8,0x1F,0xF0,
+    // 0x3A colon
+    12,14, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x3B semicolon
+    12,16, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x80,0x03,0x00,0x06,0x00,
+    // 0x3C less
+    6,20, 0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x70,0x00,0x38,0x00,0x1C,
+    // 0x3D equal
+    12,8, 0x3F,0xFC,0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0x3E greater
+    6,20, 0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x70,0x00,0x38,0x00,0x1C,0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,
+    // 0x3F question
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x40 at
+    6,20, 0x1F,0xF0,0x3F,0xF8,0x70,0x1C,0x60,0x0C,0x61,0xFC,0x63,0xFC,0x67,0x0C,0x66,0x0C,0x66,0x0C,0x66,0x0C,0x66,0x0C,0x66,0x0C,0x66,0x0C,0x67,0x1C,0x63,0xFC,0x61,0xEC,0x60,0x00,0x70,0x00,0x3F,0xFC,0x1F,0xFC,
+    // 0x41 A
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0x42 B
+    6,20, 0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x3F,0xF0,0x3F,0xF0,0x30,0x38,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,
+    // 0x43 C
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x44 D
+    6,20, 0x3F,0xC0,0x3F,0xF0,0x30,0x38,0x30,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x30,0x38,0x3F,0xF0,0x3F,0xC0,
+    // 0x45 E
+    6,20, 0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0x46 F
+    6,20, 0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // 0x47 G
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0xFC,0x30,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x48 H
+    6,20, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0x49 I
+    6,20, 0x07,0xE0,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0x4A J
+    6,20, 0x00,0x7E,0x00,0x7E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x38,0x38,0x1F,0xF0,0x0F,0xE0,
+    // 0x4B K
+    6,20, 0x30,0x0C,0x30,0x1C,0x30,0x38,0x30,0x70,0x30,0xE0,0x31,0xC0,0x33,0x80,0x37,0x00,0x3E,0x00,0x3C,0x00,0x3C,0x00,0x3E,0x00,0x37,0x00,0x33,0x80,0x31,0xC0,0x30,0xE0,0x30,0x70,0x30,0x38,0x30,0x1C,0x30,0x0C,
+    // 0x4C L
+    6,20, 0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0x4D M
+    6,20, 0x60,0x0C,0x60,0x0C,0x70,0x1C,0x78,0x3C,0x6C,0x6C,0x6C,0x6C,0x67,0xCC,0x63,0x8C,0x63,0x8C,0x61,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,
+    // 0x4E N
+    6,20, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x3C,0x0C,0x3E,0x0C,0x37,0x0C,0x33,0x8C,0x31,0xCC,0x30,0xEC,0x30,0x7C,0x30,0x3C,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0x4F O
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x50 P
+    6,20, 0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // 0x51 Q
+    6,22, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x31,0xCC,0x38,0xFC,0x1F,0xF8,0x0F,0xF8,0x00,0x1C,0x00,0x0E,
+    // 0x52 R
+    6,20, 0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,0x37,0x00,0x33,0x80,0x31,0xC0,0x30,0xE0,0x30,0x70,0x30,0x38,0x30,0x1C,0x30,0x0C,
+    // 0x53 S
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x00,0x1F,0xF0,0x0F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x54 T
+    6,20, 0x3F,0xFC,0x3F,0xFC,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x55 U
+    6,20, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x56 V
+    6,20, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x06,0x60,0x03,0xC0,0x03,0xC0,0x03,0xC0,
+    // 0x57 W
+    6,20, 0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x61,0x0C,0x63,0x8C,0x63,0x8C,0x67,0xCC,0x6C,0x6C,0x6C,0x6C,0x78,0x3C,0x70,0x1C,0x60,0x0C,0x60,0x0C,
+    // 0x58 X
+    6,20, 0x30,0x0C,0x30,0x0C,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x06,0x60,0x06,0x60,0x0C,0x30,0x0C,0x30,0x18,0x18,0x18,0x18,0x30,0x0C,0x30,0x0C,
+    // 0x59 Y
+    6,20, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x03,0xC0,0x03,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x5A Z
+    6,20, 0x3F,0xFC,0x3F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0x5B bracketleft
+    6,20, 0x0F,0xE0,0x0F,0xE0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0F,0xE0,0x0F,0xE0,
+    // 0x5C backslash
+    6,20, 0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,
+    // 0x5D bracketright
+    6,20, 0x0F,0xE0,0x0F,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x0F,0xE0,0x0F,0xE0,
+    // 0x5E asciicircum
+    4,6, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x1C,0x38,0x38,0x1C,
+    // 0x5F underscore
+    27,2, 0x3F,0xFC,0x3F,0xFC,
+    // 0x60 grave
+    2,4, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,
+    // 0x61 a
+    12,14, 0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0x62 b
+    6,20, 0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,
+    // 0x63 c
+    12,14, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x64 d
+    6,20, 0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0x65 e
+    12,14, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x0C,0x1F,0xFC,0x0F,0xF8,
+    // 0x66 f
+    6,20, 0x00,0x7E,0x00,0xFE,0x01,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0xF8,0x1F,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x67 g
+    12,19, 0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x1C,0x1F,0xF8,0x1F,0xF0,
+    // 0x68 h
+    6,20, 0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0x69 i
+    6,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0x6A j
+    6,25, 0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x18,0x18,0x18,0x18,0x1C,0x38,0x0F,0xF0,0x07,0xE0,
+    // 0x6B k
+    6,20, 0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x1C,0x18,0x38,0x18,0x70,0x18,0xE0,0x19,0xC0,0x1B,0x80,0x1F,0x00,0x1F,0x00,0x1B,0x80,0x19,0xC0,0x18,0xE0,0x18,0x70,0x18,0x38,0x18,0x1C,
+    // 0x6C l
+    6,20, 0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0x6D m
+    12,14, 0x3F,0xF0,0x3F,0xF8,0x31,0x9C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,
+    // 0x6E n
+    12,14, 0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0x6F o
+    12,14, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x70 p
+    12,19, 0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // 0x71 q
+    12,19, 0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,
+    // 0x72 r
+    12,14, 0x33,0xFC,0x37,0xFC,0x3E,0x00,0x3C,0x00,0x38,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // 0x73 s
+    12,14, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x00,0x30,0x00,0x38,0x00,0x1F,0xF0,0x0F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0x74 t
+    6,20, 0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x3F,0xF0,0x3F,0xF0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x80,0x01,0xFC,0x00,0xFC,
+    // 0x75 u
+    12,14, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0x76 v
+    12,14, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x18,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x03,0xC0,0x03,0xC0,0x03,0xC0,
+    // 0x77 w
+    12,14, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x39,0x9C,0x1F,0xF8,0x0F,0xF0,
+    // 0x78 x
+    12,14, 0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1C,0x38,0x0E,0x70,0x07,0xE0,0x03,0xC0,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x1C,0x38,0x38,0x1C,0x30,0x0C,0x30,0x0C,
+    // 0x79 y
+    12,19, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x1C,0x1F,0xF8,0x1F,0xF0,
+    // 0x7A z
+    12,14, 0x3F,0xFC,0x3F,0xFC,0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0x7B braceleft
+    6,20, 0x00,0xF0,0x01,0xF0,0x03,0x80,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1E,0x00,0x1E,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x80,0x01,0xF0,0x00,0xF0,
+    // 0x7C bar
+    6,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0x7D braceright
+    6,20, 0x1E,0x00,0x1F,0x00,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0xF0,0x00,0xF0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x80,0x1F,0x00,0x1E,0x00,
+    // 0x7E asciitilde
+    4,6, 0x0E,0x0C,0x1F,0x0C,0x3B,0x8C,0x31,0xDC,0x30,0xF8,0x30,0x70,
+    // 0xA0 nbspace
+    0,0,
+    // 0xA1 exclamdown
+    6,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0xA2 cent
+    9,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x0F,0xF0,0x1F,0xF8,0x39,0x9C,0x31,0x8C,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x8C,0x39,0x9C,0x1F,0xF8,0x0F,0xF0,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0xA3 sterling
+    6,20, 0x03,0xE0,0x07,0xF0,0x0E,0x38,0x0C,0x18,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0xE0,0x3F,0xE0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x0C,0x0C,0x0C,0x3F,0xFC,0x3F,0xFC,
+    // 0xA4 currency
+    9,14, 0x38,0x1C,0x1C,0x38,0x0F,0xF0,0x0F,0xF0,0x1C,0x38,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1C,0x38,0x0F,0xF0,0x0F,0xF0,0x1C,0x38,0x38,0x1C,
+    // 0xA5 yen
+    6,20, 0x30,0x0C,0x30,0x0C,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x03,0xC0,0x03,0xC0,0x01,0x80,0x01,0x80,0x1F,0xF8,0x1F,0xF8,0x01,0x80,0x01,0x80,0x1F,0xF8,0x1F,0xF8,0x01,0x80,0x01,0x80,
+    // 0xA6 brokenbar
+    6,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0xA7 section
+    4,23, 0x07,0xC0,0x0F,0xE0,0x1C,0x70,0x18,0x30,0x18,0x00,0x1C,0x00,0x0F,0x80,0x0F,0xC0,0x18,0xE0,0x18,0x70,0x18,0x30,0x18,0x30,0x18,0x30,0x1C,0x30,0x0E,0x30,0x07,0xE0,0x03,0xE0,0x00,0x70,0x00,0x30,0x18,0x30,0x1C,0x70,0x0F,0xE0,0x07,0xC0,
+    // 0xA8 dieresis
+    1,4, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,
+    // 0xA9 copyright
+    8,16, 0x1F,0xF8,0x3F,0xFC,0x70,0x0E,0x67,0xE6,0x6F,0xF6,0x6C,0x36,0x6C,0x06,0x6C,0x06,0x6C,0x06,0x6C,0x06,0x6C,0x36,0x6F,0xF6,0x67,0xE6,0x70,0x0E,0x3F,0xFC,0x1F,0xF8,
+    // 0xAA ordfeminine
+    2,15, 0x0F,0xE0,0x0F,0xF0,0x00,0x38,0x00,0x18,0x07,0xF8,0x0F,0xF8,0x1C,0x18,0x18,0x18,0x1C,0x18,0x0F,0xF8,0x07,0xF8,0x00,0x00,0x00,0x00,0x1F,0xF8,0x1F,0xF8,
+    // 0xAB guillemotleft
+    12,14, 0x01,0xCE,0x03,0x9C,0x07,0x38,0x0E,0x70,0x1C,0xE0,0x39,0xC0,0x73,0x80,0x73,0x80,0x39,0xC0,0x1C,0xE0,0x0E,0x70,0x07,0x38,0x03,0x9C,0x01,0xCE,
+    // 0xAC logicalnot
+    12,8, 0x3F,0xFC,0x3F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,
+    // 0xAD softhyphen
+    15,2, 0x1F,0xF8,0x1F,0xF8,
+    // 0xAE registered
+    8,16, 0x1F,0xF8,0x3F,0xFC,0x70,0x0E,0x6F,0xE6,0x6F,0xF6,0x6C,0x36,0x6C,0x36,0x6C,0x36,0x6F,0xE6,0x6F,0xC6,0x6D,0xC6,0x6C,0xE6,0x6C,0x76,0x70,0x0E,0x3F,0xFC,0x1F,0xF8,
+    // 0xAF macron
+    2,2, 0x0F,0xF0,0x0F,0xF0,
+    // 0xB0 degree
+    4,8, 0x07,0xE0,0x0F,0xF0,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0F,0xF0,0x07,0xE0,
+    // 0xB1 plusminus
+    10,16, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3F,0xFC,0x3F,0xFC,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0xB2 twosuperior
+    3,11, 0x07,0xE0,0x0F,0xF0,0x0C,0x30,0x0C,0x30,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0xF0,0x0F,0xF0,
+    // 0xB3 threesuperior
+    3,11, 0x07,0xE0,0x0F,0xF0,0x0C,0x30,0x00,0x30,0x01,0xE0,0x01,0xE0,0x00,0x30,0x00,0x30,0x0C,0x30,0x0F,0xF0,0x07,0xE0,
+    // 0xB4 acute
+    1,4, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,
+    // 0xB5 mu
+    12,19, 0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x30,0x3C,0x30,0x7C,0x3F,0xEC,0x3F,0xCC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // 0xB6 paragraph
+    6,20, 0x1F,0xFC,0x3F,0xFC,0x71,0x8C,0x61,0x8C,0x61,0x8C,0x61,0x8C,0x61,0x8C,0x61,0x8C,0x71,0x8C,0x3F,0x8C,0x1F,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,
+    // 0xB7 periodcentered
+    14,4, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0xB8 cedilla
+    26,5, 0x01,0x80,0x01,0x80,0x03,0x80,0x03,0x00,0x06,0x00,
+    // 0xB9 onesuperior
+    3,11, 0x01,0x80,0x03,0x80,0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xBA ordmasculine
+    2,15, 0x07,0xE0,0x0F,0xF0,0x1C,0x38,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1C,0x38,0x0F,0xF0,0x07,0xE0,0x00,0x00,0x00,0x00,0x1F,0xF8,0x1F,0xF8,
+    // 0xBB guillemotright
+    12,14, 0x73,0x80,0x39,0xC0,0x1C,0xE0,0x0E,0x70,0x07,0x38,0x03,0x9C,0x01,0xCE,0x01,0xCE,0x03,0x9C,0x07,0x38,0x0E,0x70,0x1C,0xE0,0x39,0xC0,0x73,0x80,
+    // 0xBC onequarter
+    6,20, 0x0C,0x00,0x1C,0x00,0x3C,0x00,0x0C,0x00,0x0C,0x06,0x0C,0x0E,0x0C,0x1C,0x0C,0x38,0x0C,0x70,0x00,0xE0,0x01,0xC6,0x03,0x8E,0x07,0x1E,0x0E,0x36,0x1C,0x66,0x38,0xC6,0x71,0xFE,0x61,0xFE,0x00,0x06,0x00,0x06,
+    // 0xBD onehalf
+    6,20, 0x18,0x00,0x38,0x00,0x78,0x06,0x18,0x0E,0x18,0x1C,0x18,0x38,0x18,0x70,0x18,0xE0,0x19,0xC0,0x03,0x80,0x07,0x00,0x0E,0x7C,0x1C,0xFE,0x38,0xC6,0x70,0xC6,0x60,0x0C,0x00,0x18,0x00,0x30,0x00,0x7E,0x00,0xFE,
+    // 0xBE threequarters
+    6,20, 0x3F,0x00,0x7F,0x80,0x61,0x80,0x0F,0x00,0x0F,0x00,0x01,0x86,0x61,0x8E,0x7F,0x9C,0x3F,0x38,0x00,0x70,0x00,0xE6,0x01,0xCE,0x03,0x9E,0x07,0x36,0x0E,0x66,0x1C,0xC6,0x39,0xFE,0x71,0xFE,0x60,0x06,0x00,0x06,
+    // 0xBF questiondown
+    6,20, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xC0 Agrave
+    1,25, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xC1 Aacute
+    1,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xC2 Acircumflex
+    1,25, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xC3 Atilde
+    1,25, 0x0F,0x18,0x1B,0x98,0x19,0xD8,0x18,0xF0,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xC4 Adieresis
+    1,25, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xC5 Aring
+    1,25, 0x03,0xC0,0x06,0x60,0x06,0x60,0x06,0x60,0x03,0xC0,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xC6 AE
+    6,20, 0x1F,0xFF,0x3F,0xFF,0x70,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x7F,0xFE,0x7F,0xFE,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xFF,0x60,0xFF,
+    // 0xC7 Ccedilla
+    6,25, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,0x01,0x80,0x01,0x80,0x03,0x80,0x03,0x00,0x06,0x00,
+    // 0xC8 Egrave
+    1,25, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0xC9 Eacute
+    1,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0xCA Ecircumflex
+    1,25, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0xCB Edieresis
+    1,25, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xE0,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xFC,0x3F,0xFC,
+    // 0xCC Igrave
+    1,25, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x07,0xE0,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xCD Iacute
+    1,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x07,0xE0,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xCE Icircumflex
+    1,25, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x07,0xE0,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xCF Idieresis
+    1,25, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x07,0xE0,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xD0 Eth
+    6,20, 0x3F,0xC0,0x3F,0xF0,0x30,0x38,0x30,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x7F,0x8C,0x7F,0x8C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x30,0x38,0x3F,0xF0,0x3F,0xC0,
+    // 0xD1 Ntilde
+    1,25, 0x0F,0x18,0x1B,0x98,0x19,0xD8,0x18,0xF0,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x3C,0x0C,0x3E,0x0C,0x37,0x0C,0x33,0x8C,0x31,0xCC,0x30,0xEC,0x30,0x7C,0x30,0x3C,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xD2 Ograve
+    1,25, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xD3 Oacute
+    1,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xD4 Ocircumflex
+    1,25, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xD5 Otilde
+    1,25, 0x0F,0x18,0x1B,0x98,0x19,0xD8,0x18,0xF0,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xD6 Odieresis
+    1,25, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xD7 multiply
+    11,11, 0x70,0x1C,0x38,0x38,0x1C,0x70,0x0E,0xE0,0x07,0xC0,0x03,0x80,0x07,0xC0,0x0E,0xE0,0x1C,0x70,0x38,0x38,0x70,0x1C,
+    // 0xD8 Oslash
+    6,20, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0E,0x30,0x0E,0x30,0x1C,0x30,0x3C,0x30,0x7C,0x30,0xEC,0x31,0xCC,0x33,0x8C,0x37,0x0C,0x3E,0x0C,0x3C,0x0C,0x38,0x0C,0x70,0x0C,0x70,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xD9 Ugrave
+    1,25, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xDA Uacute
+    1,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xDB Ucircumflex
+    1,25, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xDC Udieresis
+    1,25, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xDD Yacute
+    1,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x03,0xC0,0x03,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0xDE Thorn
+    6,20, 0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // 0xDF germandbls
+    6,20, 0x1F,0xE0,0x3F,0xF0,0x30,0x38,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x30,0x3F,0xF0,0x3F,0xF0,0x30,0x38,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x3C,0x1C,0x37,0xF8,0x33,0xF0,
+    // 0xE0 agrave
+    6,20, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x00,0x00,0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xE1 aacute
+    6,20, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xE2 acircumflex
+    6,20, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x00,0x00,0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xE3 atilde
+    6,20, 0x0F,0x18,0x1B,0x98,0x19,0xD8,0x18,0xF0,0x00,0x00,0x00,0x00,0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xE4 adieresis
+    6,20, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x00,0x00,0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xE5 aring
+    6,20, 0x03,0xC0,0x06,0x60,0x06,0x60,0x06,0x60,0x03,0xC0,0x00,0x00,0x1F,0xF0,0x1F,0xF8,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x0F,0xFC,0x1F,0xFC,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xE6 ae
+    12,14, 0x3E,0xF8,0x3F,0xFC,0x01,0x8E,0x01,0x86,0x01,0x86,0x1F,0x86,0x3F,0xFE,0x71,0xFE,0x61,0x80,0x61,0x80,0x61,0x80,0x71,0xC6,0x3F,0xFE,0x1F,0x7C,
+    // 0xE7 ccedilla
+    12,19, 0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,0x01,0x80,0x01,0x80,0x03,0x80,0x03,0x00,0x06,0x00,
+    // 0xE8 egrave
+    6,20, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x0C,0x1F,0xFC,0x0F,0xF8,
+    // 0xE9 eacute
+    6,20, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x0C,0x1F,0xFC,0x0F,0xF8,
+    // 0xEA ecircumflex
+    6,20, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x0C,0x1F,0xFC,0x0F,0xF8,
+    // 0xEB edieresis
+    6,20, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x3F,0xFC,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x0C,0x1F,0xFC,0x0F,0xF8,
+    // 0xEC igrave
+    6,20, 0x1C,0x00,0x0E,0x00,0x07,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xED iacute
+    6,20, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xEE icircumflex
+    6,20, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xEF idieresis
+    6,20, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x07,0xE0,
+    // 0xF0 eth
+    6,20, 0x1D,0xC0,0x0F,0x80,0x1F,0x00,0x3B,0x80,0x01,0xC0,0x00,0xE0,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xF1 ntilde
+    6,20, 0x0F,0x18,0x1B,0x98,0x19,0xD8,0x18,0xF0,0x00,0x00,0x00,0x00,0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,
+    // 0xF2 ograve
+    6,20, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xF3 oacute
+    6,20, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xF4 ocircumflex
+    6,20, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xF5 otilde
+    6,20, 0x0F,0x18,0x1B,0x98,0x19,0xD8,0x18,0xF0,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xF6 odieresis
+    6,20, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x00,0x00,0x0F,0xF0,0x1F,0xF8,0x38,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x1C,0x1F,0xF8,0x0F,0xF0,
+    // 0xF7 divide
+    9,14, 0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+    // 0xF8 oslash
+    12,14, 0x0F,0xF6,0x1F,0xFE,0x38,0x1C,0x30,0x3C,0x30,0x7C,0x30,0xEC,0x31,0xCC,0x33,0x8C,0x37,0x0C,0x3E,0x0C,0x3C,0x0C,0x38,0x1C,0x7F,0xF8,0x6F,0xF0,
+    // 0xF9 ugrave
+    6,20, 0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xFA uacute
+    6,20, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xFB ucircumflex
+    6,20, 0x01,0x80,0x03,0xC0,0x07,0xE0,0x0E,0x70,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xFC udieresis
+    6,20, 0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,
+    // 0xFD yacute
+    6,25, 0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x38,0x0C,0x1F,0xFC,0x0F,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x1C,0x1F,0xF8,0x1F,0xF0,
+    // 0xFE thorn
+    6,25, 0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3F,0xF0,0x3F,0xF8,0x30,0x1C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x3F,0xF8,0x3F,0xF0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+    // Padding (rows are read as 32 bit words)
+    0x00,0x00,0x00,
+};
+
 /*!
  * \brief Converted "Terminus Font", size 16x32, medium weight.
  */
 const struct Font Font_TerminASCII32 = {
     16,
     32,
-    (const uint16_t*[])
-    {
-        // char0
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000111100,
-            0b11110000111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11110000111100,
-            0b11110000111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // space
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclam
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotedbl
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // numbersign
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b11111111111100,
-            0b11111111111100,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b11111111111100,
-            0b11111111111100,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dollar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100110011100,
-            0b11000110001100,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11100110000000,
-            0b1111111110000,
-            0b111111111000,
-            0b110011100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b11000110001100,
-            0b11100110011100,
-            0b1111111111000,
-            0b111111110000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // percent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111000011000,
-            0b11111100011000,
-            0b11001100110000,
-            0b11001100110000,
-            0b11111101100000,
-            0b1111001100000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110011110000,
-            0b110111111000,
-            0b1100110011000,
-            0b1100110011000,
-            0b11000111111000,
-            0b11000011110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ampersand
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111110000000,
-            0b1111111000000,
-            0b11100011100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b11000001100000,
-            0b11100011100000,
-            0b1110111000000,
-            0b111110000000,
-            0b111100000000,
-            0b1111110001100,
-            0b11100111011100,
-            0b111000011111000,
-            0b110000001110000,
-            0b110000000110000,
-            0b110000000110000,
-            0b110000001110000,
-            0b111000011111000,
-            0b11111111011100,
-            0b1111110001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // quotesingle
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01100000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b1100000000,
-            0b11100000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11000000000,
-            0b11100000000,
-            0b1100000000,
-            0b1110000000,
-            0b111000000,
-            0b11100000,
-            0b01100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // parenright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b11000000,
-            0b11100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b11100000,
-            0b11000000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asterisk
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000111000,
-            0b1110001110000,
-            0b111011100000,
-            0b11111000000,
-            0b1110000000,
-            0b111111111111100,
-            0b111111111111100,
-            0b1110000000,
-            0b11111000000,
-            0b111011100000,
-            0b1110001110000,
-            0b11100000111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // comma
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b1110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // hyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // period
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // slash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00011000,
-            0b00011000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b1100000000,
-            0b11000000000,
-            0b11000000000,
-            0b110000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // zero
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11000000111100,
-            0b11000001111100,
-            0b11000011101100,
-            0b11000111001100,
-            0b11001110001100,
-            0b11011100001100,
-            0b11111000001100,
-            0b11110000001100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // one
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1110000000,
-            0b11110000000,
-            0b111110000000,
-            0b110110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b111111110000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // two
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00001100,
-            0b00011100,
-            0b00111000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111000000000,
-            0b1110000000000,
-            0b11100000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // three
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00011100,
-            0b11111111000,
-            0b11111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // four
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00001100,
-            0b00011100,
-            0b00111100,
-            0b01111100,
-            0b11101100,
-            0b111001100,
-            0b1110001100,
-            0b11100001100,
-            0b111000001100,
-            0b1110000001100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // five
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // six
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111000,
-            0b1111111111000,
-            0b11100000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // seven
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011000,
-            0b00011000,
-            0b00110000,
-            0b00110000,
-            0b01100000,
-            0b01100000,
-            0b11000000,
-            0b11000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eight
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // nine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00011100,
-            0b1111111111000,
-            0b1111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // colon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // semicolon
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b1110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // less
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00011100,
-            0b00111000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111000000000,
-            0b1110000000000,
-            0b11100000000000,
-            0b11100000000000,
-            0b1110000000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b11100000,
-            0b01110000,
-            0b00111000,
-            0b00011100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // equal
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // greater
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000000000,
-            0b1110000000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b11100000,
-            0b01110000,
-            0b00111000,
-            0b00011100,
-            0b00011100,
-            0b00111000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111000000000,
-            0b1110000000000,
-            0b11100000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // question
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00011100,
-            0b00111000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // at
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b11111111111000,
-            0b111000000011100,
-            0b110000000001100,
-            0b110000111111100,
-            0b110001111111100,
-            0b110011100001100,
-            0b110011000001100,
-            0b110011000001100,
-            0b110011000001100,
-            0b110011000001100,
-            0b110011000001100,
-            0b110011000001100,
-            0b110011100011100,
-            0b110001111111100,
-            0b110000111101100,
-            0b110000000000000,
-            0b111000000000000,
-            0b11111111111100,
-            0b1111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // A
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // B
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011000,
-            0b11111111110000,
-            0b11111111110000,
-            0b11000000111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // C
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // D
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111000000,
-            0b11111111110000,
-            0b11000000111000,
-            0b11000000011000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011000,
-            0b11000000111000,
-            0b11111111110000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // E
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // F
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // G
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000011111100,
-            0b11000011111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // H
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // I
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000,
-            0b11111100000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // J
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01111110,
-            0b01111110,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b11000000011000,
-            0b11000000011000,
-            0b11000000011000,
-            0b11100000111000,
-            0b1111111110000,
-            0b111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // K
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000011100,
-            0b11000000111000,
-            0b11000001110000,
-            0b11000011100000,
-            0b11000111000000,
-            0b11001110000000,
-            0b11011100000000,
-            0b11111000000000,
-            0b11110000000000,
-            0b11110000000000,
-            0b11111000000000,
-            0b11011100000000,
-            0b11001110000000,
-            0b11000111000000,
-            0b11000011100000,
-            0b11000001110000,
-            0b11000000111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // L
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // M
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000001100,
-            0b110000000001100,
-            0b111000000011100,
-            0b111100000111100,
-            0b110110001101100,
-            0b110110001101100,
-            0b110011111001100,
-            0b110001110001100,
-            0b110001110001100,
-            0b110000100001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // N
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b11110000001100,
-            0b11111000001100,
-            0b11011100001100,
-            0b11001110001100,
-            0b11000111001100,
-            0b11000011101100,
-            0b11000001111100,
-            0b11000000111100,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // O
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // P
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000111001100,
-            0b11100011111100,
-            0b1111111111000,
-            0b111111111000,
-            0b00011100,
-            0b00001110,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // R
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b11011100000000,
-            0b11001110000000,
-            0b11000111000000,
-            0b11000011100000,
-            0b11000001110000,
-            0b11000000111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // S
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000000000,
-            0b1111111110000,
-            0b111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // T
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // U
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // V
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b1111000000,
-            0b1111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // W
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000000001100,
-            0b110000100001100,
-            0b110001110001100,
-            0b110001110001100,
-            0b110011111001100,
-            0b110110001101100,
-            0b110110001101100,
-            0b111100000111100,
-            0b111000000011100,
-            0b110000000001100,
-            0b110000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // X
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b1100000011000,
-            0b1100000011000,
-            0b110000110000,
-            0b110000110000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b1111000000,
-            0b1111000000,
-            0b1111000000,
-            0b11001100000,
-            0b11001100000,
-            0b110000110000,
-            0b110000110000,
-            0b1100000011000,
-            0b1100000011000,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b1100000011000,
-            0b1100000011000,
-            0b110000110000,
-            0b110000110000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b1111000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00011100,
-            0b00111000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111000000000,
-            0b1110000000000,
-            0b11100000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000,
-            0b111111100000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b111111100000,
-            0b111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // backslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11000000000,
-            0b11000000000,
-            0b1100000000,
-            0b1100000000,
-            0b110000000,
-            0b110000000,
-            0b11000000,
-            0b11000000,
-            0b01100000,
-            0b01100000,
-            0b00110000,
-            0b00110000,
-            0b00011000,
-            0b00011000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bracketright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111100000,
-            0b111111100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b01100000,
-            0b111111100000,
-            0b111111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciicircum
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b1110000111000,
-            0b11100000011100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // underscore
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // grave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // a
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // b
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // c
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // d
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // e
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // f
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01111110,
-            0b11111110,
-            0b111000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b1111111111000,
-            0b1111111111000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // g
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00001100,
-            0b00001100,
-            0b00011100,
-            0b1111111111000,
-            0b1111111110000,
-            0b00000000,
-        },
-        // h
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // i
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // j
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00000000,
-            0b00000000,
-            0b01111000,
-            0b01111000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b00011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1110000111000,
-            0b111111110000,
-            0b11111100000,
-            0b00000000,
-        },
-        // k
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000000000,
-            0b1100000011100,
-            0b1100000111000,
-            0b1100001110000,
-            0b1100011100000,
-            0b1100111000000,
-            0b1101110000000,
-            0b1111100000000,
-            0b1111100000000,
-            0b1101110000000,
-            0b1100111000000,
-            0b1100011100000,
-            0b1100001110000,
-            0b1100000111000,
-            0b1100000011100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // l
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // m
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000110011100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // n
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // o
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // p
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-        },
-        // q
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00000000,
-        },
-        // r
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11001111111100,
-            0b11011111111100,
-            0b11111000000000,
-            0b11110000000000,
-            0b11100000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // s
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000000000,
-            0b1111111110000,
-            0b111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // t
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b11111111110000,
-            0b11111111110000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1110000000,
-            0b111111100,
-            0b11111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // u
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // v
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b1111000000,
-            0b1111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // w
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11000110001100,
-            0b11100110011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // x
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1110000111000,
-            0b111001110000,
-            0b11111100000,
-            0b1111000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b1110000111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // y
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00001100,
-            0b00001100,
-            0b00011100,
-            0b1111111111000,
-            0b1111111110000,
-            0b00000000,
-        },
-        // z
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00011100,
-            0b00111000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111000000000,
-            0b1110000000000,
-            0b11100000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11110000,
-            0b111110000,
-            0b1110000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1111000000000,
-            0b1111000000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1100000000,
-            0b1110000000,
-            0b111110000,
-            0b11110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // bar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // braceright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111000000000,
-            0b1111100000000,
-            0b1110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11110000,
-            0b11110000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b1110000000,
-            0b1111100000000,
-            0b1111000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // asciitilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000001100,
-            0b1111100001100,
-            0b11101110001100,
-            0b11000111011100,
-            0b11000011111000,
-            0b11000001110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        nullptr,
-        // nbspace
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // exclamdown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cent
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100110011100,
-            0b11000110001100,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110000000,
-            0b11000110001100,
-            0b11100110011100,
-            0b1111111111000,
-            0b111111110000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // sterling
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111100000,
-            0b11111110000,
-            0b111000111000,
-            0b110000011000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000000000,
-            0b110000001100,
-            0b110000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // currency
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11100000011100,
-            0b1110000111000,
-            0b111111110000,
-            0b111111110000,
-            0b1110000111000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1110000111000,
-            0b111111110000,
-            0b111111110000,
-            0b1110000111000,
-            0b11100000011100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b1100000011000,
-            0b1100000011000,
-            0b110000110000,
-            0b110000110000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b1111000000,
-            0b110000000,
-            0b110000000,
-            0b1111111111000,
-            0b1111111111000,
-            0b110000000,
-            0b110000000,
-            0b1111111111000,
-            0b1111111111000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // brokenbar
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // section
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111000000,
-            0b111111100000,
-            0b1110001110000,
-            0b1100000110000,
-            0b1100000000000,
-            0b1110000000000,
-            0b111110000000,
-            0b111111000000,
-            0b1100011100000,
-            0b1100001110000,
-            0b1100000110000,
-            0b1100000110000,
-            0b1100000110000,
-            0b1110000110000,
-            0b111000110000,
-            0b11111100000,
-            0b1111100000,
-            0b01110000,
-            0b00110000,
-            0b1100000110000,
-            0b1110001110000,
-            0b111111100000,
-            0b11111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // dieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // copyright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111111000,
-            0b11111111111100,
-            0b111000000001110,
-            0b110011111100110,
-            0b110111111110110,
-            0b110110000110110,
-            0b110110000000110,
-            0b110110000000110,
-            0b110110000000110,
-            0b110110000000110,
-            0b110110000110110,
-            0b110111111110110,
-            0b110011111100110,
-            0b111000000001110,
-            0b11111111111100,
-            0b1111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordfeminine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111111100000,
-            0b111111110000,
-            0b00111000,
-            0b00011000,
-            0b11111111000,
-            0b111111111000,
-            0b1110000011000,
-            0b1100000011000,
-            0b1110000011000,
-            0b111111111000,
-            0b11111111000,
-            0b00000000,
-            0b00000000,
-            0b1111111111000,
-            0b1111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotleft
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111001110,
-            0b1110011100,
-            0b11100111000,
-            0b111001110000,
-            0b1110011100000,
-            0b11100111000000,
-            0b111001110000000,
-            0b111001110000000,
-            0b11100111000000,
-            0b1110011100000,
-            0b111001110000,
-            0b11100111000,
-            0b1110011100,
-            0b111001110,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // logicalnot
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // softhyphen
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111111000,
-            0b1111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // registered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111111000,
-            0b11111111111100,
-            0b111000000001110,
-            0b110111111100110,
-            0b110111111110110,
-            0b110110000110110,
-            0b110110000110110,
-            0b110110000110110,
-            0b110111111100110,
-            0b110111111000110,
-            0b110110111000110,
-            0b110110011100110,
-            0b110110001110110,
-            0b111000000001110,
-            0b11111111111100,
-            0b1111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // macron
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // degree
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000,
-            0b111111110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b111111110000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // plusminus
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // twosuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000,
-            0b111111110000,
-            0b110000110000,
-            0b110000110000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111111110000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000,
-            0b111111110000,
-            0b110000110000,
-            0b00110000,
-            0b111100000,
-            0b111100000,
-            0b00110000,
-            0b00110000,
-            0b110000110000,
-            0b111111110000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // mu
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11000000111100,
-            0b11000001111100,
-            0b11111111101100,
-            0b11111111001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-        },
-        // paragraph
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111111100,
-            0b11111111111100,
-            0b111000110001100,
-            0b110000110001100,
-            0b110000110001100,
-            0b110000110001100,
-            0b110000110001100,
-            0b110000110001100,
-            0b111000110001100,
-            0b11111110001100,
-            0b1111110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b110001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // periodcentered
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // cedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b1110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-        },
-        // onesuperior
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1110000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ordmasculine
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b11111100000,
-            0b111111110000,
-            0b1110000111000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1100000011000,
-            0b1110000111000,
-            0b111111110000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b1111111111000,
-            0b1111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // guillemotright
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111001110000000,
-            0b11100111000000,
-            0b1110011100000,
-            0b111001110000,
-            0b11100111000,
-            0b1110011100,
-            0b111001110,
-            0b111001110,
-            0b1110011100,
-            0b11100111000,
-            0b111001110000,
-            0b1110011100000,
-            0b11100111000000,
-            0b111001110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onequarter
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000000,
-            0b1110000000000,
-            0b11110000000000,
-            0b110000000000,
-            0b110000000110,
-            0b110000001110,
-            0b110000011100,
-            0b110000111000,
-            0b110001110000,
-            0b11100000,
-            0b111000110,
-            0b1110001110,
-            0b11100011110,
-            0b111000110110,
-            0b1110001100110,
-            0b11100011000110,
-            0b111000111111110,
-            0b110000111111110,
-            0b00000110,
-            0b00000110,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // onehalf
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1100000000000,
-            0b11100000000000,
-            0b111100000000110,
-            0b1100000001110,
-            0b1100000011100,
-            0b1100000111000,
-            0b1100001110000,
-            0b1100011100000,
-            0b1100111000000,
-            0b1110000000,
-            0b11100000000,
-            0b111001111100,
-            0b1110011111110,
-            0b11100011000110,
-            0b111000011000110,
-            0b110000000001100,
-            0b00011000,
-            0b00110000,
-            0b01111110,
-            0b11111110,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // threequarters
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111100000000,
-            0b111111110000000,
-            0b110000110000000,
-            0b111100000000,
-            0b111100000000,
-            0b110000110,
-            0b110000110001110,
-            0b111111110011100,
-            0b11111100111000,
-            0b01110000,
-            0b11100110,
-            0b111001110,
-            0b1110011110,
-            0b11100110110,
-            0b111001100110,
-            0b1110011000110,
-            0b11100111111110,
-            0b111000111111110,
-            0b110000000000110,
-            0b00000110,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // questiondown
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b1100000000,
-            0b11000000000,
-            0b110000000000,
-            0b1100000000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Agrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Acircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Atilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111100011000,
-            0b1101110011000,
-            0b1100111011000,
-            0b1100011110000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Adieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Aring
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b1111000000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // AE
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111111111,
-            0b11111111111111,
-            0b111000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b111111111111110,
-            0b111111111111110,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011000000,
-            0b110000011111111,
-            0b110000011111111,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b110000000,
-            0b110000000,
-            0b1110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-        },
-        // Egrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ecircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Edieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111100000,
-            0b11111111100000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Igrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b11111100000,
-            0b11111100000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Iacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b11111100000,
-            0b11111100000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Icircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b11111100000,
-            0b11111100000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Idieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b11111100000,
-            0b11111100000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111111000000,
-            0b11111111110000,
-            0b11000000111000,
-            0b11000000011000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b111111110001100,
-            0b111111110001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011000,
-            0b11000000111000,
-            0b11111111110000,
-            0b11111111000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ntilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111100011000,
-            0b1101110011000,
-            0b1100111011000,
-            0b1100011110000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b11110000001100,
-            0b11111000001100,
-            0b11011100001100,
-            0b11001110001100,
-            0b11000111001100,
-            0b11000011101100,
-            0b11000001111100,
-            0b11000000111100,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ograve
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ocircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Otilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111100011000,
-            0b1101110011000,
-            0b1100111011000,
-            0b1100011110000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Odieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // multiply
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000011100,
-            0b11100000111000,
-            0b1110001110000,
-            0b111011100000,
-            0b11111000000,
-            0b1110000000,
-            0b11111000000,
-            0b111011100000,
-            0b1110001110000,
-            0b11100000111000,
-            0b111000000011100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001110,
-            0b11000000001110,
-            0b11000000011100,
-            0b11000000111100,
-            0b11000001111100,
-            0b11000011101100,
-            0b11000111001100,
-            0b11001110001100,
-            0b11011100001100,
-            0b11111000001100,
-            0b11110000001100,
-            0b11100000001100,
-            0b111000000001100,
-            0b111000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ugrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Uacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Ucircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Udieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Yacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b1100000011000,
-            0b1100000011000,
-            0b110000110000,
-            0b110000110000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b1111000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // Thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // germandbls
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111111100000,
-            0b11111111110000,
-            0b11000000111000,
-            0b11000000011000,
-            0b11000000011000,
-            0b11000000011000,
-            0b11000000011000,
-            0b11000000110000,
-            0b11111111110000,
-            0b11111111110000,
-            0b11000000111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b11110000011100,
-            0b11011111111000,
-            0b11001111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // agrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // acircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // atilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100011000,
-            0b1101110011000,
-            0b1100111011000,
-            0b1100011110000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // adieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // aring
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1111000000,
-            0b11001100000,
-            0b11001100000,
-            0b11001100000,
-            0b1111000000,
-            0b00000000,
-            0b1111111110000,
-            0b1111111111000,
-            0b00011100,
-            0b00001100,
-            0b00001100,
-            0b111111111100,
-            0b1111111111100,
-            0b11100000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ae
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11111011111000,
-            0b11111111111100,
-            0b110001110,
-            0b110000110,
-            0b110000110,
-            0b1111110000110,
-            0b11111111111110,
-            0b111000111111110,
-            0b110000110000000,
-            0b110000110000000,
-            0b110000110000000,
-            0b111000111000110,
-            0b11111111111110,
-            0b1111101111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ccedilla
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b110000000,
-            0b110000000,
-            0b1110000000,
-            0b1100000000,
-            0b11000000000,
-            0b00000000,
-        },
-        // egrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ecircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // edieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11111111111100,
-            0b11111111111100,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // igrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110000000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // iacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // icircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // idieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b11110000000,
-            0b11110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b11111100000,
-            0b11111100000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // eth
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b1110111000000,
-            0b111110000000,
-            0b1111100000000,
-            0b11101110000000,
-            0b111000000,
-            0b11100000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ntilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100011000,
-            0b1101110011000,
-            0b1100111011000,
-            0b1100011110000,
-            0b00000000,
-            0b00000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ograve
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ocircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // otilde
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111100011000,
-            0b1101110011000,
-            0b1100111011000,
-            0b1100011110000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // odieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b111111110000,
-            0b1111111111000,
-            0b11100000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000011100,
-            0b1111111111000,
-            0b111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // divide
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b11111111111100,
-            0b11111111111100,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b110000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // oslash
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111111110110,
-            0b1111111111110,
-            0b11100000011100,
-            0b11000000111100,
-            0b11000001111100,
-            0b11000011101100,
-            0b11000111001100,
-            0b11001110001100,
-            0b11011100001100,
-            0b11111000001100,
-            0b11110000001100,
-            0b11100000011100,
-            0b111111111111000,
-            0b110111111110000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ugrave
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b111000000000,
-            0b11100000000,
-            0b1110000000,
-            0b111000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // uacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // ucircumflex
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000000,
-            0b1111000000,
-            0b11111100000,
-            0b111001110000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // udieresis
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b110000110000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-        },
-        // yacute
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b01110000,
-            0b11100000,
-            0b111000000,
-            0b1110000000,
-            0b00000000,
-            0b00000000,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11100000001100,
-            0b1111111111100,
-            0b111111111100,
-            0b00001100,
-            0b00001100,
-            0b00011100,
-            0b1111111111000,
-            0b1111111110000,
-            0b00000000,
-        },
-        // thorn
-        (const uint16_t[])
-        {
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b00000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11111111110000,
-            0b11111111111000,
-            0b11000000011100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000001100,
-            0b11000000011100,
-            0b11111111111000,
-            0b11111111110000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b11000000000000,
-            0b00000000,
-        },
-    }
+    0x00,
+    0xFE,
+    Font_TerminASCII32_Index,
+    Font_TerminASCII32_Bitmaps,
+    false
 };
@@ -26,11 +26,19 @@
 #include "buzzer.h"
 #include "configuration.h"
 #include "display.h"
+#include "energygovernor.h"
+#include "energytiers.h"
+#include "eventlog.h"
+#include "flashkvstore.h"
 #include "muxeddipswitch.h"
 #include "pins.h"
 #include "pushbutton.h"
+#include "serialconsole.h"
+#include "serialsink.h"
+#include "telemetry.h"
 #include "timercallback.h"
 #include "vddmeasurement.h"
+#include "vddmeasscheduler.h"
 
 #include <USB/PluggableUSBSerial.h>
 
@@ -43,7 +51,21 @@
 
 void setupPowerSave();
 
-void readConfiguration();
+void loadStoredProfile();
+
+Configuration decodeDIPConfiguration(uint32_t pDIPBits);
+Configuration selectConfiguration(uint32_t pDIPBits);
+Configuration readDIPConfiguration();
+Configuration readConfiguration();
+bool applyConfigurationChange();
+void printConfiguration();
+
+void printRegisters();
+void printEventLog();
+
+void sendTelemetryEvent(const EventLog::Event& pEvent);
+
+size_t writeSerialNonBlocking(const uint8_t* pData, size_t pLength);
 
 void tuneAntenna();
 
@@ -66,13 +88,25 @@ constexpr size_t pushButtonBounceTime = 20;     //Debounce time for used push bu
 constexpr float buzzerFreq = 1000;              //Buzzer beep frequency in Hz
 constexpr float buzzerDutyCycle = 0.1;          //Buzzer signal duty cycle
 
-constexpr float buzzerLightBeepSecs = 0.2;      //Buzzer beep duration for lightning notification in seconds
+constexpr uint8_t displayFullRefreshInterval = 10;  //Number of partial display refreshes before a full refresh is forced (clears ghosting)
+constexpr size_t displayStandbySecs = 60;           //Seconds to keep display in RAM-retaining standby after update (costs ~2mA; 0 = off)
+constexpr uint32_t displayServiceTicks = 2;         //Wake-up interval (in steps of 125ms) to check for finished display refresh
+
+constexpr uint32_t serialServiceTicks = 1;      //Wake-up interval (in steps of 125ms) to continue writing buffered serial output
 
 constexpr size_t wakeTimerIntervalSecs = 120;   //Seconds of inactivity before forced wake-up via RTC (prevent missed AS3935 IRQ, etc.)
 
-constexpr size_t vddMeasIntervalMins = 30;      //Scheduled interval between VDD measurements in minutes
-constexpr size_t vddMeasSmallIntervalMins = 10; //Smaller VDD measurement interval in minutes for high lightning activity
-constexpr float vddMeasLightRateThr = 2.;       //Number of lightnings per minute to switch to smaller measurement interval
+constexpr size_t vddMeasIntervalMins = 30;      //Scheduled interval between VDD measurements in minutes until discharge slope is known
+constexpr size_t vddMeasMinIntervalMins = 5;    //Minimum scheduled interval between VDD measurements in minutes (near discharge curve knee)
+constexpr size_t vddMeasMaxIntervalMins = 180;  //Maximum scheduled interval between VDD measurements in minutes (flat discharge curve)
+constexpr size_t vddMeasSmallIntervalMins = 10; //Maximum VDD measurement interval in minutes for high lightning activity
+constexpr float vddMeasLightRateThr = 2.;       //Number of lightnings per minute to switch to smaller maximum measurement interval
+constexpr float vddMeasPredictionFrac = 0.2;    //Fraction of predicted time until low battery threshold to wait until next VDD measurement
+
+constexpr uintptr_t flashStoreAddr = 0xFC000;  //Start of the internal flash region reserved for persistent settings (last 16kB of flash)
+constexpr size_t flashStorePages = 4;           //Number of 4kB flash pages of the reserved region
+
+constexpr size_t telemetryStatusIntervalSecs = 60; //Minimum interval between binary telemetry status frames in seconds (see Telemetry)
 
 constexpr size_t lightRateAvrgMins = 5;     //Minimum ('minimum' due to sleep) averaging time to determine current lightning activity/rate
 
@@ -114,7 +148,8 @@ AS3935 lDet(Pins::SPI_CS, Pins::IRQ);
 
 #if USE_DISPLAY == USE_DISPLAY_WAVESHAREEPAPER154BW_SX1509IOEXPANDER
     constexpr uint8_t sx1509Addr = 0x3E;
-    Display display(sx1509Addr, SX1509Pins::Display_CS, SX1509Pins::Display_DC, SX1509Pins::Display_RST, SX1509Pins::Display_BUSY);
+    Display display(sx1509Addr, SX1509Pins::Display_CS, SX1509Pins::Display_DC, SX1509Pins::Display_RST, SX1509Pins::Display_BUSY,
+                    Pins::IOExpanderINT, displayFullRefreshInterval);
 #else
     Display display;
 #endif
@@ -123,14 +158,33 @@ AS3935 lDet(Pins::SPI_CS, Pins::IRQ);
 
 TimerCallback wakeTimer(8*wakeTimerIntervalSecs, &isrWakeTimer);    //Periodic wake-up timer (binds RTC interrupt)
 
+FlashKVStore store(flashStoreAddr, flashStorePages);                //Persistent settings (stored configuration profile)
+
 //Other globals
 
 Configuration config;
+Configuration switchConfig;     //Configuration last selected via DIP switches (differs from 'config' after changes via serial console)
+
+EventLog eventLog;              //Recent AS3935 events (exported via serial console)
+
+SerialConsole console;          //Serial command console (only when serial is enabled)
+SerialSink serialOut;           //Buffered serial output (written to serial in chunks from main loop, see SerialSink::service())
+
+EnergyGovernor governor(energyTiers, std::extent<decltype(energyTiers)>::value, energyTierHysteresisPercent);
+
+VDDMeasScheduler vddMeasScheduler(60*vddMeasIntervalMins, 60*vddMeasMinIntervalMins, 60*vddMeasMaxIntervalMins,
+                                  60*vddMeasSmallIntervalMins, lowBatteryThrVoltage, vddMeasPredictionFrac);
 
 using Auxil::RunMode;
 RunMode runMode = RunMode::Normal;
 
+using Auxil::StoreKey;
+
+bool storedProfileValid = false;    //A configuration profile is stored in flash (cached in RAM, see loadStoredProfile())
+uint32_t storedProfile = 0;         //Raw configuration of the stored profile (see Configuration::getRawConfig())
+
 bool serialEnabled = false;
+bool telemetryEnabled = false;  //Send binary telemetry frames instead of text event/status messages via serial (see Telemetry)
 
 AS3935::InterruptType lDetLastInterrupt = AS3935::InterruptType::Lightning; //Last reported interrupt type from AS3935
 uint32_t lDetLastEnergy = 0;                                                //Last reported lightning energy from AS3935 (raw value)
@@ -181,30 +235,271 @@ void setupPowerSave()
     NRF_POWER->TASKS_LOWPWR = 1;
 }
 
+/*!
+ * \brief Load the stored configuration profile from flash into RAM.
+ *
+ * Caches the profile (see readConfiguration()) such that selecting it does not need to read the flash store.
+ * Must be called after FlashKVStore::setup(). The cache is updated when a new profile is stored (see tuneAntenna()).
+ */
+void loadStoredProfile()
+{
+    storedProfileValid = store.read(static_cast<uint16_t>(StoreKey::ConfigProfile), &storedProfile, sizeof(storedProfile));
+}
+
+/*!
+ * \brief Get the DIP switch configuration for setting the AS3935 registers from the DIP switch bits.
+ *
+ * \param pDIPBits All DIP switch positions (see MuxedDIPSwitch::readAllBits()).
+ * \return Configuration from the DIP switch positions.
+ */
+Configuration decodeDIPConfiguration(uint32_t pDIPBits)
+{
+    //Configuration consists of the first 24 of the 25 switch positions (last bit selects stored profile, see selectConfiguration())
+    return Configuration(pDIPBits >> 1);
+}
+
+/*!
+ * \brief Get the configuration selected by the DIP switch bits.
+ *
+ * If the 25th DIP switch is set, the configuration profile stored in flash (see tuneAntenna()) is used
+ * instead of the other DIP switch positions. The DIP switch configuration is used if no profile is stored.
+ * The stored profile is taken from its RAM cache (see loadStoredProfile()).
+ *
+ * \param pDIPBits All DIP switch positions (see MuxedDIPSwitch::readAllBits()).
+ * \return Stored configuration profile or configuration from the DIP switch positions.
+ */
+Configuration selectConfiguration(uint32_t pDIPBits)
+{
+    if (((pDIPBits & 1) != 0) && storedProfileValid)
+        return Configuration(storedProfile);
+
+    return decodeDIPConfiguration(pDIPBits);
+}
+
 /*!
  * \brief Read the DIP switch configuration bits for setting the AS3935 registers.
+ *
+ * \return Configuration from current DIP switch positions.
+ */
+Configuration readDIPConfiguration()
+{
+    return decodeDIPConfiguration(dip.readAllBits());
+}
+
+/*!
+ * \brief Get the configuration selected via the DIP switches.
+ *
+ * Reads the DIP switches once (see selectConfiguration()).
+ *
+ * \return Stored configuration profile or configuration from current DIP switch positions.
+ */
+Configuration readConfiguration()
+{
+    return selectConfiguration(dip.readAllBits());
+}
+
+/*!
+ * \brief Check the DIP switches for a changed configuration and apply it to the AS3935.
+ *
+ * Only the changed AS3935 registers are rewritten (see AS3935::updateConfiguration()), such that
+ * lightning statistics and all counters are kept. A changed configuration is only accepted if it
+ * is read twice in a row (the second time after the switch bounce time) in order to ignore switches
+ * that are just being flipped. Changes made via the serial console are kept until the DIP switch
+ * configuration changes.
+ *
+ * \return If the configuration was changed.
  */
-void readConfiguration()
+bool applyConfigurationChange()
 {
-    std::array<bool, 25> conf25 = dip.readAllBits();
-    std::array<bool, 24> conf;
+    Configuration newConfig = readConfiguration();
+
+    if (newConfig == switchConfig)
+        return false;
+
+    delay(pushButtonBounceTime);
+
+    if (readConfiguration() != newConfig)
+        return false;
+
+    lDet.updateConfiguration(newConfig, config);
+
+    config = newConfig;
+    switchConfig = newConfig;
+
+    return true;
+}
+
+/*!
+ * \brief Print the current configuration and its register values via serial.
+ */
+void printConfiguration()
+{
+    serialOut.print("Configuration: ");
+
+    uint32_t conf = config.getRawConfig();
 
     for (size_t i = 0; i < 24; ++i)
-        conf[i] = conf25[i];
+        serialOut.print((conf >> (23 - i)) & 1);
+
+    if (!config.isValid())
+        serialOut.print(" (contains reserved register values!)");
+
+    for (uint8_t i = 0; i < Configuration::numRegisters; ++i)
+    {
+        Configuration::RegIdent reg = static_cast<Configuration::RegIdent>(i);
+
+        serialOut.print("\n- ");
+        serialOut.print(Configuration::getRegisterName(reg));
+        serialOut.print(": ");
+        serialOut.print(config.getRegister(reg), BIN);
+    }
+    serialOut.print("\n");
+}
 
-    config.load(conf);
+/*!
+ * \brief Print all accessible AS3935 register values via serial.
+ */
+void printRegisters()
+{
+    serialOut.print("AS3935 registers:");
+
+    for (uint8_t addr = 0; addr <= AS3935::maxRegisterAddr; ++addr)
+    {
+        if (addr % 8 == 0)
+        {
+            serialOut.print((addr < 0x10) ? "\n0x0" : "\n0x");
+            serialOut.print(addr, HEX);
+            serialOut.print(":");
+        }
+
+        uint8_t val = lDet.dumpRegister(addr);
+
+        serialOut.print((val < 0x10) ? " 0" : " ");
+        serialOut.print(val, HEX);
+    }
+    serialOut.print("\n");
+}
+
+/*!
+ * \brief Print the logged AS3935 events via serial (CSV format, oldest first).
+ */
+void printEventLog()
+{
+    serialOut.print("time_s,type,energy,distance_km\n");
+
+    for (size_t i = 0; i < eventLog.size(); ++i)
+    {
+        const EventLog::Event& event = eventLog.get(i);
+
+        serialOut.print(event.timeSecs);
+        serialOut.print(",");
+
+        switch (event.type)
+        {
+            case AS3935::InterruptType::DistanceChanged:
+                serialOut.print("distance");
+                break;
+            case AS3935::InterruptType::Noise:
+                serialOut.print("noise");
+                break;
+            case AS3935::InterruptType::Disturber:
+                serialOut.print("disturber");
+                break;
+            case AS3935::InterruptType::Lightning:
+                serialOut.print("lightning");
+                break;
+            case AS3935::InterruptType::Invalid:
+            default:
+                serialOut.print("invalid");
+                break;
+        }
+
+        serialOut.print(",");
+        serialOut.print(event.energy);
+        serialOut.print(",");
+        serialOut.print(event.distance);
+        serialOut.print("\n");
+    }
+}
+
+/*!
+ * \brief Send an AS3935 event as binary telemetry frame via serial.
+ *
+ * \param pEvent Logged event.
+ */
+void sendTelemetryEvent(const EventLog::Event& pEvent)
+{
+    uint8_t frame[Telemetry::maxFrameSize];
+
+    size_t frameLength = Telemetry::encodeEvent({pEvent.timeSecs, static_cast<uint8_t>(pEvent.type), pEvent.energy, pEvent.distance}, frame);
+
+    serialOut.writeMessage(frame, frameLength);
+}
+
+//
+
+/*!
+ * \brief Write to the USB serial device without blocking (see SerialSink::WriteFunction).
+ *
+ * Uses the non-blocking send of the mbed USB CDC device, which only takes data while no packet
+ * is in flight and the host has the port open (DTR), i.e. at most one packet (64 bytes) at a time.
+ *
+ * \param pData Bytes to write.
+ * \param pLength Number of bytes.
+ * \return Number of written bytes (0 if the previous packet was not read by the host yet).
+ */
+size_t writeSerialNonBlocking(const uint8_t* pData, size_t pLength)
+{
+    uint32_t written = 0;
+
+    Serial.send_nb(const_cast<uint8_t*>(pData), pLength, &written, true);
+
+    return written;
 }
 
 /*!
  * \brief Perform manual AS3935 antenna tuning (endless loop).
+ *
+ * Pressing the DSP button applies the current DIP switch configuration (ignoring the 25th DIP switch).
+ * Pressing the CLR button stores it as the configuration profile (see readConfiguration()), which is
+ * confirmed by a double beep (or a long beep if storing fails).
  */
 void tuneAntenna()
 {
     while (true)
     {
+        while (!buttonDSP.pressed() && !buttonCLR.pressed())
+            ;
+
+        if (buttonCLR.pressed())
+        {
+            buttonCLR.waitPressed();
+
+            uint32_t rawConfig = readDIPConfiguration().getRawConfig();
+
+            if (store.write(static_cast<uint16_t>(StoreKey::ConfigProfile), &rawConfig, sizeof(rawConfig)))
+            {
+                storedProfile = rawConfig;
+                storedProfileValid = true;
+
+                buzzer.beepMulti(2, 0.1, 0.1);
+            }
+            else
+            {
+                //Flash content is uncertain after a failed write
+                loadStoredProfile();
+
+                buzzer.beepSingle(1.0);
+            }
+
+            buttonCLR.waitReleased();
+
+            continue;
+        }
+
         buttonDSP.waitPressed();
 
-        readConfiguration();
+        config = readDIPConfiguration();
 
         lDet.writeConfiguration(config);
 
@@ -256,24 +551,36 @@ void detectLightnings()
     size_t lightningCtr = 0;
 
     //Accumulate passed time during sleep when waking up to occasionally trigger a VDD measurement
-    size_t sleepSecsSinceLastVDDMeas = 60*vddMeasIntervalMins;  //Do initial measurement at startup
+    size_t sleepSecsSinceLastVDDMeas = 0;   //Initial measurement at startup is scheduled by 'vddMeasScheduler'
 
     //Latest VDD measurement result
     float supplyVoltage = 0;
 
     //Successively calculate the average rate of current lightning activity
     size_t sleepSecsSinceLastRateAvrg = 0;  //Passed time during sleep since last rate average
+    float beepSecsSinceLastRateAvrg = 0;    //Passed time during notification beeps since last rate average
     size_t lightsSinceLastRateAvrg = 0;     //Number of lightnings since last rate average
     float lightningRate = 0;                //Lightnings per minute
 
     //Accumulate estimated total run time
     size_t runTimeFullHours = 0;        //Full hours of run time (only updated from below seconds upon every display update)
     size_t runTimeRemainderSecs = 0;    //Accumulated seconds of run time (carried over to above hours upon every display update)
-    size_t lightsSinceLastDisplay = 0;  //Number of lightnings since last display update
+    float beepSecsSinceLastDisplay = 0; //Passed time during notification beeps since last display update
 
-    //Define a common display update routine
-    auto updateDisplay = [beepEnabled, &supplyVoltage, &lightningCtr, &lightningRate,
-                          &runTimeFullHours, &runTimeRemainderSecs, &lightsSinceLastDisplay]() -> void
+    //Remaining sleep time to keep display in RAM-retaining standby (faster following update) before fully turning it off
+    size_t displayStandbySecsLeft = 0;
+
+    //Accumulate fractions of seconds of sleep time (short wake-up intervals during display refresh)
+    uint32_t sleepTicksRemainder = 0;
+
+    //AS3935 was powered down according to the duty cycle of the current energy tier
+    bool lDetPoweredDown = false;
+
+    //Passed time during sleep since last binary telemetry status frame
+    size_t sleepSecsSinceLastStatus = 0;
+
+    //Define a common battery percentage estimation routine
+    auto estimateBatteryPercentage = [&supplyVoltage]() -> float
     {
         float batteryPercentage = Auxil::calcBatteryPercentage(supplyVoltage, batteryOCVoltage0, systemMinVoltage,
                                                                systemIdleCurrent, systemMaxCurrent, systemBatteryCount);
@@ -283,10 +590,19 @@ void detectLightnings()
         else if (batteryPercentage > 100.0)
             batteryPercentage = 100.0;
 
-        if (beepEnabled)
-            runTimeRemainderSecs += static_cast<size_t>(buzzerLightBeepSecs*lightsSinceLastDisplay);
+        return batteryPercentage;
+    };
+
+    //Define a common display update routine
+    auto updateDisplay = [&estimateBatteryPercentage, &supplyVoltage, &lightningCtr, &lightningRate,
+                          &runTimeFullHours, &runTimeRemainderSecs, &beepSecsSinceLastDisplay, &displayStandbySecsLeft]() -> void
+    {
+        float batteryPercentage = estimateBatteryPercentage();
 
-        lightsSinceLastDisplay = 0;
+        size_t beepFullSecs = static_cast<size_t>(beepSecsSinceLastDisplay);
+
+        runTimeRemainderSecs += beepFullSecs;
+        beepSecsSinceLastDisplay -= beepFullSecs;
 
         if (runTimeRemainderSecs >= 3600)
         {
@@ -298,10 +614,165 @@ void detectLightnings()
 
         float runTimeHours = runTimeFullHours + (static_cast<float>(runTimeRemainderSecs) / 3600.);
 
-        display.init();
+        //Only starts the refresh, which then continues asynchronously (see display.service() below)
         display.update(lightningCtr, lightningRate, lDetStormDist, batteryPercentage, supplyVoltage,
                        runTimeHours, runMode, serialEnabled, lDetLastInterrupt);
-        display.sleep();
+
+        displayStandbySecsLeft = 0;     //Restarted after refresh has finished
+
+        governor.registerDisplayUpdate();
+    };
+
+    //Define a common routine to reset lightning statistics (in particular also AS3935 internal statistics) and rate measurement
+    auto clearStatistics = [&lightningCtr, &sleepSecsSinceLastRateAvrg, &beepSecsSinceLastRateAvrg,
+                            &lightsSinceLastRateAvrg, &lightningRate]() -> void
+    {
+        //Clear AS3935 lightning statistics
+        lDet.clearStatistics();
+
+        //Reset latest interrupt type, lightning energy and storm distance received from AS3935
+        lDetLastInterrupt = AS3935::InterruptType::Lightning;
+        lDetLastEnergy = 0;
+        lDetStormDist = AS3935::stormDistanceOutOfRange;
+
+        //Reset lightning counter
+        lightningCtr = 0;
+
+        //Reset lightning rate measurement
+        sleepSecsSinceLastRateAvrg = 0;
+        beepSecsSinceLastRateAvrg = 0;
+        lightsSinceLastRateAvrg = 0;
+        lightningRate = 0;
+    };
+
+    //Define a routine to send the current status as binary telemetry frame
+    auto sendTelemetryStatus = [&estimateBatteryPercentage, &supplyVoltage, &lightningCtr, &lightningRate, &wakeUpCtr,
+                                &runTimeFullHours, &runTimeRemainderSecs, &lowBattery, &lDetPoweredDown, &sleepSecsSinceLastStatus]() -> void
+    {
+        Telemetry::StatusRecord status;
+
+        status.timeSecs = static_cast<uint32_t>(3600*runTimeFullHours + runTimeRemainderSecs);
+        status.vddMilliVolts = static_cast<uint16_t>(1000*supplyVoltage + 0.5);
+        status.batteryPercentage = static_cast<uint8_t>(estimateBatteryPercentage() + 0.5);
+        status.energyTier = static_cast<uint8_t>(governor.getTierIndex());
+        status.lightningCount = static_cast<uint32_t>(lightningCtr);
+        status.lightningRate = static_cast<uint16_t>(std::min(100*lightningRate + 0.5, 65535.));
+        status.wakeUpCount = static_cast<uint32_t>(wakeUpCtr);
+        status.flags = (lowBattery ? Telemetry::StatusFlags::LowBattery : 0) | (lDetPoweredDown ? Telemetry::StatusFlags::AS3935Off : 0);
+
+        uint8_t frame[Telemetry::maxFrameSize];
+
+        serialOut.writeMessage(frame, Telemetry::encodeStatus(status, frame));
+
+        sleepSecsSinceLastStatus = 0;
+    };
+
+    //Define the serial console command handler (handles at most one command per call, see SerialConsole::poll())
+    auto serviceConsole = [&estimateBatteryPercentage, &updateDisplay, &clearStatistics, &sendTelemetryStatus, &lowBattery, &wakeUpCtr,
+                           &lightningCtr, &lightningRate, &supplyVoltage, &runTimeFullHours, &runTimeRemainderSecs]() -> void
+    {
+        if (!console.poll(Serial))
+            return;
+
+        size_t numArgs = console.getNumArgs();
+
+        if (console.lineOverflowed())
+            serialOut.print("Error: Line too long!\n");
+        else if (numArgs == 0)
+            return;
+        else if (console.argEquals(0, "help") && (numArgs == 1))
+        {
+            serialOut.print("Commands:\n"
+                         "- help: Show this list\n"
+                         "- stat: Show counters and rates\n"
+                         "- conf: Show current configuration\n"
+                         "- regs: Dump AS3935 registers\n"
+                         "- set <REGISTER> <VALUE>: Change configuration register (e.g. 'set NF_LEV 0b011')\n"
+                         "- disp: Update display\n"
+                         "- clr: Clear statistics\n"
+                         "- log: Export event log (CSV)\n"
+                         "- telemetry <on|off>: Send binary telemetry frames instead of text messages (see tools/decode_telemetry.cpp)\n");
+        }
+        else if (console.argEquals(0, "stat") && (numArgs == 1))
+        {
+            serialOut.print("Lightnings: ");
+            serialOut.print(lightningCtr);
+            serialOut.print("\nRate: ");
+            serialOut.print(lightningRate, 2);
+            serialOut.print(" /min\nStorm distance: ");
+            serialOut.print(lDetStormDist);
+            serialOut.print(" km\nLast energy: ");
+            serialOut.print(lDetLastEnergy);
+            serialOut.print("\nWake-ups: ");
+            serialOut.print(wakeUpCtr);
+            serialOut.print("\nVDD: ");
+            serialOut.print(supplyVoltage, 3);
+            serialOut.print(" V (");
+            serialOut.print(estimateBatteryPercentage(), 0);
+            serialOut.print(" %)\nEnergy tier: ");
+            serialOut.print(governor.getTierIndex());
+            serialOut.print("\nRun time: ");
+            serialOut.print(runTimeFullHours + (static_cast<float>(runTimeRemainderSecs) / 3600.), 2);
+            serialOut.print(" h\nDropped serial messages: ");
+            serialOut.print(serialOut.getNumDropped());
+            serialOut.print("\nStalled serial output discards: ");
+            serialOut.print(serialOut.getNumStalls());
+            serialOut.print("\n");
+        }
+        else if (console.argEquals(0, "conf") && (numArgs == 1))
+            printConfiguration();
+        else if (console.argEquals(0, "regs") && (numArgs == 1))
+            printRegisters();
+        else if (console.argEquals(0, "set") && (numArgs == 3))
+        {
+            //Find register by name
+            uint8_t regIdx = 0;
+            while ((regIdx < Configuration::numRegisters) &&
+                   !console.argEquals(1, Configuration::getRegisterName(static_cast<Configuration::RegIdent>(regIdx))))
+            {
+                ++regIdx;
+            }
+
+            Configuration::RegIdent reg = static_cast<Configuration::RegIdent>(regIdx);
+
+            uint32_t value = 0;
+
+            if (regIdx == Configuration::numRegisters)
+                serialOut.print("Error: Unknown register!\n");
+            else if (!SerialConsole::parseNumber(console.getArg(2), value) || (value > 0xFF) || !Configuration::fitsRegister(reg, value))
+                serialOut.print("Error: Invalid or reserved register value!\n");
+            else
+            {
+                //Kept until the DIP switch configuration changes (see applyConfigurationChange())
+                Configuration newConfig = config.withRegister(reg, static_cast<uint8_t>(value));
+
+                lDet.updateConfiguration(newConfig, config);
+
+                config = newConfig;
+
+                printConfiguration();
+            }
+        }
+        else if (console.argEquals(0, "disp") && (numArgs == 1))
+        {
+            if (!lowBattery && governor.displayUpdateAllowed())
+                updateDisplay();
+            else
+                serialOut.print("Error: Display update not allowed due to low battery or energy tier!\n");
+        }
+        else if (console.argEquals(0, "clr") && (numArgs == 1))
+            clearStatistics();
+        else if (console.argEquals(0, "log") && (numArgs == 1))
+            printEventLog();
+        else if (console.argEquals(0, "telemetry") && (numArgs == 2) && (console.argEquals(1, "on") || console.argEquals(1, "off")))
+        {
+            telemetryEnabled = console.argEquals(1, "on");
+
+            if (telemetryEnabled)
+                sendTelemetryStatus();
+        }
+        else
+            serialOut.print("Error: Unknown command! Type 'help' for a list of commands.\n");
     };
 
     while (true)
@@ -311,7 +782,7 @@ void detectLightnings()
             digitalWrite(Pins::LED_RGB_R, LOW);
         if (irqWakeClr || irqWakeDsp)
             digitalWrite(Pins::LED_RGB_G, LOW);
-        if (irqWakeTimer)
+        if (irqWakeTimer && !display.refreshing())
             digitalWrite(Pins::LED_RGB_B, LOW);
 
         //Debounce pressed buttons
@@ -326,11 +797,19 @@ void detectLightnings()
         digitalWrite(Pins::LED_RGB_G, HIGH);
         digitalWrite(Pins::LED_RGB_B, HIGH);
 
+        //Apply changed DIP switch configuration without reset (cheap check on every wake-up; confirmed by a short beep)
+        if (applyConfigurationChange())
+        {
+            if (beepEnabled)
+                buzzer.beepSingle(0.05);
+
+            if (serialEnabled)
+                printConfiguration();
+        }
+
         //Calculate average rate of current lightning activity
 
-        size_t secsSinceLastRateAvrg = sleepSecsSinceLastRateAvrg;
-        if (beepEnabled)
-            secsSinceLastRateAvrg += static_cast<size_t>(buzzerLightBeepSecs*lightsSinceLastRateAvrg);
+        size_t secsSinceLastRateAvrg = sleepSecsSinceLastRateAvrg + static_cast<size_t>(beepSecsSinceLastRateAvrg);
 
         if (secsSinceLastRateAvrg >= 60*lightRateAvrgMins)
         {
@@ -339,16 +818,16 @@ void detectLightnings()
             lightningRate = static_cast<float>(lightsSinceLastRateAvrg) / avMins;
 
             sleepSecsSinceLastRateAvrg = 0;
+            beepSecsSinceLastRateAvrg = 0;
             lightsSinceLastRateAvrg = 0;
         }
 
-        //Occasionally measure VDD (every >~ N minutes and only if already awake); adjust interval with
-        //lightning activity (i.e. current consumption); always measure on push button event (user interaction)
-        if (irqWakeClr || irqWakeDsp || (sleepSecsSinceLastVDDMeas >= 60*vddMeasIntervalMins) ||
-                ((lightningRate > vddMeasLightRateThr) && (sleepSecsSinceLastVDDMeas >= 60*vddMeasSmallIntervalMins)))
-        {
-            sleepSecsSinceLastVDDMeas = 0;
+        //Occasionally measure VDD (only if already awake); adapt interval to discharge slope, lightning activity
+        //(i.e. current consumption) and energy tier; always measure on push button event (user interaction)
+        size_t vddMeasIntervalSecs = governor.scaleVDDMeasInterval(vddMeasScheduler.getIntervalSecs(lightningRate > vddMeasLightRateThr));
 
+        if (irqWakeClr || irqWakeDsp || (sleepSecsSinceLastVDDMeas >= vddMeasIntervalSecs))
+        {
             //Wait for release of pressed buttons first in order to avoid the influence of the additional current on the measurement
             if (irqWakeClr)
                 buttonCLR.waitReleased();
@@ -360,11 +839,26 @@ void detectLightnings()
 
             supplyVoltage = VDDMeasurement::measureVoltage();
 
-            if (serialEnabled)
+            vddMeasScheduler.registerMeasurement(supplyVoltage, sleepSecsSinceLastVDDMeas);
+            sleepSecsSinceLastVDDMeas = 0;
+
+            //Select energy tier for graceful degradation of power-hungry features
+            bool tierChanged = governor.updateBatteryPercentage(estimateBatteryPercentage());
+
+            if (serialEnabled && telemetryEnabled)
+                sendTelemetryStatus();
+            else if (serialEnabled)
             {
-                Serial.print("VDD: ");
-                Serial.print(supplyVoltage, 3);
-                Serial.print(" V\n");
+                serialOut.print("VDD: ");
+                serialOut.print(supplyVoltage, 3);
+                serialOut.print(" V\n");
+            }
+
+            if (tierChanged && serialEnabled && !telemetryEnabled)
+            {
+                serialOut.print("Energy tier: ");
+                serialOut.print(governor.getTierIndex());
+                serialOut.print("\n");
             }
 
             //Warn when voltage is expected to drop below minimum system operating voltage during buzzer beep; also disable beep then
@@ -388,9 +882,9 @@ void detectLightnings()
 
                 if (serialEnabled)
                 {
-                    Serial.print("Warning: Low battery! Measured VDD should be >~ ");
-                    Serial.print(lowBatteryThrVoltage, 3);
-                    Serial.print(" V! Disabling beep and display update.\n");
+                    serialOut.print("Warning: Low battery! Measured VDD should be >~ ");
+                    serialOut.print(lowBatteryThrVoltage, 3);
+                    serialOut.print(" V! Disabling beep and display update.\n");
                 }
             }
 
@@ -413,14 +907,26 @@ void detectLightnings()
                 //Voltage too low to still run AS3935! Stop main loop and sleep, occasionally wake up to let LED blink for notification
                 if (emptyBattery)
                 {
+                    //Let a display refresh still in progress finish first (turning off power would interrupt the waveform)
+                    while (display.refreshing())
+                    {
+                        delay(10);
+                        display.service();
+                    }
+
+                    display.powerOff();
+
                     if (serialEnabled)
                     {
-                        Serial.print("Warning: Empty battery! Measured VDD is below minimum AS3935 operating voltage of ");
-                        Serial.print(as3935MinVoltage, 3);
-                        Serial.print(" V! Going to sleep...\n");
+                        serialOut.print("Warning: Empty battery! Measured VDD is below minimum AS3935 operating voltage of ");
+                        serialOut.print(as3935MinVoltage, 3);
+                        serialOut.print(" V! Going to sleep...\n");
 
                         serialEnabled = false;
 
+                        if (Serial)
+                            serialOut.drain(writeSerialNonBlocking);
+
                         Serial.end();
                         NRF_USBD->ENABLE = 0;
                         while (NRF_USBD->ENABLE == 1)
@@ -475,46 +981,53 @@ void detectLightnings()
                 bool lightning = processInterruptAS3935();
                 digitalWrite(Pins::LED_RGB_R, HIGH);
 
+                EventLog::Event event = {static_cast<uint32_t>(3600*runTimeFullHours + runTimeRemainderSecs), lDetLastInterrupt,
+                                         lDetStormDist, lightning ? lDetLastEnergy : 0};
+
+                eventLog.add(event);
+
+                if (serialEnabled && telemetryEnabled)
+                    sendTelemetryEvent(event);
+
                 if (lightning)
                 {
                     ++lightningCtr;
                     ++lightsSinceLastRateAvrg;
-                    ++lightsSinceLastDisplay;
 
-                    if (beepEnabled)
-                        buzzer.beepSingle(buzzerLightBeepSecs);
+                    //Beep (unless coalesced with a previous beep according to energy tier)
+                    if (beepEnabled && governor.requestBeep())
+                    {
+                        float beepSecs = governor.getBeepSecs();
+
+                        buzzer.beepSingle(beepSecs);
+
+                        beepSecsSinceLastRateAvrg += beepSecs;
+                        beepSecsSinceLastDisplay += beepSecs;
+                    }
                 }
             }
         }
 
-        //If requested, reset lightning statistics (in particular also AS3935 internal statistics) and rate measurement
-        if (irqWakeClr)
-        {
-            //Clear AS3935 lightning statistics
-            lDet.clearStatistics();
-
-            //Reset latest interrupt type, lightning energy and storm distance received from AS3935
-            lDetLastInterrupt = AS3935::InterruptType::Lightning;
-            lDetLastEnergy = 0;
-            lDetStormDist = AS3935::stormDistanceOutOfRange;
+        //Handle serial console command (after processing AS3935 events; more pending input immediately wakes up again, see below)
+        if (serialEnabled)
+            serviceConsole();
 
-            //Reset lightning counter
-            lightningCtr = 0;
+        //Occasionally send status as binary telemetry frame
+        if (serialEnabled && telemetryEnabled && (sleepSecsSinceLastStatus >= telemetryStatusIntervalSecs))
+            sendTelemetryStatus();
 
-            //Reset lightning rate measurement
-            sleepSecsSinceLastRateAvrg = 0;
-            lightsSinceLastRateAvrg = 0;
-            lightningRate = 0;
-        }
+        //If requested, reset lightning statistics (in particular also AS3935 internal statistics) and rate measurement
+        if (irqWakeClr)
+            clearStatistics();
 
-        //If requested, update display content (disable updating when battery voltage gets too low)
+        //If requested, update display content (disable updating when battery voltage gets too low; limit update rate with energy tier)
         if (irqWakeDsp)
         {
-            if (!lowBattery)
+            if (!lowBattery && governor.displayUpdateAllowed())
                 updateDisplay();
             else
             {
-                //Let LED blink briefly to remember about display not updating due to low battery voltage
+                //Let LED blink briefly to remember about display not updating due to low battery voltage or energy tier
                 for (size_t i = 0; i < 3; ++i)
                 {
                     delay(130);
@@ -538,9 +1051,42 @@ void detectLightnings()
         irqWakeDsp = false;
         irqWakeTimer = false;
 
+        //Continue asynchronous display refresh; once finished, keep display RAM for a while for a fast warm start of a subsequent update
+
+        bool displayWasRefreshing = display.refreshing();
+
+        display.service();
+
+        if (displayWasRefreshing && !display.refreshing())
+        {
+            if (displayStandbySecs > 0)
+                displayStandbySecsLeft = displayStandbySecs;
+            else
+                display.powerOff();
+        }
+
+        //Write buffered serial output for a short time (never waits for a disconnected or stalled host)
+
+        bool serialReady = serialEnabled && static_cast<bool>(Serial);
+
+        if (serialEnabled)
+            serialOut.service(writeSerialNonBlocking, serialReady);
+
         //Go to sleep
 
-        wakeTimer.startTimer();
+        //Wake up earlier if display refresh needs to be checked or if display needs to be turned off after its standby time
+        uint32_t wakeTimerTicks = 8*wakeTimerIntervalSecs;
+
+        if (display.refreshing())
+            wakeTimerTicks = std::min(wakeTimerTicks, displayServiceTicks);
+        else if (displayStandbySecsLeft > 0)
+            wakeTimerTicks = std::min(wakeTimerTicks, static_cast<uint32_t>(8*displayStandbySecsLeft));
+
+        //Also wake up earlier to continue writing buffered serial output (only if host is connected)
+        if (serialReady && serialOut.pending())
+            wakeTimerTicks = std::min(wakeTimerTicks, serialServiceTicks);
+
+        wakeTimer.startTimer(wakeTimerTicks);
 
         lDet.enableInterrupt(isrAS3935);
         buttonCLR.enableInterrupt(isrButtonClr);
@@ -558,7 +1104,8 @@ void detectLightnings()
 
         if (!lDet.irqHigh())
         {
-            while (!irqWake)
+            //Also wake up for serial console input (USB interrupts end sd_app_evt_wait() but do not set 'irqWake')
+            while (!irqWake && !(serialEnabled && (Serial.available() > 0)))
                 sd_app_evt_wait();
 
             ++wakeUpCtr;
@@ -579,17 +1126,46 @@ void detectLightnings()
 
         uint32_t timerTicksSinceLastWake = wakeTimer.stopTimer();
 
-        size_t sleepSecs;
-
         if (irqWakeTimer)
-            sleepSecs = wakeTimerIntervalSecs;  //Use fixed interval value here as timer interrupt already cleared counter
+            sleepTicksRemainder += wakeTimerTicks;  //Use set interval value here as timer interrupt already cleared counter
         else
-            sleepSecs = static_cast<size_t>(static_cast<float>(timerTicksSinceLastWake) / 8.);
+            sleepTicksRemainder += timerTicksSinceLastWake;
+
+        size_t sleepSecs = sleepTicksRemainder / 8;
+        sleepTicksRemainder %= 8;
 
         sleepSecsSinceLastVDDMeas += sleepSecs;
         sleepSecsSinceLastRateAvrg += sleepSecs;
+        sleepSecsSinceLastStatus += sleepSecs;
 
         runTimeRemainderSecs += sleepSecs;
+
+        governor.advanceTime(sleepSecs);
+        serialOut.advanceTime(sleepSecs);
+
+        //Fully turn off display after its standby time
+        if (displayStandbySecsLeft > 0)
+        {
+            if (sleepSecs >= displayStandbySecsLeft)
+            {
+                display.powerOff();
+                displayStandbySecsLeft = 0;
+            }
+            else
+                displayStandbySecsLeft -= sleepSecs;
+        }
+
+        //Power AS3935 down/up according to the duty cycle of the current energy tier
+        if (lDetPoweredDown && governor.as3935Enabled())
+        {
+            lDet.powerUp();
+            lDetPoweredDown = false;
+        }
+        else if (!lDetPoweredDown && !governor.as3935Enabled())
+        {
+            lDet.powerDown();
+            lDetPoweredDown = true;
+        }
     }
 }
 
@@ -602,57 +1178,58 @@ bool processInterruptAS3935()
 {
     AS3935::InterruptType interruptType = lDet.processIRQ(lDetLastEnergy, lDetStormDist);
 
-    if (serialEnabled)
+    //Report event as text (see sendTelemetryEvent() for the binary telemetry)
+    if (serialEnabled && !telemetryEnabled)
     {
-        Serial.print("Event: ");
+        serialOut.print("Event: ");
 
         switch (interruptType)
         {
             case AS3935::InterruptType::DistanceChanged:
             {
-                Serial.print("Distance Changed:\t{");
-                Serial.print(lDetStormDist);
-                Serial.print(" km [");
-                Serial.print(lDetStormDist, BIN);
-                Serial.print("]}");
+                serialOut.print("Distance Changed:\t{");
+                serialOut.print(lDetStormDist);
+                serialOut.print(" km [");
+                serialOut.print(lDetStormDist, BIN);
+                serialOut.print("]}");
                 break;
             }
             case AS3935::InterruptType::Noise:
             {
-                Serial.print("Noise!!!");
+                serialOut.print("Noise!!!");
                 break;
             }
             case AS3935::InterruptType::Disturber:
             {
-                Serial.print("Disturber!");
+                serialOut.print("Disturber!");
                 break;
             }
             case AS3935::InterruptType::Lightning:
             {
-                Serial.print("Lightning:\t{");
-                Serial.print("Energy: ");
-                Serial.print(lDetLastEnergy);
-                Serial.print(" a.u. [");
-                Serial.print(lDetLastEnergy, BIN);
-                Serial.print("],\t");
-                Serial.print("Distance: ");
-                Serial.print(lDetStormDist);
-                Serial.print(" km [");
-                Serial.print(lDetStormDist, BIN);
-                Serial.print("]}");
+                serialOut.print("Lightning:\t{");
+                serialOut.print("Energy: ");
+                serialOut.print(lDetLastEnergy);
+                serialOut.print(" a.u. [");
+                serialOut.print(lDetLastEnergy, BIN);
+                serialOut.print("],\t");
+                serialOut.print("Distance: ");
+                serialOut.print(lDetStormDist);
+                serialOut.print(" km [");
+                serialOut.print(lDetStormDist, BIN);
+                serialOut.print("]}");
                 break;
             }
             case AS3935::InterruptType::Invalid:
             default:
             {
-                Serial.print("UNKNOWN:\t{Interrupt Type: [");
-                Serial.print(static_cast<uint8_t>(interruptType), BIN);
-                Serial.print("]}");
+                serialOut.print("UNKNOWN:\t{Interrupt Type: [");
+                serialOut.print(static_cast<uint8_t>(interruptType), BIN);
+                serialOut.print("]}");
                 break;
             }
         }
 
-        Serial.print("\n");
+        serialOut.print("\n");
     }
 
     lDetLastInterrupt = interruptType;
@@ -743,6 +1320,9 @@ void setup()
 
     lDet.setup();
 
+    store.setup();
+    loadStoredProfile();
+
     display.setup();
 
     //Initialize used internal periphery
@@ -764,8 +1344,14 @@ void setup()
 
     buzzer.beepSingle(0.1);
 
-    //Load configuration from DIP switches
-    readConfiguration();
+    //Load configuration from DIP switches or stored profile (changes are applied later on during lightning detection,
+    //see applyConfigurationChange()); antenna tuning always starts from the DIP switch configuration
+    if (runMode == RunMode::TuneAntenna)
+        config = readDIPConfiguration();
+    else
+        config = readConfiguration();
+
+    switchConfig = config;
 
     //Configure lightning detector
 
@@ -813,30 +1399,7 @@ void setup()
 
             //Print DIP switch configuration
             if (serialEnabled)
-            {
-                Serial.print("Configuration: ");
-
-                std::array<bool, 24> conf = config.getRawConfig();
-
-                for (size_t i = 0; i < 24; ++i)
-                    Serial.print(conf[i] ? 1 : 0);
-
-                Serial.print("\n- AFE_GB: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::AFE_GB), BIN);
-                Serial.print("\n- NF_LEV: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::NF_LEV), BIN);
-                Serial.print("\n- WDTH: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::WDTH), BIN);
-                Serial.print("\n- SREJ: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::SREJ), BIN);
-                Serial.print("\n- TUN_CAP: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::TUN_CAP), BIN);
-                Serial.print("\n- LCO_FDIV: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::LCO_FDIV), BIN);
-                Serial.print("\n- MIN_NUM_LIGH: ");
-                Serial.print(config.getRegister(Configuration::RegIdent::MIN_NUM_LIGH), BIN);
-                Serial.print("\n");
-            }
+                printConfiguration();
 
             lDet.unmaskDisturbers();
 
@@ -847,10 +1410,11 @@ void setup()
             break;
     }
 
-    //Initially reset and clear display and send it to sleep
+    //Initially reset and clear display and turn it off
     display.init();
-    display.clear();
+    display.clear();    //Waits for refresh (unlike display.update())
     display.sleep();
+    display.powerOff();
 
     delay(200);
     buzzer.beepSingle(0.5);
@@ -0,0 +1,634 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef MONOFRAMEBUFFER_H
+#define MONOFRAMEBUFFER_H
+
+#include "font.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <cstring>
+
+/*!
+ * \brief Monochrome (1 bit per pixel) framebuffer with built-in graphics operations.
+ *
+ * Holds a linear buffer of \p H rows with \p W pixels each, one bit per pixel and the leftmost pixel of each
+ * byte in the MSB (i.e. the format of the e-paper display controller's RAM). The buffer can represent a
+ * horizontal band of a larger image: Its first row corresponds to the image row set via setOriginY().
+ * Everything outside of the band (and outside of the image's width) is clipped.
+ *
+ * Provides the drawing operations of ArduinoGraphics that are needed for the status screen (the text fields drawn by the
+ * display driver on top of StatusScreenBackground, and DrawList::replay() in the host tools) with the same semantics
+ * (including stroke/fill/background colors and fonts), but since the pixel format and the buffer dimensions are known
+ * at compile time, all pixel writes are inlined bit operations instead of virtual calls to ArduinoGraphics::set() and
+ * AbstractDisplay::setPixel(). Like ArduinoGraphics, rectangles and straight lines are drawn as horizontal and vertical
+ * spans that are clipped once, with horizontal spans being filled bytewise (see hSpan()).
+ * As for AbstractDisplay::setPixel() any color with a non-zero component corresponds to pixel value 1 and black to pixel value 0.
+ *
+ * Other display backends can still use ArduinoGraphics/Graphics with AbstractDisplay::setPixel().
+ */
+template<size_t W, size_t H>
+class MonoFramebuffer
+{
+public:
+    static constexpr size_t bytesPerRow = (W + 7) / 8;      ///< Number of bytes per buffer row.
+    static constexpr size_t bufferSize = bytesPerRow * H;   ///< Total buffer size in bytes.
+
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * Starts with origin 0, white background, black stroke, no fill and \e without a font being set.
+     * The buffer content is undefined until clear() is called.
+     */
+    MonoFramebuffer() :
+        originY(0),
+        font(nullptr),
+        fillOn(false),
+        strokeOn(true),
+        backgroundValue(true),
+        fillValue(true),
+        strokeValue(false)
+    {
+    }
+    //
+    /*!
+     * \brief Get the image width.
+     *
+     * \return Width in pixels.
+     */
+    int width() const
+    {
+        return W;
+    }
+    /*!
+     * \brief Get the number of buffer rows.
+     *
+     * \return Height of the buffer in pixels.
+     */
+    int rows() const
+    {
+        return H;
+    }
+    /*!
+     * \brief Get the buffer content.
+     *
+     * \return Pointer to the \p bufferSize bytes of the buffer.
+     */
+    const uint8_t* data() const
+    {
+        return &buffer[0];
+    }
+    //
+    /*!
+     * \brief Set the image row that corresponds to the first buffer row.
+     *
+     * \param pOriginY Image y-coordinate of buffer row 0.
+     */
+    void setOriginY(int pOriginY)
+    {
+        originY = pOriginY;
+    }
+    //
+    /*!
+     * \brief Set the background color.
+     *
+     * This color value is used by clear() and for the unset pixels of text glyphs.
+     *
+     * \param pR Red color value from 0 to 255.
+     * \param pG Green color value from 0 to 255.
+     * \param pB Blue color value from 0 to 255.
+     */
+    void background(uint8_t pR, uint8_t pG, uint8_t pB)
+    {
+        backgroundValue = colorToValue(pR, pG, pB);
+    }
+    /*!
+     * \brief Enable filling and set fill color.
+     *
+     * \param pR Red color value from 0 to 255.
+     * \param pG Green color value from 0 to 255.
+     * \param pB Blue color value from 0 to 255.
+     */
+    void fill(uint8_t pR, uint8_t pG, uint8_t pB)
+    {
+        fillOn = true;
+        fillValue = colorToValue(pR, pG, pB);
+    }
+    /*!
+     * \brief Disable filling.
+     */
+    void noFill()
+    {
+        fillOn = false;
+    }
+    /*!
+     * \brief Enable stroke and set stroke color.
+     *
+     * \param pR Red color value from 0 to 255.
+     * \param pG Green color value from 0 to 255.
+     * \param pB Blue color value from 0 to 255.
+     */
+    void stroke(uint8_t pR, uint8_t pG, uint8_t pB)
+    {
+        strokeOn = true;
+        strokeValue = colorToValue(pR, pG, pB);
+    }
+    /*!
+     * \brief Disable stroke.
+     */
+    void noStroke()
+    {
+        strokeOn = false;
+    }
+    //
+    /*!
+     * \brief Reset all pixels to the background color.
+     */
+    void clear()
+    {
+        memset(&buffer[0], backgroundValue ? 0b11111111 : 0b00000000, bufferSize);
+    }
+    /*!
+     * \brief Overwrite all pixels with prerendered content.
+     *
+     * \param pData Pointer to \p bufferSize bytes in the format of the buffer (see data()).
+     */
+    void load(const uint8_t* pData)
+    {
+        memcpy(&buffer[0], pData, bufferSize);
+    }
+    //
+    /*!
+     * \brief Set the value of a pixel.
+     *
+     * Pixels outside of the buffer's band are ignored.
+     *
+     * \param pX Image x-coordinate.
+     * \param pY Image y-coordinate.
+     * \param pValue Pixel value.
+     */
+    void setPixel(int pX, int pY, bool pValue)
+    {
+        if ((pX < 0) || (pX >= static_cast<int>(W)) || (pY < originY) || (pY >= originY + static_cast<int>(H)))
+            return;
+
+        uint8_t& byte = buffer[bytesPerRow*(pY - originY) + pX/8];
+        const uint8_t mask = 0b10000000 >> (pX % 8);
+
+        if (pValue)
+            byte |= mask;
+        else
+            byte &= ~mask;
+    }
+    //
+    /*!
+     * \brief Draw a line.
+     *
+     * See ArduinoGraphics::line().
+     *
+     * \param pX1 Start point x-coordinate.
+     * \param pY1 Start point y-coordinate.
+     * \param pX2 End point x-coordinate.
+     * \param pY2 End point y-coordinate.
+     */
+    void line(int pX1, int pY1, int pX2, int pY2)
+    {
+        if (!strokeOn)
+            return;
+
+        if (pX1 == pX2)
+            clippedVSpan(pX1, std::min(pY1, pY2), std::max(pY1, pY2), strokeValue);
+        else if (pY1 == pY2)
+            clippedHSpan(std::min(pX1, pX2), std::max(pX1, pX2), pY1, strokeValue);
+        else if ((std::max(pY1, pY2) < originY) || (std::min(pY1, pY2) >= originY + static_cast<int>(H)))
+            return;
+        else if (abs(pY2 - pY1) < abs(pX2 - pX1))
+        {
+            if (pX1 > pX2)
+                lineBresenham(pX2, pY2, pX1, pY1, false);
+            else
+                lineBresenham(pX1, pY1, pX2, pY2, false);
+        }
+        else
+        {
+            if (pY1 > pY2)
+                lineBresenham(pX2, pY2, pX1, pY1, true);
+            else
+                lineBresenham(pX1, pY1, pX2, pY2, true);
+        }
+    }
+    /*!
+     * \brief Draw a point.
+     *
+     * \param pX X-coordinate.
+     * \param pY Y-coordinate.
+     */
+    void point(int pX, int pY)
+    {
+        if (strokeOn)
+            setPixel(pX, pY, strokeValue);
+    }
+    /*!
+     * \brief Draw a rectangle.
+     *
+     * See ArduinoGraphics::rect().
+     *
+     * \param pX Start corner x-coordinate.
+     * \param pY Start corner y-coordinate.
+     * \param pWidth Rectangle width.
+     * \param pHeight Rectangle height.
+     */
+    void rect(int pX, int pY, int pWidth, int pHeight)
+    {
+        if ((!strokeOn && !fillOn) || (pWidth <= 0) || (pHeight <= 0))
+            return;
+
+        const int x1 = pX;
+        const int y1 = pY;
+        const int x2 = x1 + pWidth - 1;
+        const int y2 = y1 + pHeight - 1;
+
+        if (fillOn)
+        {
+            const int border = strokeOn ? 1 : 0;
+
+            for (int y = std::max(y1 + border, originY); y <= std::min(y2 - border, originY + static_cast<int>(H) - 1); ++y)
+                clippedHSpan(x1 + border, x2 - border, y, fillValue);
+        }
+
+        if (strokeOn)
+        {
+            clippedHSpan(x1, x2, y1, strokeValue);
+
+            if (y2 != y1)
+                clippedHSpan(x1, x2, y2, strokeValue);
+
+            clippedVSpan(x1, y1 + 1, y2 - 1, strokeValue);
+
+            if (x2 != x1)
+                clippedVSpan(x2, y1 + 1, y2 - 1, strokeValue);
+        }
+    }
+    //
+    /*!
+     * \brief Draw text.
+     *
+     * See ArduinoGraphics::text().
+     *
+     * \param pStr The text.
+     * \param pX Cursor start position x-coordinate.
+     * \param pY Cursor start position y-coordinate.
+     */
+    void text(const char* pStr, int pX, int pY)
+    {
+        if (!font || !strokeOn)
+            return;
+
+        while (*pStr)
+        {
+            const uint8_t c = *pStr++;
+
+            if (c == '\n')
+                pY += font->height;
+            else if (c == '\r')
+                pX = 0;
+            else if (c == 0xc2 || c == 0xc3)
+            {
+                //Drop
+            }
+            else
+            {
+                //Skip the glyph lookup for text lines outside of the buffer's band
+                if ((pY < originY + static_cast<int>(H)) && (pY + static_cast<int>(font->height) > originY))
+                {
+                    const uint8_t* glyph = font->glyph(c);
+
+                    if (glyph == nullptr)
+                        glyph = font->glyph(' ');
+
+                    if (glyph != nullptr)
+                        glyphBitmap(glyph, pX, pY);
+                }
+
+                pX += font->width;
+            }
+        }
+    }
+    /*!
+     * \brief Set the text font.
+     *
+     * \param pFont The font instance to use.
+     */
+    void textFont(const Font* pFont)
+    {
+        font = pFont;
+    }
+
+private:
+    /*!
+     * \brief Clip a horizontal span to the buffer's band and draw it.
+     *
+     * \param pX1 Start x-coordinate.
+     * \param pX2 End x-coordinate (nothing is drawn if smaller than \p pX1).
+     * \param pY Y-coordinate.
+     * \param pValue Pixel value.
+     */
+    void clippedHSpan(int pX1, int pX2, int pY, bool pValue)
+    {
+        if ((pY < originY) || (pY >= originY + static_cast<int>(H)))
+            return;
+
+        pX1 = std::max(pX1, 0);
+        pX2 = std::min(pX2, static_cast<int>(W) - 1);
+
+        if (pX1 <= pX2)
+            hSpan(pX1, pX2, pY, pValue);
+    }
+    /*!
+     * \brief Clip a vertical span to the buffer's band and draw it.
+     *
+     * \param pX X-coordinate.
+     * \param pY1 Start y-coordinate.
+     * \param pY2 End y-coordinate (nothing is drawn if smaller than \p pY1).
+     * \param pValue Pixel value.
+     */
+    void clippedVSpan(int pX, int pY1, int pY2, bool pValue)
+    {
+        if ((pX < 0) || (pX >= static_cast<int>(W)))
+            return;
+
+        pY1 = std::max(pY1, originY);
+        pY2 = std::min(pY2, originY + static_cast<int>(H) - 1);
+
+        if (pY1 <= pY2)
+            vSpan(pX, pY1, pY2, pValue);
+    }
+    //
+    /*!
+     * \brief Set the value of a horizontal span of pixels.
+     *
+     * Masks the partially covered first and last bytes and fills all bytes in between at once (memset()).
+     *
+     * \param pX1 Start x-coordinate (must be inside the buffer's band).
+     * \param pX2 End x-coordinate (must be inside the buffer's band and not smaller than \p pX1).
+     * \param pY Y-coordinate (must be inside the buffer's band).
+     * \param pValue Pixel value.
+     */
+    void hSpan(int pX1, int pX2, int pY, bool pValue)
+    {
+        uint8_t* row = &buffer[bytesPerRow*(pY - originY)];
+
+        const int byte1 = pX1 / 8;
+        const int byte2 = pX2 / 8;
+
+        const uint8_t mask1 = 0b11111111 >> (pX1 % 8);
+        const uint8_t mask2 = 0b11111111 << (7 - (pX2 % 8));
+
+        const uint8_t fillByte = pValue ? 0b11111111 : 0b00000000;
+
+        if (byte1 == byte2)
+        {
+            const uint8_t mask = mask1 & mask2;
+            row[byte1] = (row[byte1] & ~mask) | (fillByte & mask);
+            return;
+        }
+
+        row[byte1] = (row[byte1] & ~mask1) | (fillByte & mask1);
+
+        if (byte2 > byte1 + 1)
+            memset(&row[byte1 + 1], fillByte, byte2 - byte1 - 1);
+
+        row[byte2] = (row[byte2] & ~mask2) | (fillByte & mask2);
+    }
+    /*!
+     * \brief Set the value of a vertical span of pixels.
+     *
+     * \param pX X-coordinate (must be inside the buffer's band).
+     * \param pY1 Start y-coordinate (must be inside the buffer's band).
+     * \param pY2 End y-coordinate (must be inside the buffer's band and not smaller than \p pY1).
+     * \param pValue Pixel value.
+     */
+    void vSpan(int pX, int pY1, int pY2, bool pValue)
+    {
+        const uint8_t mask = 0b10000000 >> (pX % 8);
+
+        for (size_t idx = bytesPerRow*(pY1 - originY) + pX/8; idx <= bytesPerRow*(pY2 - originY) + pX/8; idx += bytesPerRow)
+        {
+            if (pValue)
+                buffer[idx] |= mask;
+            else
+                buffer[idx] &= ~mask;
+        }
+    }
+    //
+    /*!
+     * \brief Insert the packed glyph of the current font.
+     *
+     * Same as ArduinoGraphics::bitmap() with the unpacked glyph, but reads the packed rows directly while blitting
+     * (see Font::GlyphReader) and blits the blank rows above and below the glyph without reading any data.
+     *
+     * Clips the glyph rows to the buffer's band once and then blits the remaining rows via blitGlyphRows(),
+     * using the variant without horizontal clipping if the glyph lies completely within the image's width.
+     *
+     * \param pGlyph Glyph data (see Font::glyph()).
+     * \param pX Origin x-coordinate.
+     * \param pY Origin y-coordinate.
+     */
+    void glyphBitmap(const uint8_t* pGlyph, int pX, int pY)
+    {
+        const int width = font->width;
+        const int height = font->height;
+
+        const int row1 = (pY < originY) ? (originY - pY) : 0;
+        const int row2 = (pY + height > originY + static_cast<int>(H)) ? (originY + static_cast<int>(H) - pY) : height;
+
+        if ((row1 >= row2) || (pX >= static_cast<int>(W)) || (pX + width <= 0))
+            return;
+
+        if ((pX >= 0) && (pX + width <= static_cast<int>(W)))
+            blitGlyphRows<false>(pGlyph, pX, pY, row1, row2);
+        else
+            blitGlyphRows<true>(pGlyph, pX, pY, row1, row2);
+    }
+    /*!
+     * \brief Blit some rows of a packed glyph of the current font into the buffer.
+     *
+     * See glyphBitmap() and blitBitmapRows().
+     *
+     * \tparam Clipped Mask out columns outside of the image's width (not needed if glyph is completely inside).
+     * \param pGlyph Glyph data (see Font::glyph()).
+     * \param pX Origin x-coordinate.
+     * \param pY Origin y-coordinate.
+     * \param pRow1 First glyph row to blit (must be inside the buffer's band).
+     * \param pRow2 Glyph row after the last row to blit (must be inside the buffer's band).
+     */
+    template<bool Clipped>
+    void blitGlyphRows(const uint8_t* pGlyph, int pX, int pY, int pRow1, int pRow2)
+    {
+        const int width = font->width;
+
+        Font::GlyphReader reader(*font, pGlyph);
+
+        const int rowA = std::min(std::max(pRow1, reader.firstRow()), pRow2);
+        const int rowB = std::max(std::min(pRow2, reader.endRow()), rowA);
+
+        reader.seek(rowA);
+
+        auto nextRow = [&reader, rowA, rowB, j = pRow1]() mutable
+        {
+            const uint16_t rowBits = ((j >= rowA) && (j < rowB)) ? reader.next() : 0;
+            ++j;
+            return rowBits;
+        };
+
+        blitBitmapRows<Clipped>(nextRow, pX, pY, width, pRow1, pRow2);
+    }
+    /*!
+     * \brief Blit some rows of a raw monochrome bitmap into the buffer.
+     *
+     * Shifts each bitmap row into position and writes it to the (at most three) affected buffer bytes using
+     * masking, i.e. with a few byte operations per row instead of one pixel write per bitmap pixel.
+     * Set bitmap bits become the stroke color and unset bits the background color (see glyphBitmap()).
+     *
+     * \tparam Clipped Mask out columns outside of the image's width (not needed if bitmap is completely inside).
+     * \tparam RowSource Callable that returns the bitmap rows (as \p uint16_t, leftmost pixel in MSB) one after the other.
+     * \param pNextRow Source of the bitmap rows, starting at row \p pRow1.
+     * \param pX Origin x-coordinate.
+     * \param pY Origin y-coordinate.
+     * \param pWidth Bitmap width (1 to 16).
+     * \param pRow1 First bitmap row to blit (must be inside the buffer's band).
+     * \param pRow2 Bitmap row after the last row to blit (must be inside the buffer's band).
+     */
+    template<bool Clipped, class RowSource>
+    void blitBitmapRows(RowSource& pNextRow, int pX, int pY, int pWidth, int pRow1, int pRow2)
+    {
+        //Destination byte column of the leftmost bitmap pixel (rounded towards negative infinity) and bit offset within that byte
+        const int startByte = (pX >= 0) ? (pX / 8) : -((7 - pX) / 8);
+        const int shift = pX - 8*startByte;
+
+        uint16_t mask16 = static_cast<uint16_t>(0xFFFF << (16 - pWidth));
+
+        if (Clipped)
+        {
+            for (int i = 0; i < pWidth; ++i)
+                if ((pX + i < 0) || (pX + i >= static_cast<int>(W)))
+                    mask16 &= ~static_cast<uint16_t>(0x8000 >> i);
+        }
+
+        //Align bitmap rows to the upper 24 bits of a 32 bit word, with byte column 'startByte' in bits 31..24
+        const uint32_t mask = static_cast<uint32_t>(mask16) << (16 - shift);
+
+        const uint8_t mask0 = static_cast<uint8_t>(mask >> 24);
+        const uint8_t mask1 = static_cast<uint8_t>(mask >> 16);
+        const uint8_t mask2 = static_cast<uint8_t>(mask >> 8);
+
+        uint8_t* rowPtr = &buffer[bytesPerRow*(pY + pRow1 - originY)];
+
+        for (int j = pRow1; j < pRow2; ++j, rowPtr += bytesPerRow)
+        {
+            const uint32_t fg = (static_cast<uint32_t>(pNextRow()) << (16 - shift)) & mask;
+            const uint32_t val = (strokeValue ? fg : 0) | (backgroundValue ? (mask & ~fg) : 0);
+
+            //Bytes with empty mask may lie outside of the buffer row and must not be touched
+            if (mask0 != 0)
+                rowPtr[startByte] = (rowPtr[startByte] & ~mask0) | (static_cast<uint8_t>(val >> 24) & mask0);
+            if (mask1 != 0)
+                rowPtr[startByte+1] = (rowPtr[startByte+1] & ~mask1) | (static_cast<uint8_t>(val >> 16) & mask1);
+            if (mask2 != 0)
+                rowPtr[startByte+2] = (rowPtr[startByte+2] & ~mask2) | (static_cast<uint8_t>(val >> 8) & mask2);
+        }
+    }
+    //
+    /*!
+     * \brief Draw an oblique line.
+     *
+     * Same as ArduinoGraphics::lineLow() (\p pSteep false) or ArduinoGraphics::lineHigh() (\p pSteep true).
+     *
+     * \param pX1 Start point x-coordinate.
+     * \param pY1 Start point y-coordinate.
+     * \param pX2 End point x-coordinate.
+     * \param pY2 End point y-coordinate.
+     * \param pSteep Line has an angle of at least 45 degrees to the x-axis (iterate over y instead of x).
+     */
+    void lineBresenham(int pX1, int pY1, int pX2, int pY2, bool pSteep)
+    {
+        int dMajor = pSteep ? (pY2 - pY1) : (pX2 - pX1);
+        int dMinor = pSteep ? (pX2 - pX1) : (pY2 - pY1);
+        int step = 1;
+
+        if (dMinor < 0)
+        {
+            step = -1;
+            dMinor = -dMinor;
+        }
+
+        int D = 2*dMinor - dMajor;
+        int minor = pSteep ? pX1 : pY1;
+
+        for (int major = (pSteep ? pY1 : pX1); major <= (pSteep ? pY2 : pX2); ++major)
+        {
+            if (pSteep)
+                setPixel(minor, major, strokeValue);
+            else
+                setPixel(major, minor, strokeValue);
+
+            if (D > 0)
+            {
+                minor += step;
+                D -= 2*dMajor;
+            }
+
+            D += 2*dMinor;
+        }
+    }
+    //
+    /*!
+     * \brief Convert an RGB color to a pixel value.
+     *
+     * \param pR Red color value from 0 to 255.
+     * \param pG Green color value from 0 to 255.
+     * \param pB Blue color value from 0 to 255.
+     * \return True if any of \p pR, \p pG or \p pB is larger than zero.
+     */
+    static bool colorToValue(uint8_t pR, uint8_t pG, uint8_t pB)
+    {
+        return ((pR > 0) || (pG > 0) || (pB > 0));
+    }
+
+private:
+    uint8_t buffer[bufferSize];     ///< Linear buffer with one bit per pixel.
+    int originY;                    ///< Image y-coordinate of the first buffer row.
+    //
+    const Font* font;               ///< Currently used font.
+    //
+    bool fillOn;                    ///< Filling enabled.
+    bool strokeOn;                  ///< Stroke enabled.
+    bool backgroundValue;           ///< Pixel value of background color.
+    bool fillValue;                 ///< Pixel value of fill color.
+    bool strokeValue;               ///< Pixel value of stroke color.
+};
+
+#endif // MONOFRAMEBUFFER_H
@@ -40,11 +40,19 @@
  * The switch connected to "select" pin 0 and "sense" pin 0 is assumed to represent the MSB
  * and, likewise, the LSB is represented by "select" pin \p M-1 and "sense" pin \p N-1.
  *
+ * The switches are scanned via direct access to the GPIO port registers (the pins' ports and bit masks are
+ * determined in setup()): a block is selected by only switching its (already high) "select" pin to output
+ * and all "sense" pins are then sampled with a single read of each port's input register. The sense bits
+ * are gathered from the port inputs with a table of mask-and-shift groups precomputed in setup(), where
+ * all sense pins of a group have the same port and the same bit distance to their result bit.
+ *
  * \attention You must call setup() before using the class.
  */
 template<size_t M, size_t N>
 class MuxedDIPSwitch
 {
+    static_assert(M*N <= 32, "All DIP switch bits must fit into 32 bits.");
+
 public:
     /*!
      * \brief Constructor.
@@ -54,70 +62,114 @@ public:
      */
     MuxedDIPSwitch(std::array<Pin, M> pSelPins, std::array<Pin, N> pSensPins) :
         selPins(pSelPins),
-        sensPins(pSensPins)
+        sensPins(pSensPins),
+        selPorts(),
+        selMasks(),
+        sensGroupPortIdxs(),
+        sensGroupMasks(),
+        sensGroupShifts(),
+        numSensGroups(0)
     {
     }
     //
     /*!
      * \copybrief AS3935::setup()
      *
-     * Sets all "select" and "sense" pins to input mode with pull-down enabled.
+     * Sets all "select" and "sense" pins to input mode with pull-down enabled and determines their GPIO ports and bit masks.
+     * The output level of the "select" pins is set to high already, so that a block is selected by just enabling the output.
+     * Also groups the "sense" pins by port and shift to their result bit (see readSelBlock()).
      */
-    void setup() const
+    void setup()
     {
         for (size_t i = 0; i < M; ++i)
+        {
             pinMode(selPins[i], INPUT_PULLDOWN);
+
+            const uint32_t gpioNum = static_cast<uint32_t>(digitalPinToPinName(selPins[i]));
+
+            selPorts[i] = (gpioNum < 32) ? NRF_P0 : NRF_P1;
+            selMasks[i] = static_cast<uint32_t>(1) << (gpioNum % 32);
+
+            selPorts[i]->OUTSET = selMasks[i];
+        }
+        numSensGroups = 0;
+
         for (size_t i = 0; i < N; ++i)
+        {
             pinMode(sensPins[i], INPUT_PULLDOWN);
+
+            const uint32_t gpioNum = static_cast<uint32_t>(digitalPinToPinName(sensPins[i]));
+
+            const uint8_t portIdx = (gpioNum < 32) ? 0 : 1;
+            const uint32_t mask = static_cast<uint32_t>(1) << (gpioNum % 32);
+            const int8_t shift = static_cast<int8_t>(gpioNum % 32) - static_cast<int8_t>(N - 1 - i);     //sens[0] is MSB
+
+            //Add to group with same port and shift or start a new group
+            size_t group = 0;
+
+            while ((group < numSensGroups) && ((sensGroupPortIdxs[group] != portIdx) || (sensGroupShifts[group] != shift)))
+                ++group;
+
+            if (group == numSensGroups)
+            {
+                sensGroupPortIdxs[group] = portIdx;
+                sensGroupMasks[group] = 0;
+                sensGroupShifts[group] = shift;
+                ++numSensGroups;
+            }
+
+            sensGroupMasks[group] |= mask;
+        }
     }
     //
     /*!
      * \brief Read all N bits for a single select block.
      *
      * \param pNumBlock Number of "select" pin connected to desired bits to read.
-     * \return Read bits for "select" block \p pNumBlock as {sens[0], ..., sens[N-1]}.
+     * \return Read bits for "select" block \p pNumBlock, packed as {sens[0], ..., sens[N-1]} with sens[0] as MSB (bit \p N-1).
      */
-    std::array<bool, N> readSelBlock(size_t pNumBlock) const
+    uint32_t readSelBlock(size_t pNumBlock) const
     {
-        //Disable any previous selection
-        for (size_t i = 0; i < M; ++i)
-            pinMode(selPins[i], INPUT_PULLDOWN);
+        //Select sel block (output level is already high, see setup())
+        selPorts[pNumBlock]->DIRSET = selMasks[pNumBlock];
 
-        //Select sel block
-        pinMode(selPins[pNumBlock], OUTPUT);
-        digitalWrite(selPins[pNumBlock], HIGH);
+        //Let sense lines settle
+        delayMicroseconds(selectSettleMicros);
 
-        //Paranoid
-        delayMicroseconds(10);
+        //Sample all sense pins at once
+        const uint32_t portInputs[2] = {NRF_P0->IN, NRF_P1->IN};
 
-        //Read sens values
+        //Disable selection
+        selPorts[pNumBlock]->DIRCLR = selMasks[pNumBlock];
 
-        std::array<bool, N> retVal;
+        //Gather sense bits from port inputs (one mask and shift per group, see setup())
 
-        for (size_t i = 0; i < N; ++i)
-            retVal[i] = (digitalRead(sensPins[i]) == HIGH);
+        uint32_t retVal = 0;
 
-        //Disable selection
-        digitalWrite(selPins[pNumBlock], LOW);
-        pinMode(selPins[pNumBlock], INPUT_PULLDOWN);
+        for (size_t i = 0; i < numSensGroups; ++i)
+        {
+            const uint32_t bits = portInputs[sensGroupPortIdxs[i]] & sensGroupMasks[i];
+
+            if (sensGroupShifts[i] >= 0)
+                retVal |= bits >> sensGroupShifts[i];
+            else
+                retVal |= bits << -sensGroupShifts[i];
+        }
 
         return retVal;
     }
     /*!
      * \brief Read all M*N bits.
      *
-     * \return Read bits as {sel[0] X sens[0], sel[0] X sens[1], ..., sel[M-1] X sens[N-1]}.
+     * \return Read bits, packed as {sel[0] X sens[0], sel[0] X sens[1], ..., sel[M-1] X sens[N-1]}
+     *         with sel[0] X sens[0] as MSB (bit \p M*N-1).
      */
-    std::array<bool, M*N> readAllBits() const
+    uint32_t readAllBits() const
     {
-        std::array<bool, M*N> retVal;
+        uint32_t retVal = 0;
 
         for (size_t i = 0; i < M; ++i)
-        {
-            std::array<bool, N> blockVals = readSelBlock(i);
-            for (size_t j = 0; j < N; ++j)
-                retVal[i*N+j] = blockVals[j];
-        }
+            retVal = (retVal << N) | readSelBlock(i);
 
         return retVal;
     }
@@ -125,6 +177,16 @@ public:
 private:
     const std::array<Pin, M> selPins;   ///< Select pins with "most significant" select block first (at index 0).
     const std::array<Pin, N> sensPins;  ///< Sense pins with "most significant" sense block first (at index 0).
+    //
+    std::array<NRF_GPIO_Type*, M> selPorts;     ///< GPIO ports of the select pins.
+    std::array<uint32_t, M> selMasks;           ///< Bit masks of the select pins within their GPIO ports.
+    std::array<uint8_t, N> sensGroupPortIdxs;   ///< GPIO port numbers of the sense pin groups.
+    std::array<uint32_t, N> sensGroupMasks;     ///< Bit masks of the sense pin groups within their GPIO ports.
+    std::array<int8_t, N> sensGroupShifts;      ///< Right shifts (left shifts if negative) from port bits to result bits of the sense pin groups.
+    size_t numSensGroups;                       ///< Number of sense pin groups (pins with same port and same shift).
+
+private:
+    static constexpr uint32_t selectSettleMicros = 10;  ///< Wait time between selecting a block and reading its sense pins.
 };
 
 #endif // MUXEDDIPSWITCH_H
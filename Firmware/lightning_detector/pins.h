@@ -69,6 +69,10 @@ static constexpr Pin SPI_BUS_MOSI = 11;     ///< SPI bus \p MOSI pin.
 //
 static constexpr Pin I2C_BUS_SCL = A5;      ///< I2C bus \p SCL pin.
 static constexpr Pin I2C_BUS_SDA = A4;      ///< I2C bus \p SDA pin.
+//
+static constexpr Pin NotConnected = 0xFF;   ///< Placeholder for an optional pin that is not connected.
+//
+static constexpr Pin IOExpanderINT = NotConnected;  ///< Optional interrupt input from display's IO expander (e.g. SX1509 \p NINT).
 
 } // namespace Pins
 
@@ -0,0 +1,248 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "serialconsole.h"
+
+#include <cctype>
+
+constexpr size_t SerialConsole::lineSize;
+constexpr size_t SerialConsole::maxArgs;
+
+//
+
+/*!
+ * \brief Constructor.
+ */
+SerialConsole::SerialConsole() :
+    line(),
+    lineLength(0),
+    lineComplete(false),
+    overflow(false),
+    args(),
+    numArgs(0)
+{
+}
+
+//Public
+
+/*!
+ * \brief Read available characters until a line is complete.
+ *
+ * Only reads characters that are already available from \p pStream, i.e. never waits for input.
+ * Returns as soon as a line is complete, so that remaining characters are left in \p pStream
+ * for the next call. The completed line stays accessible (see getArg()) until the next call.
+ *
+ * \param pStream Stream to read from.
+ * \return If a (non-empty) line was completed.
+ */
+bool SerialConsole::poll(Stream& pStream)
+{
+    //Discard previously completed line
+    if (lineComplete)
+    {
+        lineLength = 0;
+        lineComplete = false;
+        overflow = false;
+        numArgs = 0;
+    }
+
+    while (pStream.available() > 0)
+    {
+        int c = pStream.read();
+
+        if (c < 0)
+            break;
+
+        if ((c == '\r') || (c == '\n'))
+        {
+            if ((lineLength == 0) && !overflow)
+                continue;
+
+            line[lineLength] = '\0';
+            lineComplete = true;
+
+            if (!overflow)
+                tokenize();
+
+            return true;
+        }
+        else if ((c == '\b') || (c == 0x7F))
+        {
+            if (lineLength > 0)
+                --lineLength;
+        }
+        else if (lineLength < lineSize - 1)
+            line[lineLength++] = static_cast<char>(c);
+        else
+            overflow = true;
+    }
+
+    return false;
+}
+
+//
+
+/*!
+ * \brief Check if the completed line was too long.
+ *
+ * \return If the completed line was discarded because it exceeded the line buffer (getNumArgs() is 0 then).
+ */
+bool SerialConsole::lineOverflowed() const
+{
+    return lineComplete && overflow;
+}
+
+/*!
+ * \brief Get the number of arguments of the completed line.
+ *
+ * \note Includes arguments beyond \p maxArgs, which are not accessible via getArg() (i.e. allows to reject such lines).
+ *
+ * \return Number of whitespace-separated arguments (including the command itself) or 0 if no line was completed.
+ */
+size_t SerialConsole::getNumArgs() const
+{
+    return lineComplete ? numArgs : 0;
+}
+
+/*!
+ * \brief Get an argument of the completed line.
+ *
+ * \param pIdx Argument index (0 is the command itself).
+ * \return Argument (empty string if \p pIdx is out of range).
+ */
+const char* SerialConsole::getArg(size_t pIdx) const
+{
+    if ((pIdx >= getNumArgs()) || (pIdx >= maxArgs))
+        return "";
+
+    return args[pIdx];
+}
+
+/*!
+ * \brief Compare an argument of the completed line (case-insensitive).
+ *
+ * \param pIdx Argument index (0 is the command itself).
+ * \param pStr String to compare with.
+ * \return If argument \p pIdx exists and equals \p pStr (ignoring case).
+ */
+bool SerialConsole::argEquals(size_t pIdx, const char* pStr) const
+{
+    if ((pIdx >= getNumArgs()) || (pIdx >= maxArgs))
+        return false;
+
+    const char* arg = args[pIdx];
+
+    for (; (*arg != '\0') && (*pStr != '\0'); ++arg, ++pStr)
+        if (std::tolower(static_cast<unsigned char>(*arg)) != std::tolower(static_cast<unsigned char>(*pStr)))
+            return false;
+
+    return (*arg == '\0') && (*pStr == '\0');
+}
+
+//
+
+/*!
+ * \brief Parse a decimal, hexadecimal or binary number.
+ *
+ * Hexadecimal numbers need a "0x" prefix and binary numbers a "0b" prefix; otherwise
+ * the number is decimal (also with leading zeros, i.e. there is no octal notation).
+ *
+ * \param pStr String to parse.
+ * \param pValue Destination for the parsed number (not modified on failure).
+ * \return If \p pStr is a valid number in the range of \p pValue.
+ */
+bool SerialConsole::parseNumber(const char* pStr, uint32_t& pValue)
+{
+    uint32_t base = 10;
+
+    if ((pStr[0] == '0') && ((pStr[1] == 'x') || (pStr[1] == 'X')))
+    {
+        base = 16;
+        pStr += 2;
+    }
+    else if ((pStr[0] == '0') && ((pStr[1] == 'b') || (pStr[1] == 'B')))
+    {
+        base = 2;
+        pStr += 2;
+    }
+
+    if (*pStr == '\0')
+        return false;
+
+    uint32_t value = 0;
+
+    for (; *pStr != '\0'; ++pStr)
+    {
+        uint32_t digit;
+
+        if ((*pStr >= '0') && (*pStr <= '9'))
+            digit = *pStr - '0';
+        else if ((*pStr >= 'a') && (*pStr <= 'f'))
+            digit = *pStr - 'a' + 10;
+        else if ((*pStr >= 'A') && (*pStr <= 'F'))
+            digit = *pStr - 'A' + 10;
+        else
+            return false;
+
+        if ((digit >= base) || (value > (0xFFFFFFFFu - digit) / base))
+            return false;
+
+        value = value*base + digit;
+    }
+
+    pValue = value;
+
+    return true;
+}
+
+//Private
+
+/*!
+ * \brief Split the completed line into arguments.
+ *
+ * Replaces the whitespace in the line buffer by null characters and stores the
+ * start of each argument (up to \p maxArgs) in \p args (counts all arguments, though).
+ */
+void SerialConsole::tokenize()
+{
+    numArgs = 0;
+
+    bool inArg = false;
+
+    for (size_t i = 0; i < lineLength; ++i)
+    {
+        if ((line[i] == ' ') || (line[i] == '\t'))
+        {
+            line[i] = '\0';
+            inArg = false;
+        }
+        else if (!inArg)
+        {
+            if (numArgs < maxArgs)
+                args[numArgs] = &line[i];
+
+            ++numArgs;
+            inArg = true;
+        }
+    }
+}
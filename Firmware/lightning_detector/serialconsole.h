@@ -0,0 +1,73 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef SERIALCONSOLE_H
+#define SERIALCONSOLE_H
+
+#include <Arduino.h>
+
+#include <array>
+
+/*!
+ * \brief Non-blocking line reader and tokenizer for a serial command console.
+ *
+ * Collects characters from a stream in a fixed-size line buffer without ever waiting for input:
+ * poll() only consumes the characters that are already available and returns as soon as a line
+ * is complete. The completed line is then split into whitespace-separated arguments (see getArg()).
+ * The interpretation of the commands is left to the caller.
+ *
+ * Lines are terminated by CR and/or LF (empty lines are ignored) and backspace/DEL removes the
+ * last character. Lines that exceed the buffer are discarded (see lineOverflowed()).
+ */
+class SerialConsole
+{
+public:
+    SerialConsole();                                        ///< Constructor.
+    //
+    bool poll(Stream& pStream);                             ///< Read available characters until a line is complete.
+    //
+    bool lineOverflowed() const;                            ///< Check if the completed line was too long.
+    size_t getNumArgs() const;                              ///< Get the number of arguments of the completed line.
+    const char* getArg(size_t pIdx) const;                  ///< Get an argument of the completed line.
+    bool argEquals(size_t pIdx, const char* pStr) const;    ///< Compare an argument of the completed line (case-insensitive).
+    //
+    static bool parseNumber(const char* pStr, uint32_t& pValue);    ///< Parse a decimal, hexadecimal or binary number.
+
+private:
+    void tokenize();                                        ///< Split the completed line into arguments.
+
+public:
+    static constexpr size_t lineSize = 64;                  ///< Maximum line length (including terminating null character).
+    static constexpr size_t maxArgs = 4;                    ///< Maximum number of arguments per line.
+
+private:
+    std::array<char, lineSize> line;                        ///< Line buffer.
+    size_t lineLength;                                      ///< Number of characters in the line buffer.
+    bool lineComplete;                                      ///< Line buffer contains a completed line.
+    bool overflow;                                          ///< Line exceeds the line buffer.
+    //
+    std::array<const char*, maxArgs> args;                  ///< Arguments of the completed line (pointing into the line buffer).
+    size_t numArgs;                                         ///< Number of arguments of the completed line.
+};
+
+#endif // SERIALCONSOLE_H
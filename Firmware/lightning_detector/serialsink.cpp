@@ -0,0 +1,276 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "serialsink.h"
+
+#include <algorithm>
+
+constexpr size_t SerialSink::bufferSize;
+constexpr unsigned long SerialSink::maxServiceMicros;
+constexpr size_t SerialSink::stallTimeoutSecs;
+
+static_assert((SerialSink::bufferSize & (SerialSink::bufferSize - 1)) == 0, "Buffer size must be a power of 2.");
+
+//
+
+/*!
+ * \brief Constructor.
+ */
+SerialSink::SerialSink() :
+    Print(),
+    buffer(),
+    readPos(0),
+    commitPos(0),
+    writePos(0),
+    dropping(false),
+    numDropped(0),
+    stalledSecs(0),
+    numStalls(0)
+{
+}
+
+//Public
+
+/*!
+ * \brief Append a byte of a text message.
+ *
+ * The message is complete with its line break. If the buffer is full, the whole
+ * message (including already appended bytes) is dropped up to its line break.
+ *
+ * \param pByte Byte to append.
+ * \return Always 1 (also if dropped).
+ */
+size_t SerialSink::write(uint8_t pByte)
+{
+    if (!dropping && (writePos - readPos >= bufferSize))
+    {
+        writePos = commitPos;
+        dropping = true;
+        ++numDropped;
+    }
+
+    if (dropping)
+    {
+        if (pByte == '\n')
+            dropping = false;
+
+        return 1;
+    }
+
+    buffer[writePos++ % bufferSize] = pByte;
+
+    if (pByte == '\n')
+        commitPos = writePos;
+
+    return 1;
+}
+
+/*!
+ * \brief Append bytes of a text message.
+ *
+ * See write(uint8_t).
+ *
+ * \param pData Bytes to append.
+ * \param pLength Number of bytes.
+ * \return \p pLength (also if dropped).
+ */
+size_t SerialSink::write(const uint8_t* pData, size_t pLength)
+{
+    for (size_t i = 0; i < pLength; ++i)
+        write(pData[i]);
+
+    return pLength;
+}
+
+//
+
+/*!
+ * \brief Append a complete binary message.
+ *
+ * \param pData Message.
+ * \param pLength Message length.
+ * \return If the message fit into the buffer (dropped otherwise).
+ */
+bool SerialSink::writeMessage(const uint8_t* pData, size_t pLength)
+{
+    if (bufferSize - (writePos - readPos) < pLength)
+    {
+        ++numDropped;
+        return false;
+    }
+
+    for (size_t i = 0; i < pLength; ++i)
+        buffer[writePos++ % bufferSize] = pData[i];
+
+    commitPos = writePos;
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Check if there are complete messages to write out.
+ *
+ * \return If service() has something to write.
+ */
+bool SerialSink::pending() const
+{
+    return commitPos != readPos;
+}
+
+/*!
+ * \brief Write buffered messages for a limited time.
+ *
+ * Repeatedly passes the next contiguous chunk of complete messages to \p pWrite, which writes as much
+ * as the serial device can take without blocking (for the USB serial device of the Arduino mbed core one
+ * packet of up to 64 bytes, once the host has read the previous packet). Retries while the device is busy,
+ * but returns after \p maxServiceMicros at the latest (or as soon as all messages are written).
+ *
+ * If the host has not accepted any byte for \p stallTimeoutSecs (see advanceTime()), discards
+ * all buffered messages instead of writing (see getNumStalls()).
+ *
+ * \param pWrite Non-blocking write function of the serial device.
+ * \param pReady If the serial device is ready (e.g. host connected); nothing is written otherwise.
+ */
+void SerialSink::service(WriteFunction pWrite, bool pReady)
+{
+    if (!pReady)
+    {
+        stalledSecs = 0;    //Keep the messages for a host that connects later
+        return;
+    }
+
+    if (stalledSecs >= stallTimeoutSecs)
+    {
+        discard();
+        return;
+    }
+
+    const unsigned long startMicros = micros();
+
+    while (pending() && (micros() - startMicros < maxServiceMicros))
+        writeChunk(pWrite);
+}
+
+/*!
+ * \brief Write all buffered messages.
+ *
+ * Discards the remaining messages if the host does not accept any byte for \p stallTimeoutSecs.
+ *
+ * \note Blocks until all messages are written or discarded. Only meant to be used before closing the serial device.
+ *
+ * \param pWrite Non-blocking write function of the serial device.
+ */
+void SerialSink::drain(WriteFunction pWrite)
+{
+    unsigned long lastProgressMillis = millis();
+
+    while (pending())
+    {
+        if (writeChunk(pWrite) > 0)
+            lastProgressMillis = millis();
+        else if (millis() - lastProgressMillis >= 1000*stallTimeoutSecs)
+        {
+            discard();
+            return;
+        }
+    }
+}
+
+//
+
+/*!
+ * \brief Let time pass for the stall timeout.
+ *
+ * Accumulates the time during which messages are pending but the host does not accept any byte (see service()).
+ *
+ * \param pSecs Elapsed time in seconds.
+ */
+void SerialSink::advanceTime(size_t pSecs)
+{
+    if (pending())
+        stalledSecs += pSecs;
+    else
+        stalledSecs = 0;
+}
+
+//
+
+/*!
+ * \brief Get the number of dropped messages.
+ *
+ * \return Number of messages that did not fit into the buffer.
+ */
+uint32_t SerialSink::getNumDropped() const
+{
+    return numDropped;
+}
+
+/*!
+ * \brief Get the number of discarded buffer contents.
+ *
+ * \return Number of times that all buffered messages were discarded due to a stalled host (see service()).
+ */
+uint32_t SerialSink::getNumStalls() const
+{
+    return numStalls;
+}
+
+//Private
+
+/*!
+ * \brief Try to write the next contiguous chunk of complete messages.
+ *
+ * Passes all complete messages up to the end of the ring buffer to \p pWrite.
+ *
+ * \param pWrite Non-blocking write function of the serial device.
+ * \return Number of written bytes.
+ */
+size_t SerialSink::writeChunk(WriteFunction pWrite)
+{
+    size_t offset = readPos % bufferSize;
+    size_t length = std::min(commitPos - readPos, bufferSize - offset);
+
+    size_t written = std::min(pWrite(&buffer[offset], length), length);
+
+    if (written > 0)
+    {
+        readPos += written;
+        stalledSecs = 0;
+    }
+
+    return written;
+}
+
+/*!
+ * \brief Discard all complete messages due to a stalled host.
+ *
+ * An incomplete text message that is still being appended is kept.
+ */
+void SerialSink::discard()
+{
+    readPos = commitPos;
+    stalledSecs = 0;
+    ++numStalls;
+}
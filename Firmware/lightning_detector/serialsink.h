@@ -0,0 +1,101 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef SERIALSINK_H
+#define SERIALSINK_H
+
+#include <Arduino.h>
+
+#include <array>
+
+/*!
+ * \brief Ring-buffered serial output that never blocks its producers.
+ *
+ * Collects the output (e.g. via the inherited print() functions) in a fixed-size ring buffer
+ * and writes it to the actual serial device in chunks via service(), which is meant to be
+ * called regularly from the main loop (after time-critical work like %AS3935 interrupt processing).
+ * The serial device is accessed via a non-blocking write function (see WriteFunction), such that
+ * a host that does not read the data cannot block the main loop.
+ *
+ * Output is organized in messages: text messages end with a line break, binary messages are
+ * appended as a whole via writeMessage(). Only complete messages are written out. If a message
+ * does not fit into the free buffer space, the whole message is dropped (and counted, see getNumDropped()).
+ * If the host accepts nothing for \p stallTimeoutSecs (see advanceTime()), all buffered messages are
+ * discarded (and counted, see getNumStalls()).
+ */
+class SerialSink : public Print
+{
+public:
+    /*!
+     * \brief Non-blocking write function for the serial device.
+     *
+     * Must return immediately, writing only as many bytes as the device can currently take.
+     *
+     * \param pData Bytes to write.
+     * \param pLength Number of bytes.
+     * \return Number of written bytes (0 if the device is busy).
+     */
+    using WriteFunction = size_t (*)(const uint8_t* pData, size_t pLength);
+
+public:
+    SerialSink();                                               ///< Constructor.
+    //
+    size_t write(uint8_t pByte) override;                       ///< Append a byte of a text message.
+    size_t write(const uint8_t* pData, size_t pLength) override;    ///< Append bytes of a text message.
+    using Print::write;
+    //
+    bool writeMessage(const uint8_t* pData, size_t pLength);    ///< Append a complete binary message.
+    //
+    bool pending() const;                                       ///< Check if there are complete messages to write out.
+    void service(WriteFunction pWrite, bool pReady);            ///< Write buffered messages for a limited time.
+    void drain(WriteFunction pWrite);                           ///< Write all buffered messages.
+    //
+    void advanceTime(size_t pSecs);                             ///< Let time pass for the stall timeout.
+    //
+    uint32_t getNumDropped() const;                             ///< Get the number of dropped messages.
+    uint32_t getNumStalls() const;                              ///< Get the number of discarded buffer contents.
+
+private:
+    size_t writeChunk(WriteFunction pWrite);                    ///< Try to write the next contiguous chunk of complete messages.
+    void discard();                                             ///< Discard all complete messages due to a stalled host.
+
+public:
+    static constexpr size_t bufferSize = 4096;                  ///< Size of the ring buffer (power of 2).
+    static constexpr unsigned long maxServiceMicros = 2000;     ///< Maximum time to spend per service() call in microseconds.
+    static constexpr size_t stallTimeoutSecs = 5;               ///< Time without any accepted byte until buffered messages are discarded.
+
+private:
+    std::array<uint8_t, bufferSize> buffer;                     ///< Ring buffer.
+    //
+    size_t readPos;                                             ///< Position of the next byte to write out (not wrapped).
+    size_t commitPos;                                           ///< End of the complete messages (not wrapped).
+    size_t writePos;                                            ///< End of the incomplete message (not wrapped).
+    //
+    bool dropping;                                              ///< Currently dropping the rest of a text message.
+    uint32_t numDropped;                                        ///< Number of dropped messages.
+    //
+    size_t stalledSecs;                                         ///< Time since the host last accepted any byte (while messages are pending).
+    uint32_t numStalls;                                         ///< Number of discarded buffer contents.
+};
+
+#endif // SERIALSINK_H
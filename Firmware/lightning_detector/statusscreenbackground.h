@@ -0,0 +1,41 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef STATUSSCREENBACKGROUND_H
+#define STATUSSCREENBACKGROUND_H
+
+#include "statusscreenlayout.h"
+
+#include <Arduino.h>
+
+/*!
+ * \brief Prerendered static parts of the status screen (see StatusScreenLayout::recordStaticParts()).
+ *
+ * 1 bit per pixel, rows of 25 bytes from top to bottom, leftmost pixel of each byte in the MSB and
+ * white pixels set (i.e. the format of the e-paper display controller's RAM and of MonoFramebuffer).
+ *
+ * Generated by tools/render_status_background.cpp (see statusscreenbackground.cpp).
+ */
+extern const uint8_t StatusScreenBackground[StatusScreenLayout::screenSize * StatusScreenLayout::screenSize / 8];
+
+#endif // STATUSSCREENBACKGROUND_H
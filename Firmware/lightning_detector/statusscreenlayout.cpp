@@ -0,0 +1,77 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "statusscreenlayout.h"
+
+#include "fonts.h"
+
+#ifdef FONTS_INCLUDE_ALL
+
+#include "drawlist.h"
+
+/*!
+ * \brief Record the static parts of the status screen.
+ *
+ * Records frame, caption, field labels and decoration lines into \p pDrawList (after clearing it).
+ * Used to generate the prerendered background image StatusScreenBackground (see tools/render_status_background.cpp),
+ * which must be regenerated whenever this function or the layout constants are changed.
+ * Only available for the host tools (see FONTS_INCLUDE_ALL), since the firmware does not include the needed full fonts.
+ *
+ * \param pDrawList Draw list to record to.
+ */
+void StatusScreenLayout::recordStaticParts(DrawList& pDrawList)
+{
+    pDrawList.clear();
+
+    //Draw Frame
+    pDrawList.rect(frameMargin, frameMargin, screenSize - 2*frameMargin, screenSize - 2*frameMargin);
+
+    //Write header/caption text
+    pDrawList.text(&Font_TerminASCII24Bold, " Lightning Det. ", textOfsX, textOfsY+captionExtraPadding);
+
+    //Write field labels
+    pDrawList.text(&Font_TerminASCII24, "Lightnings  Rate", textOfsX, rowY0);
+    pDrawList.text(&Font_TerminASCII24, "Battery Distance", textOfsX, rowY0 + 2*rowPitch);
+    pDrawList.text(&Font_TerminASCII24, "Run Time", textOfsX + 8*charWidth, rowY0 + 4*rowPitch);
+
+    //Add decoration lines
+
+    const int16_t xPosSep1 = textOfsX + static_cast<int16_t>(10.5*charWidth);
+    const int16_t xPosSep2 = textOfsX + static_cast<int16_t>(7.5*charWidth);
+
+    const int16_t yPos0 = captionLineY;
+    const int16_t yPos1 = yPos0 + 2*rowPitch;
+    const int16_t yPos2 = yPos1 + 2*rowPitch;
+    const int16_t yPos3 = yPos2 + rowPitch;
+
+    const int16_t xyMax = screenSize - 1 - frameMargin;
+
+    pDrawList.line(frameMargin, yPos0, xyMax, yPos0);
+    pDrawList.line(frameMargin, yPos1, xyMax, yPos1);
+    pDrawList.line(xPosSep1, yPos0, xPosSep1, yPos1);
+    pDrawList.line(xPosSep2, yPos1, xPosSep2, xyMax);
+    pDrawList.line(xPosSep2, yPos2, xyMax, yPos2);
+    pDrawList.line(frameMargin, yPos3, xPosSep2, yPos3);
+}
+
+#endif // FONTS_INCLUDE_ALL
@@ -0,0 +1,66 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef STATUSSCREENLAYOUT_H
+#define STATUSSCREENLAYOUT_H
+
+#include <Arduino.h>
+
+#ifdef FONTS_INCLUDE_ALL
+class DrawList;
+#endif
+
+/*!
+ * \brief Layout of the 200x200 pixels status screen of the e-paper display.
+ *
+ * Defines the geometry shared by the display driver (positions of the text fields) and the
+ * prerendered status screen background (see recordStaticParts(), StatusScreenBackground).
+ */
+namespace StatusScreenLayout
+{
+
+constexpr int16_t screenSize = 200;                 ///< Width and height of the screen.
+//
+constexpr int16_t frameMargin = 1;                  ///< Distance of the frame to the display edges.
+constexpr int16_t textOfsX = 4;                     ///< X-coordinate of the left text column.
+constexpr int16_t textOfsY = 4;                     ///< Y-offset of the caption text.
+constexpr int16_t textPadding = 3;                  ///< Vertical space between text rows.
+constexpr int16_t captionExtraPadding = 3;          ///< Additional vertical space above and below the caption.
+constexpr int16_t charWidth = 12;                   ///< Character width of the used fonts.
+constexpr int16_t charHeight = 24;                  ///< Character height of the used fonts.
+constexpr int16_t captionLineY = textOfsY + 2*captionExtraPadding + charHeight + 1;    ///< Y-coordinate of the line below the caption.
+constexpr int16_t rowY0 = captionLineY - 1 + textPadding;                               ///< Y-coordinate of the first text row below the caption.
+constexpr int16_t rowPitch = charHeight + textPadding;                                  ///< Distance between text rows.
+//
+constexpr char fieldCharacters[] = " %-./0123456789?DEINORSTVadfhikmnst";   ///< All characters that the text fields can show
+                                                                            ///< (only these are contained in Font_TerminASCII24Status).
+
+//
+
+#ifdef FONTS_INCLUDE_ALL
+void recordStaticParts(DrawList& pDrawList);        ///< Record the static parts of the status screen.
+#endif
+
+} // namespace StatusScreenLayout
+
+#endif // STATUSSCREENLAYOUT_H
@@ -0,0 +1,276 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "telemetry.h"
+
+#include "auxil.h"
+
+namespace Telemetry
+{
+
+namespace
+{
+
+static_assert(maxPayloadSize + 4 < 0xFF, "COBS encoding below assumes a single code block per frame.");
+
+/*!
+ * \brief Write a 16 bit value in little-endian byte order.
+ *
+ * \param pDest Destination.
+ * \param pValue Value to write.
+ * \return Position after the written bytes.
+ */
+uint8_t* put16(uint8_t* pDest, uint16_t pValue)
+{
+    pDest[0] = static_cast<uint8_t>(pValue);
+    pDest[1] = static_cast<uint8_t>(pValue >> 8);
+    return pDest + 2;
+}
+
+/*!
+ * \brief Write a 32 bit value in little-endian byte order.
+ *
+ * \param pDest Destination.
+ * \param pValue Value to write.
+ * \return Position after the written bytes.
+ */
+uint8_t* put32(uint8_t* pDest, uint32_t pValue)
+{
+    return put16(put16(pDest, static_cast<uint16_t>(pValue)), static_cast<uint16_t>(pValue >> 16));
+}
+
+/*!
+ * \brief Read a 16 bit value in little-endian byte order.
+ *
+ * \param pSrc Source.
+ * \return Read value.
+ */
+uint16_t get16(const uint8_t* pSrc)
+{
+    return static_cast<uint16_t>(pSrc[0] | (pSrc[1] << 8));
+}
+
+/*!
+ * \brief Read a 32 bit value in little-endian byte order.
+ *
+ * \param pSrc Source.
+ * \return Read value.
+ */
+uint32_t get32(const uint8_t* pSrc)
+{
+    return get16(pSrc) | (static_cast<uint32_t>(get16(pSrc + 2)) << 16);
+}
+
+/*!
+ * \brief Append the CRC-32 to a payload and encode it as frame.
+ *
+ * \param pPayload Payload with 4 spare bytes at the end for the CRC-32.
+ * \param pLength Payload length (without CRC-32).
+ * \param pFrame Destination for the frame (at least \p maxFrameSize bytes).
+ * \return Frame length (including the enclosing zero bytes).
+ */
+size_t encodeFrame(uint8_t* pPayload, size_t pLength, uint8_t* pFrame)
+{
+    put32(pPayload + pLength, Auxil::crc32(pPayload, pLength));
+
+    //COBS: replace each zero byte by the distance to the next zero byte (or to the end)
+
+    size_t frameLength = 0;
+
+    pFrame[frameLength++] = 0;
+
+    size_t codePos = frameLength++;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < pLength + 4; ++i)
+    {
+        if (pPayload[i] == 0)
+        {
+            pFrame[codePos] = code;
+            codePos = frameLength++;
+            code = 1;
+        }
+        else
+        {
+            pFrame[frameLength++] = pPayload[i];
+            ++code;
+        }
+    }
+
+    pFrame[codePos] = code;
+
+    pFrame[frameLength++] = 0;
+
+    return frameLength;
+}
+
+} // namespace
+
+//
+
+/*!
+ * \brief Encode an event record as frame.
+ *
+ * \param pRecord Event record.
+ * \param pFrame Destination for the frame (at least \p maxFrameSize bytes).
+ * \return Frame length.
+ */
+size_t encodeEvent(const EventRecord& pRecord, uint8_t* pFrame)
+{
+    uint8_t payload[eventPayloadSize + 4];
+
+    uint8_t* pos = payload;
+
+    *pos++ = static_cast<uint8_t>(FrameType::Event);
+    pos = put32(pos, pRecord.timeSecs);
+    *pos++ = pRecord.type;
+    pos = put32(pos, pRecord.energy);
+    *pos++ = pRecord.distance;
+
+    return encodeFrame(payload, eventPayloadSize, pFrame);
+}
+
+/*!
+ * \brief Encode a status record as frame.
+ *
+ * \param pRecord Status record.
+ * \param pFrame Destination for the frame (at least \p maxFrameSize bytes).
+ * \return Frame length.
+ */
+size_t encodeStatus(const StatusRecord& pRecord, uint8_t* pFrame)
+{
+    uint8_t payload[statusPayloadSize + 4];
+
+    uint8_t* pos = payload;
+
+    *pos++ = static_cast<uint8_t>(FrameType::Status);
+    pos = put32(pos, pRecord.timeSecs);
+    pos = put16(pos, pRecord.vddMilliVolts);
+    *pos++ = pRecord.batteryPercentage;
+    *pos++ = pRecord.energyTier;
+    pos = put32(pos, pRecord.lightningCount);
+    pos = put16(pos, pRecord.lightningRate);
+    pos = put32(pos, pRecord.wakeUpCount);
+    *pos++ = pRecord.flags;
+
+    return encodeFrame(payload, statusPayloadSize, pFrame);
+}
+
+//
+
+/*!
+ * \brief Decode a received frame and check its CRC-32.
+ *
+ * \param pData Received bytes between two zero bytes.
+ * \param pLength Number of bytes in \p pData.
+ * \param pPayload Destination for the payload (also temporarily holds the CRC-32).
+ * \param pMaxPayloadLength Size of \p pPayload.
+ * \return Payload length (without CRC-32) or 0 if the frame is empty, malformed, too long or corrupted.
+ */
+size_t decodeFrame(const uint8_t* pData, size_t pLength, uint8_t* pPayload, size_t pMaxPayloadLength)
+{
+    size_t length = 0;
+
+    for (size_t i = 0; i < pLength; )
+    {
+        uint8_t code = pData[i++];
+
+        if (code == 0)
+            return 0;
+
+        for (uint8_t j = 1; j < code; ++j)
+        {
+            if ((i >= pLength) || (length >= pMaxPayloadLength))
+                return 0;
+
+            pPayload[length++] = pData[i++];
+        }
+
+        //Restore replaced zero byte (except for the implicit one at the end)
+        if ((code < 0xFF) && (i < pLength))
+        {
+            if (length >= pMaxPayloadLength)
+                return 0;
+
+            pPayload[length++] = 0;
+        }
+    }
+
+    if (length < 1 + 4)
+        return 0;
+
+    length -= 4;
+
+    if (get32(pPayload + length) != Auxil::crc32(pPayload, length))
+        return 0;
+
+    return length;
+}
+
+/*!
+ * \brief Parse the payload of an event frame.
+ *
+ * \param pPayload Decoded payload (see decodeFrame()).
+ * \param pLength Payload length.
+ * \param pRecord Destination for the event record.
+ * \return If the payload is an event record.
+ */
+bool parseEvent(const uint8_t* pPayload, size_t pLength, EventRecord& pRecord)
+{
+    if ((pLength != eventPayloadSize) || (pPayload[0] != static_cast<uint8_t>(FrameType::Event)))
+        return false;
+
+    pRecord.timeSecs = get32(pPayload + 1);
+    pRecord.type = pPayload[5];
+    pRecord.energy = get32(pPayload + 6);
+    pRecord.distance = pPayload[10];
+
+    return true;
+}
+
+/*!
+ * \brief Parse the payload of a status frame.
+ *
+ * \param pPayload Decoded payload (see decodeFrame()).
+ * \param pLength Payload length.
+ * \param pRecord Destination for the status record.
+ * \return If the payload is a status record.
+ */
+bool parseStatus(const uint8_t* pPayload, size_t pLength, StatusRecord& pRecord)
+{
+    if ((pLength != statusPayloadSize) || (pPayload[0] != static_cast<uint8_t>(FrameType::Status)))
+        return false;
+
+    pRecord.timeSecs = get32(pPayload + 1);
+    pRecord.vddMilliVolts = get16(pPayload + 5);
+    pRecord.batteryPercentage = pPayload[7];
+    pRecord.energyTier = pPayload[8];
+    pRecord.lightningCount = get32(pPayload + 9);
+    pRecord.lightningRate = get16(pPayload + 13);
+    pRecord.wakeUpCount = get32(pPayload + 15);
+    pRecord.flags = pPayload[19];
+
+    return true;
+}
+
+} // namespace Telemetry
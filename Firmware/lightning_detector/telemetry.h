@@ -0,0 +1,109 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+/*!
+ * \brief Compact binary telemetry format for the serial connection.
+ *
+ * Each record is sent as a single frame: the payload (frame type followed by the record fields in
+ * little-endian byte order) and its CRC-32 (see Auxil::crc32(), little-endian) are COBS-encoded
+ * (consistent overhead byte stuffing, which removes all zero bytes) and enclosed by zero bytes.
+ * A receiver can therefore resynchronize at any zero byte and discard corrupted frames as well as
+ * interleaved text (e.g. serial console output) via the CRC-32. Empty frames are to be ignored.
+ *
+ * The layout of an existing frame type is never changed; new or extended records get a new FrameType.
+ *
+ * The functions do not access any hardware, so that the format can be decoded by host tools with the same code.
+ */
+namespace Telemetry
+{
+
+/*!
+ * \brief Types of the telemetry frames (first payload byte).
+ */
+enum class FrameType : uint8_t
+{
+    Event = 1,      ///< %AS3935 event (see EventRecord).
+    Status = 2      ///< Periodic device status (see StatusRecord).
+};
+
+/*!
+ * \brief %AS3935 event record.
+ */
+struct EventRecord
+{
+    uint32_t timeSecs;          ///< Estimated run time at the event in seconds.
+    uint8_t type;               ///< Interrupt type (raw AS3935::InterruptType value).
+    uint32_t energy;            ///< Lightning energy (raw value; 0 for other interrupt types).
+    uint8_t distance;           ///< Storm distance in km (63 if out of range).
+};
+
+/*!
+ * \brief Device status record.
+ */
+struct StatusRecord
+{
+    uint32_t timeSecs;          ///< Estimated run time in seconds.
+    uint16_t vddMilliVolts;     ///< Latest measured supply voltage in mV.
+    uint8_t batteryPercentage;  ///< Estimated battery percentage.
+    uint8_t energyTier;         ///< Index of the current energy tier.
+    uint32_t lightningCount;    ///< Number of lightnings since the last statistics reset.
+    uint16_t lightningRate;     ///< Current lightning rate in units of 0.01 per minute.
+    uint32_t wakeUpCount;       ///< Number of wake-ups from sleep.
+    uint8_t flags;              ///< Status flags (see StatusFlags).
+};
+
+/*!
+ * \brief Bits of StatusRecord::flags.
+ */
+enum StatusFlags : uint8_t
+{
+    LowBattery = 0b00000001,    ///< Low battery state (beep and display update disabled).
+    AS3935Off = 0b00000010      ///< %AS3935 currently powered down according to the energy tier.
+};
+
+//
+
+constexpr size_t eventPayloadSize = 1 + 4 + 1 + 4 + 1;          ///< Payload size of a FrameType::Event frame.
+constexpr size_t statusPayloadSize = 1 + 4 + 2 + 1 + 1 + 4 + 2 + 4 + 1;    ///< Payload size of a FrameType::Status frame.
+constexpr size_t maxPayloadSize = statusPayloadSize;            ///< Maximum payload size of all frame types.
+constexpr size_t maxFrameSize = 1 + (maxPayloadSize + 4) + 1 + 1;   ///< \brief Maximum encoded frame size
+                                                                    ///  (delimiters, COBS code byte, payload and CRC-32).
+
+//
+
+size_t encodeEvent(const EventRecord& pRecord, uint8_t* pFrame);    ///< Encode an event record as frame.
+size_t encodeStatus(const StatusRecord& pRecord, uint8_t* pFrame);  ///< Encode a status record as frame.
+//
+size_t decodeFrame(const uint8_t* pData, size_t pLength, uint8_t* pPayload, size_t pMaxPayloadLength);
+                                                                    ///< Decode a received frame and check its CRC-32.
+bool parseEvent(const uint8_t* pPayload, size_t pLength, EventRecord& pRecord);     ///< Parse the payload of an event frame.
+bool parseStatus(const uint8_t* pPayload, size_t pLength, StatusRecord& pRecord);   ///< Parse the payload of a status frame.
+
+} // namespace Telemetry
+
+#endif // TELEMETRY_H
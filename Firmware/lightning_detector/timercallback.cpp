@@ -67,9 +67,25 @@ void TimerCallback::setup() const
 
 /*!
  * \brief Start the timer.
+ *
+ * Uses the timeout passed to TimerCallback().
  */
 void TimerCallback::startTimer() const
 {
+    startTimer(timeoutCtr125ms);
+}
+
+/*!
+ * \brief Start the timer with a different timeout.
+ *
+ * Uses \p pTimeoutCtr125ms instead of the timeout passed to TimerCallback() for this run of the timer.
+ *
+ * \param pTimeoutCtr125ms Timer timeout in steps of 125ms.
+ */
+void TimerCallback::startTimer(uint32_t pTimeoutCtr125ms) const
+{
+    timer->CC[0] = pTimeoutCtr125ms;
+
     sd_nvic_EnableIRQ(irqType);
     timer->TASKS_START = 1;
 }
@@ -51,6 +51,7 @@ public:
     void setup() const;         ///< Configure RTC timer peripheral and set instance callback as interrupt vector.
     //
     void startTimer() const;    ///< Start the timer.
+    void startTimer(uint32_t pTimeoutCtr125ms) const;   ///< Start the timer with a different timeout.
     uint32_t stopTimer() const; ///< Stop the timer.
 
 private:
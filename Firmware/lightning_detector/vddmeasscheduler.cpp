@@ -0,0 +1,136 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "vddmeasscheduler.h"
+
+#include <algorithm>
+
+/*!
+ * \brief Constructor.
+ *
+ * \param pNominalIntervalSecs Interval in seconds to use as long as no discharge slope is known.
+ * \param pMinIntervalSecs Minimum interval in seconds.
+ * \param pMaxIntervalSecs Maximum interval in seconds (flat discharge curve).
+ * \param pHighLoadMaxIntervalSecs Maximum interval in seconds under high load.
+ * \param pThresholdVoltage Voltage threshold (e.g. low battery threshold) to predict the remaining time for.
+ * \param pPredictionFraction Fraction of the predicted time until \p pThresholdVoltage to use as interval.
+ */
+VDDMeasScheduler::VDDMeasScheduler(size_t pNominalIntervalSecs, size_t pMinIntervalSecs, size_t pMaxIntervalSecs,
+                                   size_t pHighLoadMaxIntervalSecs, float pThresholdVoltage, float pPredictionFraction) :
+    nominalIntervalSecs(pNominalIntervalSecs),
+    minIntervalSecs(pMinIntervalSecs),
+    maxIntervalSecs(pMaxIntervalSecs),
+    highLoadMaxIntervalSecs(pHighLoadMaxIntervalSecs),
+    thresholdVoltage(pThresholdVoltage),
+    predictionFraction(pPredictionFraction),
+    measured(false),
+    slopeValid(false),
+    lastVoltage(0),
+    refVoltage(0),
+    secsSinceRef(0),
+    dischargeSlope(0)
+{
+}
+
+//Public
+
+/*!
+ * \brief Update the discharge slope estimate with a new measurement.
+ *
+ * The first measurement only sets the slope reference point. Later measurements update the (exponentially
+ * smoothed) slope estimate as soon as at least the minimum interval has passed since the reference point.
+ *
+ * \param pVoltage Measured voltage.
+ * \param pSecsSinceLastMeas Elapsed time since the previous measurement in seconds.
+ */
+void VDDMeasScheduler::registerMeasurement(float pVoltage, size_t pSecsSinceLastMeas)
+{
+    lastVoltage = pVoltage;
+
+    if (!measured)
+    {
+        measured = true;
+
+        refVoltage = pVoltage;
+        secsSinceRef = 0;
+
+        return;
+    }
+
+    secsSinceRef += pSecsSinceLastMeas;
+
+    if ((secsSinceRef == 0) || (secsSinceRef < minIntervalSecs))
+        return;
+
+    float slope = (refVoltage - pVoltage) / static_cast<float>(secsSinceRef);
+
+    if (slopeValid)
+        dischargeSlope = 0.5 * (dischargeSlope + slope);
+    else
+        dischargeSlope = slope;
+
+    slopeValid = true;
+
+    refVoltage = pVoltage;
+    secsSinceRef = 0;
+}
+
+//
+
+/*!
+ * \brief Get the interval until the next scheduled measurement.
+ *
+ * Uses the predicted time until the voltage threshold is reached (from the latest voltage and the discharge slope),
+ * multiplied by the prediction fraction and clamped to the minimum/maximum interval (see VDDMeasScheduler()).
+ *
+ * \param pHighLoad Use the smaller maximum interval for high load.
+ * \return Interval in seconds (0 if no measurement was registered yet).
+ */
+size_t VDDMeasScheduler::getIntervalSecs(bool pHighLoad) const
+{
+    if (!measured)
+        return 0;
+
+    size_t upperLimit = pHighLoad ? std::min(maxIntervalSecs, highLoadMaxIntervalSecs) : maxIntervalSecs;
+
+    size_t interval;
+
+    if (!slopeValid)
+        interval = nominalIntervalSecs;
+    else if (lastVoltage <= thresholdVoltage)
+        interval = minIntervalSecs;
+    else if (dischargeSlope <= 0)
+        interval = upperLimit;
+    else
+    {
+        float predictedSecs = (lastVoltage - thresholdVoltage) / dischargeSlope;
+        float scheduledSecs = predictionFraction * predictedSecs;
+
+        if (scheduledSecs >= static_cast<float>(upperLimit))
+            interval = upperLimit;
+        else
+            interval = static_cast<size_t>(scheduledSecs);
+    }
+
+    return std::max(minIntervalSecs, std::min(interval, upperLimit));
+}
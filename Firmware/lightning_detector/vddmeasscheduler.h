@@ -0,0 +1,71 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef VDDMEASSCHEDULER_H
+#define VDDMEASSCHEDULER_H
+
+#include <Arduino.h>
+
+/*!
+ * \brief Adaptive scheduling of the occasional VDD measurements.
+ *
+ * Tracks the discharge slope of the battery voltage and derives the interval until the next VDD measurement
+ * from the predicted time until the voltage reaches a threshold (the low battery threshold). This results in
+ * rare measurements while the discharge curve is flat (long plateau of a coin cell) and more frequent ones
+ * when approaching the "knee" of the curve, where an early detection of the low battery state matters.
+ *
+ * The interval is bounded by a minimum and a maximum interval. Under high load (i.e. high lightning activity)
+ * the interval is additionally bounded by a smaller maximum interval. Before the first measurement
+ * the interval is zero (measure immediately) and until a slope is known a nominal interval is used.
+ *
+ * The slope is only updated once at least the minimum interval has passed since the previous slope
+ * reference point, so that short-term fluctuations between closely spaced (e.g. button-triggered)
+ * measurements do not dominate the estimate.
+ */
+class VDDMeasScheduler
+{
+public:
+    VDDMeasScheduler(size_t pNominalIntervalSecs, size_t pMinIntervalSecs, size_t pMaxIntervalSecs, size_t pHighLoadMaxIntervalSecs,
+                     float pThresholdVoltage, float pPredictionFraction);  ///< Constructor.
+    //
+    void registerMeasurement(float pVoltage, size_t pSecsSinceLastMeas);    ///< Update the discharge slope estimate with a new measurement.
+    //
+    size_t getIntervalSecs(bool pHighLoad) const;                           ///< Get the interval until the next scheduled measurement.
+
+private:
+    const size_t nominalIntervalSecs;       ///< Interval to use as long as no discharge slope is known.
+    const size_t minIntervalSecs;           ///< Minimum interval.
+    const size_t maxIntervalSecs;           ///< Maximum interval.
+    const size_t highLoadMaxIntervalSecs;   ///< Maximum interval under high load.
+    const float thresholdVoltage;           ///< Voltage threshold to predict the remaining time for.
+    const float predictionFraction;         ///< Fraction of the predicted remaining time to use as interval.
+    //
+    bool measured;                  ///< At least one measurement was registered.
+    bool slopeValid;                ///< A discharge slope estimate is available.
+    float lastVoltage;              ///< Latest measured voltage.
+    float refVoltage;               ///< Voltage at the slope reference point.
+    size_t secsSinceRef;            ///< Elapsed time since the slope reference point.
+    float dischargeSlope;           ///< Smoothed discharge slope in Volt per second (positive for decreasing voltage).
+};
+
+#endif // VDDMEASSCHEDULER_H
@@ -0,0 +1,466 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host tool that converts a monospaced bitmap font in BDF format into the packed Font format of the firmware
+ * (see font.h) and writes it as a font source file for the 'fonts/' directory (included by fonts.cpp).
+ *
+ * Only glyphs with encodings FIRST to LAST (default: 0 to 255) are converted; for ISO 10646 fonts these are
+ * the ISO 8859-1 characters. Alternatively, only the glyphs of the characters in CHARACTERS (plus the space,
+ * which is the fallback glyph for missing characters) are converted, which creates a font subset that e.g.
+ * only covers the characters that the firmware actually draws with the font (see StatusScreenLayout::fieldCharacters).
+ * Fonts in PCF format can be converted to BDF first, e.g. using 'pcf2bdf'.
+ * The written license notice assumes a font licensed under the SIL Open Font License with the Reserved Font Name
+ * "<FAMILY_NAME> Font" (as for the Terminus Font) and must be adapted for other fonts.
+ *
+ * Build and run from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -o bdf2font tools/bdf2font.cpp
+ *     ./bdf2font ter-u24n.bdf Font_TerminASCII24 lightning_detector/fonts/font_terminascii24.cpp 0x00 0xFE
+ *     ./bdf2font ter-u24n.bdf Font_TerminASCII24Status lightning_detector/fonts/font_terminascii24status.cpp \
+ *         " %-./0123456789?DEINORSTVadfhikmnst"
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/*
+ * Glyph as read from the BDF file.
+ */
+struct BDFGlyph
+{
+    std::string name;                   // Glyph name.
+    int bbxWidth = 0;                   // Bounding box width.
+    int bbxHeight = 0;                  // Bounding box height.
+    int bbxOfsX = 0;                    // Bounding box x-offset from origin.
+    int bbxOfsY = 0;                    // Bounding box y-offset from baseline.
+    std::vector<std::string> hexRows;   // Bitmap rows as hex strings (top to bottom).
+};
+
+/*
+ * Relevant contents of a BDF file.
+ */
+struct BDFFont
+{
+    int fbbWidth = 0;                       // Font bounding box width.
+    int fbbHeight = 0;                      // Font bounding box height.
+    int fbbOfsX = 0;                        // Font bounding box x-offset.
+    int fbbOfsY = 0;                        // Font bounding box y-offset.
+    int ascent = -1;                        // Font ascent (-1 if not specified).
+    int descent = -1;                       // Font descent (-1 if not specified).
+    std::map<std::string, std::string> properties;  // String properties (without quotes).
+    std::map<long, BDFGlyph> glyphs;        // Glyphs by encoding.
+};
+
+const char gplHeader[] =
+R"(/*
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+)";
+
+/*
+ * Remove surrounding quotes from a BDF property value.
+ */
+std::string unquote(const std::string& pStr)
+{
+    if (pStr.size() >= 2 && pStr.front() == '"' && pStr.back() == '"')
+        return pStr.substr(1, pStr.size() - 2);
+
+    return pStr;
+}
+
+/*
+ * Parse a BDF file. Returns false and prints an error on failure.
+ */
+bool readBDF(const char* pFileName, BDFFont& pFont)
+{
+    std::ifstream file(pFileName);
+
+    if (!file)
+    {
+        std::fprintf(stderr, "Error: Could not open \"%s\".\n", pFileName);
+        return false;
+    }
+
+    std::string line;
+    BDFGlyph glyph;
+    long encoding = -1;
+    bool inProperties = false;
+    bool inBitmap = false;
+
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        std::istringstream stream(line);
+        std::string keyword;
+        stream >> keyword;
+
+        if (inBitmap)
+        {
+            if (keyword == "ENDCHAR")
+            {
+                if (encoding >= 0)
+                    pFont.glyphs[encoding] = glyph;
+
+                inBitmap = false;
+            }
+            else
+                glyph.hexRows.push_back(keyword);
+        }
+        else if (inProperties)
+        {
+            if (keyword == "ENDPROPERTIES")
+                inProperties = false;
+            else
+            {
+                std::string value;
+                std::getline(stream >> std::ws, value);
+                pFont.properties[keyword] = unquote(value);
+
+                if (keyword == "FONT_ASCENT")
+                    pFont.ascent = std::atoi(value.c_str());
+                else if (keyword == "FONT_DESCENT")
+                    pFont.descent = std::atoi(value.c_str());
+            }
+        }
+        else if (keyword == "FONTBOUNDINGBOX")
+            stream >> pFont.fbbWidth >> pFont.fbbHeight >> pFont.fbbOfsX >> pFont.fbbOfsY;
+        else if (keyword == "STARTPROPERTIES")
+            inProperties = true;
+        else if (keyword == "STARTCHAR")
+        {
+            glyph = BDFGlyph();
+            std::getline(stream >> std::ws, glyph.name);
+            encoding = -1;
+        }
+        else if (keyword == "ENCODING")
+            stream >> encoding;
+        else if (keyword == "BBX")
+            stream >> glyph.bbxWidth >> glyph.bbxHeight >> glyph.bbxOfsX >> glyph.bbxOfsY;
+        else if (keyword == "BITMAP")
+            inBitmap = true;
+    }
+
+    if (pFont.fbbWidth <= 0 || pFont.fbbHeight <= 0)
+    {
+        std::fprintf(stderr, "Error: \"%s\" has no valid FONTBOUNDINGBOX.\n", pFileName);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Render a glyph into the character cell as MSB-aligned 16 bit rows. Returns false and prints an error on failure.
+ */
+bool renderGlyph(const BDFFont& pFont, const BDFGlyph& pGlyph, int pWidth, int pHeight, int pAscent,
+                 std::vector<uint16_t>& pRows)
+{
+    pRows.assign(pHeight, 0);
+
+    if (static_cast<int>(pGlyph.hexRows.size()) != pGlyph.bbxHeight)
+    {
+        std::fprintf(stderr, "Error: Glyph \"%s\" has %zu bitmap rows instead of %d.\n", pGlyph.name.c_str(),
+                     pGlyph.hexRows.size(), pGlyph.bbxHeight);
+        return false;
+    }
+
+    for (int r = 0; r < pGlyph.bbxHeight; ++r)
+    {
+        const std::string& hexRow = pGlyph.hexRows[r];
+
+        for (int i = 0; i < pGlyph.bbxWidth; ++i)
+        {
+            size_t digit = i / 4;
+
+            if (digit >= hexRow.size() || !std::isxdigit(static_cast<unsigned char>(hexRow[digit])))
+            {
+                std::fprintf(stderr, "Error: Glyph \"%s\" has an invalid bitmap row.\n", pGlyph.name.c_str());
+                return false;
+            }
+
+            int nibble = std::stoi(hexRow.substr(digit, 1), nullptr, 16);
+
+            if (!(nibble & (0b1000 >> (i % 4))))
+                continue;
+
+            int x = pGlyph.bbxOfsX - pFont.fbbOfsX + i;
+            int y = pAscent - (pGlyph.bbxOfsY + pGlyph.bbxHeight) + r;
+
+            if (x < 0 || x >= pWidth || y < 0 || y >= pHeight)
+            {
+                std::fprintf(stderr, "Error: Glyph \"%s\" exceeds the character cell.\n", pGlyph.name.c_str());
+                return false;
+            }
+
+            pRows[y] |= static_cast<uint16_t>(0x8000 >> x);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Pack the non-blank rows of a glyph as {top row, number of rows, bits...} with rows of 'pWidth' bits each
+ * (just {0, 0} for a blank glyph).
+ */
+std::vector<uint8_t> packGlyph(const std::vector<uint16_t>& pRows, int pWidth)
+{
+    int top = 0;
+    int bottom = static_cast<int>(pRows.size());
+
+    while (top < bottom && pRows[top] == 0)
+        ++top;
+    while (bottom > top && pRows[bottom-1] == 0)
+        --bottom;
+
+    if (top == bottom)
+        top = bottom = 0;
+
+    std::vector<uint8_t> packed = {static_cast<uint8_t>(top), static_cast<uint8_t>(bottom - top)};
+
+    uint32_t acc = 0;
+    int accBits = 0;
+
+    for (int j = top; j < bottom; ++j)
+    {
+        acc = (acc << pWidth) | (pRows[j] >> (16 - pWidth));
+        accBits += pWidth;
+
+        while (accBits >= 8)
+        {
+            packed.push_back(static_cast<uint8_t>(acc >> (accBits - 8)));
+            accBits -= 8;
+        }
+    }
+
+    if (accBits > 0)
+        packed.push_back(static_cast<uint8_t>(acc << (8 - accBits)));
+
+    return packed;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 4 || argc > 6)
+    {
+        std::fprintf(stderr, "Usage: %s INPUT_BDF FONT_NAME OUTPUT_FILE [FIRST LAST | CHARACTERS]\n", argv[0]);
+        return 1;
+    }
+
+    const char* inFileName = argv[1];
+    const std::string fontName = argv[2];
+    const char* outFileName = argv[3];
+
+    long firstChar = 0;
+    long lastChar = 255;
+
+    //Characters to convert if only a subset is requested (the index then covers only the range of the subset)
+    std::string subset;
+
+    if (argc == 5)
+    {
+        subset = std::string(argv[4]) + ' ';
+
+        firstChar = 255;
+        lastChar = 0;
+
+        for (char ch : subset)
+        {
+            firstChar = std::min(firstChar, static_cast<long>(static_cast<unsigned char>(ch)));
+            lastChar = std::max(lastChar, static_cast<long>(static_cast<unsigned char>(ch)));
+        }
+    }
+    else if (argc == 6)
+    {
+        firstChar = std::strtol(argv[4], nullptr, 0);
+        lastChar = std::strtol(argv[5], nullptr, 0);
+    }
+
+    if (firstChar < 0 || lastChar > 255 || firstChar > lastChar)
+    {
+        std::fprintf(stderr, "Error: Invalid character range.\n");
+        return 1;
+    }
+
+    BDFFont font;
+
+    if (!readBDF(inFileName, font))
+        return 1;
+
+    const int width = font.fbbWidth;
+    const int height = (font.ascent >= 0 && font.descent >= 0) ? (font.ascent + font.descent) : font.fbbHeight;
+    const int ascent = (font.ascent >= 0) ? font.ascent : (font.fbbHeight + font.fbbOfsY);
+
+    if (width > 16 || height > 255)
+    {
+        std::fprintf(stderr, "Error: Character cell of %dx%d pixels is too large (width at most 16).\n", width, height);
+        return 1;
+    }
+
+    //Convert glyphs
+
+    std::vector<uint16_t> index;
+    std::vector<uint8_t> bitmaps;
+    std::vector<std::string> bitmapLines;
+
+    for (long c = firstChar; c <= lastChar; ++c)
+    {
+        auto it = font.glyphs.find(c);
+
+        if (it == font.glyphs.end() || (!subset.empty() && subset.find(static_cast<char>(c)) == std::string::npos))
+        {
+            index.push_back(0xFFFF);
+            continue;
+        }
+
+        std::vector<uint16_t> rows;
+
+        if (!renderGlyph(font, it->second, width, height, ascent, rows))
+            return 1;
+
+        std::vector<uint8_t> packed = packGlyph(rows, width);
+
+        if (bitmaps.size() + packed.size() + 3 > 0xFFFF)
+        {
+            std::fprintf(stderr, "Error: Glyph data exceeds 64 KiB.\n");
+            return 1;
+        }
+
+        index.push_back(static_cast<uint16_t>(bitmaps.size()));
+        bitmaps.insert(bitmaps.end(), packed.begin(), packed.end());
+
+        char comment[80];
+        std::snprintf(comment, sizeof(comment), "    // 0x%02lX %s\n    ", c, it->second.name.c_str());
+
+        std::string line = comment;
+        for (size_t i = 0; i < packed.size(); ++i)
+        {
+            char byteStr[8];
+            std::snprintf(byteStr, sizeof(byteStr), (i < 2) ? "%u," : "0x%02X,", packed[i]);
+            line += byteStr;
+            if (i == 1 && packed.size() > 2)
+                line += ' ';
+        }
+        bitmapLines.push_back(line + "\n");
+    }
+
+    //Write font source file
+
+    const std::string family = font.properties.count("FAMILY_NAME") ? font.properties["FAMILY_NAME"] : "Unknown";
+    std::string weight = font.properties.count("WEIGHT_NAME") ? font.properties["WEIGHT_NAME"] : "medium";
+    for (char& ch : weight)
+        ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+
+    std::string version;
+    if (font.properties.count("FONT_VERSION"))
+        version = ", Version " + font.properties["FONT_VERSION"];
+
+    const std::string copyright = font.properties.count("COPYRIGHT") ? font.properties["COPYRIGHT"] : "";
+
+    std::FILE* file = std::fopen(outFileName, "w");
+
+    if (!file)
+    {
+        std::fprintf(stderr, "Error: Could not open \"%s\" for writing.\n", outFileName);
+        return 1;
+    }
+
+    std::fputs(gplHeader, file);
+    std::fprintf(file, "//\n");
+    std::fprintf(file, "//  This file is additionally licensed under the SIL Open Font License, Version 1.1,\n");
+    std::fprintf(file, "//  because it embeds a subset of the %s Font%s, as converted from\n", family.c_str(), version.c_str());
+    std::fprintf(file, "//  the original font file for size %dx%d (%s weight) using 'tools/bdf2font.cpp'.\n", width, height, weight.c_str());
+    std::fprintf(file, "//\n");
+    std::fprintf(file, "//  The %s Font Software itself is licensed under the SIL Open Font License, Version 1.1.\n", family.c_str());
+    std::fprintf(file, "//\n");
+    std::fprintf(file, "//  %s Font, %s,\n", family.c_str(), copyright.c_str());
+    std::fprintf(file, "//  with Reserved Font Name \"%s Font\"\n", family.c_str());
+    std::fprintf(file, "//\n");
+    std::fprintf(file, "//  You should have received a copy of the SIL Open Font License along with Lightning Detector.\n");
+    std::fprintf(file, "//  If not, see <https://openfontlicense.org/>.\n");
+    std::fprintf(file, "//\n");
+    std::fprintf(file, "///////////////////////////////////////////////////////////////////////////////////////////////\n");
+    std::fprintf(file, "*/\n\n");
+
+    std::fprintf(file, "//\n//  Generated by 'tools/bdf2font.cpp'. Do not edit.\n//\n\n");
+
+    std::fprintf(file, "static const uint16_t %s_Index[] = {", fontName.c_str());
+    for (size_t i = 0; i < index.size(); ++i)
+        std::fprintf(file, "%s0x%04X,", (i % 16 == 0) ? "\n    " : " ", index[i]);
+    std::fprintf(file, "\n};\n\n");
+
+    std::fprintf(file, "static const uint8_t %s_Bitmaps[] = {\n", fontName.c_str());
+    for (const std::string& line : bitmapLines)
+        std::fputs(line.c_str(), file);
+    std::fprintf(file, "    // Padding (rows are read as 32 bit words)\n    0x00,0x00,0x00,\n");
+    std::fprintf(file, "};\n\n");
+
+    std::fprintf(file, "/*!\n * \\brief Converted \"%s Font\", size %dx%d, %s weight.\n", family.c_str(), width, height, weight.c_str());
+    if (!subset.empty())
+        std::fprintf(file, " *\n * Contains only the glyphs of the characters \"%s\".\n", subset.substr(0, subset.size() - 1).c_str());
+    std::fprintf(file, " */\n");
+    std::fprintf(file, "const struct Font %s = {\n", fontName.c_str());
+    std::fprintf(file, "    %d,\n    %d,\n    0x%02lX,\n    0x%02lX,\n", width, height, firstChar, lastChar);
+    std::fprintf(file, "    %s_Index,\n    %s_Bitmaps,\n    false\n};\n", fontName.c_str(), fontName.c_str());
+
+    std::fclose(file);
+
+    std::printf("%s: %zu glyphs, %zu bytes (index %zu, bitmaps %zu)\n", fontName.c_str(), bitmapLines.size(),
+                2*index.size() + bitmaps.size() + 3, 2*index.size(), bitmaps.size() + 3);
+
+    return 0;
+}
@@ -0,0 +1,334 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host benchmark for rendering the status screen in horizontal bands (as done by the e-paper display driver).
+ *
+ * Renders the static parts of the status screen (see StatusScreenLayout::recordStaticParts()) plus example
+ * field texts as 8 bands of 200x25 pixels, once via the generic ArduinoGraphics path (one virtual set() call
+ * per pixel, like Graphics and AbstractDisplay::setPixel()) and once via MonoFramebuffer, checks that both
+ * produce the same image and prints the average render time per frame of both paths.
+ * Afterwards prints the same for each single graphics primitive (drawn across all bands of a frame).
+ * Returns a non-zero exit code if the images differ.
+ *
+ * Build (with optimization) and run from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -O2 -D FONTS_INCLUDE_ALL -I tools/hoststub -I tools -I lightning_detector -o benchmark_render \
+ *         tools/benchmark_render.cpp lightning_detector/arduinographics.cpp \
+ *         lightning_detector/statusscreenlayout.cpp tools/drawlist.cpp lightning_detector/fonts.cpp
+ *     ./benchmark_render [NUM_FRAMES]
+ */
+
+#include "arduinographics.h"
+#include "drawlist.h"
+#include "fonts.h"
+#include "monoframebuffer.h"
+#include "statusscreenlayout.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+
+constexpr int screenSize = StatusScreenLayout::screenSize;
+constexpr int bandRows = 25;
+constexpr int numBands = screenSize / bandRows;
+
+typedef MonoFramebuffer<screenSize, bandRows> BandFramebuffer;
+
+/*
+ * ArduinoGraphics for a 1 bit per pixel band buffer that only implements the per-pixel set().
+ */
+class BandGraphics : public ArduinoGraphics
+{
+public:
+    BandGraphics() :
+        ArduinoGraphics(screenSize, screenSize),
+        buffer(nullptr),
+        originY(0)
+    {
+    }
+
+    void setBand(uint8_t* pBuffer, int pOriginY)
+    {
+        buffer = pBuffer;
+        originY = pOriginY;
+    }
+
+    void set(int pX, int pY, uint8_t pR, uint8_t pG, uint8_t pB) override
+    {
+        if ((pY < originY) || (pY >= originY + bandRows))
+            return;
+
+        const bool value = ((pR > 0) || (pG > 0) || (pB > 0));
+
+        uint8_t& byte = buffer[BandFramebuffer::bytesPerRow*(pY - originY) + pX/8];
+        const uint8_t mask = 0b10000000 >> (pX % 8);
+
+        if (value)
+            byte |= mask;
+        else
+            byte &= ~mask;
+    }
+
+private:
+    uint8_t* buffer;
+    int originY;
+};
+
+/*
+ * Record example texts for the status screen fields.
+ */
+void recordFields(DrawList& pDrawList)
+{
+    using namespace StatusScreenLayout;
+
+    const Font* font = &Font_TerminASCII24;
+
+    pDrawList.text(font, "1234", textOfsX, rowY0 + rowPitch);
+    pDrawList.text(font, "4.5/m", textOfsX + 11*charWidth, rowY0 + rowPitch);
+    pDrawList.text(font, "2.913 V", textOfsX, rowY0 + 3*rowPitch);
+    pDrawList.text(font, "12 km", textOfsX + 10*charWidth, rowY0 + 3*rowPitch);
+    pDrawList.text(font, "87 %", textOfsX, rowY0 + 5*rowPitch);
+    pDrawList.text(font, "3d 4h", textOfsX + 10*charWidth, rowY0 + 5*rowPitch);
+}
+
+//
+
+/*
+ * Graphics primitives to time separately.
+ */
+template<class GraphicsT>
+void drawClear(GraphicsT& pGraphics)
+{
+    pGraphics.clear();
+}
+
+template<class GraphicsT>
+void drawRectOutline(GraphicsT& pGraphics)
+{
+    pGraphics.noFill();
+    pGraphics.rect(10, 10, 180, 180);
+}
+
+template<class GraphicsT>
+void drawRectFilled(GraphicsT& pGraphics)
+{
+    pGraphics.fill(0, 0, 0);
+    pGraphics.rect(10, 10, 180, 180);
+    pGraphics.noFill();
+}
+
+template<class GraphicsT>
+void drawLineHorizontal(GraphicsT& pGraphics)
+{
+    for (int y = 5; y < screenSize; y += 10)
+        pGraphics.line(3, y, screenSize - 4, y);
+}
+
+template<class GraphicsT>
+void drawLineVertical(GraphicsT& pGraphics)
+{
+    for (int x = 5; x < screenSize; x += 10)
+        pGraphics.line(x, 3, x, screenSize - 4);
+}
+
+template<class GraphicsT>
+void drawLineOblique(GraphicsT& pGraphics)
+{
+    for (int i = 0; i < screenSize; i += 20)
+    {
+        pGraphics.line(0, i, screenSize - 1, screenSize - 1 - i);
+        pGraphics.line(i, 0, screenSize - 1 - i, screenSize - 1);
+    }
+}
+
+template<class GraphicsT>
+void drawText(GraphicsT& pGraphics)
+{
+    pGraphics.textFont(&Font_TerminASCII24);
+
+    for (int y = 4; y + 24 <= screenSize; y += 27)
+        pGraphics.text("Battery Distance", 4, y);
+}
+
+void drawEllipseOutline(ArduinoGraphics& pGraphics)
+{
+    pGraphics.noFill();
+    pGraphics.ellipse(100, 100, 190, 150);
+}
+
+void drawEllipseFilled(ArduinoGraphics& pGraphics)
+{
+    pGraphics.fill(0, 0, 0);
+    pGraphics.ellipse(100, 100, 190, 150);
+    pGraphics.noFill();
+}
+
+/*
+ * Primitive with a drawing function for ArduinoGraphics and (if supported) one for MonoFramebuffer.
+ */
+struct Primitive
+{
+    const char* name;
+    void (*drawGraphics)(ArduinoGraphics&);
+    void (*drawMono)(BandFramebuffer&);
+};
+
+const Primitive primitives[] = {
+    {"clear",               drawClear<ArduinoGraphics>,             drawClear<BandFramebuffer>},
+    {"rect (outline)",      drawRectOutline<ArduinoGraphics>,       drawRectOutline<BandFramebuffer>},
+    {"rect (filled)",       drawRectFilled<ArduinoGraphics>,        drawRectFilled<BandFramebuffer>},
+    {"line (horizontal)",   drawLineHorizontal<ArduinoGraphics>,    drawLineHorizontal<BandFramebuffer>},
+    {"line (vertical)",     drawLineVertical<ArduinoGraphics>,      drawLineVertical<BandFramebuffer>},
+    {"line (oblique)",      drawLineOblique<ArduinoGraphics>,       drawLineOblique<BandFramebuffer>},
+    {"text",                drawText<ArduinoGraphics>,              drawText<BandFramebuffer>},
+    {"ellipse (outline)",   drawEllipseOutline,                     nullptr},
+    {"ellipse (filled)",    drawEllipseFilled,                      nullptr}
+};
+
+//
+
+double microsPerFrame(std::chrono::steady_clock::time_point pStart, std::chrono::steady_clock::time_point pEnd, int pNumFrames)
+{
+    return std::chrono::duration<double, std::micro>(pEnd - pStart).count() / pNumFrames;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int numFrames = (argc > 1) ? std::atoi(argv[1]) : 1000;
+
+    if (numFrames <= 0)
+    {
+        std::fprintf(stderr, "Usage: %s [NUM_FRAMES]\n", argv[0]);
+        return 1;
+    }
+
+    DrawList staticDrawList;
+    DrawList fieldDrawList;
+    StatusScreenLayout::recordStaticParts(staticDrawList);
+    recordFields(fieldDrawList);
+
+    if (staticDrawList.overflowed() || fieldDrawList.overflowed())
+    {
+        std::fprintf(stderr, "Error: Status screen does not fit into a DrawList.\n");
+        return 1;
+    }
+
+    static uint8_t genericImage[numBands * BandFramebuffer::bufferSize];
+    static uint8_t monoImage[numBands * BandFramebuffer::bufferSize];
+
+    BandGraphics graphics;
+    graphics.begin();
+    graphics.background(255, 255, 255);
+    graphics.stroke(0, 0, 0);
+    graphics.noFill();
+
+    BandFramebuffer framebuffer;
+    framebuffer.background(255, 255, 255);
+    framebuffer.stroke(0, 0, 0);
+    framebuffer.noFill();
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        for (int band = 0; band < numBands; ++band)
+        {
+            uint8_t* bandBuffer = &genericImage[band * BandFramebuffer::bufferSize];
+
+            memset(bandBuffer, 0b11111111, BandFramebuffer::bufferSize);
+            graphics.setBand(bandBuffer, band * bandRows);
+            staticDrawList.replay(graphics);
+            fieldDrawList.replay(graphics);
+        }
+    }
+
+    const auto t1 = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        for (int band = 0; band < numBands; ++band)
+        {
+            framebuffer.setOriginY(band * bandRows);
+            framebuffer.clear();
+            staticDrawList.replay(framebuffer);
+            fieldDrawList.replay(framebuffer);
+            memcpy(&monoImage[band * BandFramebuffer::bufferSize], framebuffer.data(), BandFramebuffer::bufferSize);
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    const bool identical = (memcmp(genericImage, monoImage, sizeof(genericImage)) == 0);
+
+    std::printf("Frames:           %d (%d bands of %dx%d pixels each)\n", numFrames, numBands, screenSize, bandRows);
+    std::printf("ArduinoGraphics:  %8.1f us/frame\n", microsPerFrame(t0, t1, numFrames));
+    std::printf("MonoFramebuffer:  %8.1f us/frame\n", microsPerFrame(t1, t2, numFrames));
+    std::printf("Images:           %s\n", identical ? "identical" : "DIFFERENT");
+
+    std::printf("\nPrimitive           ArduinoGraphics  MonoFramebuffer  (us/frame)\n");
+
+    for (const Primitive& primitive : primitives)
+    {
+        const auto t3 = std::chrono::steady_clock::now();
+
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            for (int band = 0; band < numBands; ++band)
+            {
+                graphics.setBand(&genericImage[band * BandFramebuffer::bufferSize], band * bandRows);
+                primitive.drawGraphics(graphics);
+            }
+        }
+
+        const auto t4 = std::chrono::steady_clock::now();
+
+        std::printf("%-18s  %15.1f", primitive.name, microsPerFrame(t3, t4, numFrames));
+
+        if (primitive.drawMono != nullptr)
+        {
+            for (int frame = 0; frame < numFrames; ++frame)
+            {
+                for (int band = 0; band < numBands; ++band)
+                {
+                    framebuffer.setOriginY(band * bandRows);
+                    primitive.drawMono(framebuffer);
+                }
+            }
+
+            const auto t5 = std::chrono::steady_clock::now();
+
+            std::printf("  %15.1f\n", microsPerFrame(t4, t5, numFrames));
+        }
+        else
+            std::printf("  %15s\n", "-");
+    }
+
+    return identical ? 0 : 1;
+}
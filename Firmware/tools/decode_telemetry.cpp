@@ -0,0 +1,100 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host tool that converts the binary telemetry stream of the firmware (see lightning_detector/telemetry.h)
+ * to CSV or JSON (one object per line). Reads from a file, e.g. a recorded stream or the serial device
+ * (set it to raw mode first, e.g. 'stty -F /dev/ttyACM0 raw'), or from standard input.
+ * Enable the binary telemetry via the serial console command 'telemetry on' (see README).
+ *
+ * Build from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -I tools/hoststub -I lightning_detector -o decode_telemetry \
+ *         tools/decode_telemetry.cpp tools/telemetrydecoder.cpp \
+ *         lightning_detector/telemetry.cpp lightning_detector/auxil.cpp
+ *
+ * Usage:
+ *
+ *     ./decode_telemetry [--json] [INPUT_FILE]
+ */
+
+#include "telemetrydecoder.h"
+
+#include <cstdio>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+    TelemetryDecoder::Format format = TelemetryDecoder::Format::CSV;
+    const char* inputFileName = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0)
+            format = TelemetryDecoder::Format::JSON;
+        else if ((inputFileName == nullptr) && (argv[i][0] != '-'))
+            inputFileName = argv[i];
+        else
+        {
+            std::fprintf(stderr, "Usage: %s [--json] [INPUT_FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::FILE* file = stdin;
+
+    if (inputFileName != nullptr)
+    {
+        file = std::fopen(inputFileName, "rb");
+
+        if (!file)
+        {
+            std::fprintf(stderr, "Error: Could not open \"%s\" for reading.\n", inputFileName);
+            return 1;
+        }
+    }
+
+    if (format == TelemetryDecoder::Format::CSV)
+        std::printf("%s\n", TelemetryDecoder::csvHeader().c_str());
+
+    TelemetryDecoder decoder;
+
+    int c;
+    while ((c = std::fgetc(file)) != EOF)
+    {
+        if (decoder.feed(static_cast<uint8_t>(c)))
+        {
+            std::printf("%s\n", decoder.format(format).c_str());
+            std::fflush(stdout);
+        }
+    }
+
+    if (file != stdin)
+        std::fclose(file);
+
+    if (decoder.getNumSkippedFrames() > 0)
+        std::fprintf(stderr, "Skipped %lu invalid frames (e.g. serial console output).\n",
+                     static_cast<unsigned long>(decoder.getNumSkippedFrames()));
+
+    return 0;
+}
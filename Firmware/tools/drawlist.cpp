@@ -0,0 +1,157 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "drawlist.h"
+
+/*!
+ * \brief Constructor.
+ *
+ * Creates an empty list.
+ */
+DrawList::DrawList() :
+    numOps(0),
+    textPoolUsed(0),
+    overflow(false)
+{
+}
+
+//Public
+
+/*!
+ * \brief Remove all operations.
+ *
+ * Also resets the overflow flag (see overflowed()).
+ */
+void DrawList::clear()
+{
+    numOps = 0;
+    textPoolUsed = 0;
+    overflow = false;
+}
+
+//
+
+/*!
+ * \brief Add a rectangle operation.
+ *
+ * See ArduinoGraphics::rect().
+ *
+ * \param pX X-coordinate of the top-left corner.
+ * \param pY Y-coordinate of the top-left corner.
+ * \param pWidth Width of the rectangle.
+ * \param pHeight Height of the rectangle.
+ * \return If the operation could be added (see overflowed()).
+ */
+bool DrawList::rect(int16_t pX, int16_t pY, int16_t pWidth, int16_t pHeight)
+{
+    return addOp(OpType::Rect, pX, pY, pWidth, pHeight);
+}
+
+/*!
+ * \brief Add a line operation.
+ *
+ * See ArduinoGraphics::line().
+ *
+ * \param pX1 X-coordinate of the start point.
+ * \param pY1 Y-coordinate of the start point.
+ * \param pX2 X-coordinate of the end point.
+ * \param pY2 Y-coordinate of the end point.
+ * \return If the operation could be added (see overflowed()).
+ */
+bool DrawList::line(int16_t pX1, int16_t pY1, int16_t pX2, int16_t pY2)
+{
+    return addOp(OpType::Line, pX1, pY1, pX2, pY2);
+}
+
+/*!
+ * \brief Add a text operation.
+ *
+ * Copies \p pStr into the character pool. See ArduinoGraphics::text().
+ *
+ * \param pFont %Font to use for the text.
+ * \param pStr Null-terminated text string.
+ * \param pX X-coordinate of the top-left corner of the text.
+ * \param pY Y-coordinate of the top-left corner of the text.
+ * \return If the operation could be added (see overflowed()).
+ */
+bool DrawList::text(const Font* pFont, const char* pStr, int16_t pX, int16_t pY)
+{
+    size_t length = strlen(pStr);
+
+    if (textPoolUsed + length + 1 > textPoolSize)
+    {
+        overflow = true;
+        return false;
+    }
+
+    uint8_t textOfs = textPoolUsed;
+
+    if (!addOp(OpType::Text, pX, pY, 0, 0))
+        return false;
+
+    memcpy(&textPool[textOfs], pStr, length + 1);
+    textPoolUsed += length + 1;
+
+    ops[numOps-1].textOfs = textOfs;
+    ops[numOps-1].font = pFont;
+
+    return true;
+}
+
+//
+
+/*!
+ * \brief Check if any operation had to be dropped.
+ *
+ * \return True if an operation did not fit into the list since the last clear().
+ */
+bool DrawList::overflowed() const
+{
+    return overflow;
+}
+
+//Private
+
+/*!
+ * \brief Append an operation.
+ *
+ * \param pType Operation type.
+ * \param pA First coordinate parameter.
+ * \param pB Second coordinate parameter.
+ * \param pC Third coordinate parameter.
+ * \param pD Fourth coordinate parameter.
+ * \return If the operation could be added (see overflowed()).
+ */
+bool DrawList::addOp(OpType pType, int16_t pA, int16_t pB, int16_t pC, int16_t pD)
+{
+    if (numOps >= maxOps)
+    {
+        overflow = true;
+        return false;
+    }
+
+    ops[numOps] = Op{pType, 0, pA, pB, pC, pD, nullptr};
+    ++numOps;
+
+    return true;
+}
@@ -0,0 +1,127 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef DRAWLIST_H
+#define DRAWLIST_H
+
+#include "font.h"
+
+#include <Arduino.h>
+
+/*!
+ * \brief Replayable list of drawing operations.
+ *
+ * Records a screen as a short list of drawing operations (rectangles, lines and texts) instead of
+ * rasterizing it immediately. The list can then be replayed on an ArduinoGraphics instance (or any
+ * other class with the same drawing interface, such as MonoFramebuffer) any number of
+ * times, e.g. to render the screen in horizontal bands into a small buffer (one band per replay,
+ * clipping all other pixels) instead of holding a buffer for the full screen.
+ *
+ * Only used by the host tools (e.g. to record StatusScreenLayout::recordStaticParts()); the firmware
+ * draws the prerendered StatusScreenBackground and the text fields directly into MonoFramebuffer bands.
+ *
+ * Text strings are copied into an internal character pool. Operations that do not fit into the
+ * fixed capacity (see maxOps, textPoolSize) are dropped and the list is marked as overflowed.
+ */
+class DrawList
+{
+public:
+    DrawList();                                         ///< Constructor.
+    //
+    void clear();                                       ///< Remove all operations.
+    //
+    bool rect(int16_t pX, int16_t pY, int16_t pWidth, int16_t pHeight);     ///< Add a rectangle operation.
+    bool line(int16_t pX1, int16_t pY1, int16_t pX2, int16_t pY2);          ///< Add a line operation.
+    bool text(const Font* pFont, const char* pStr, int16_t pX, int16_t pY); ///< Add a text operation.
+    //
+    bool overflowed() const;                            ///< Check if any operation had to be dropped.
+    //
+    /*!
+     * \brief Execute all operations on a graphics instance.
+     *
+     * Calls the corresponding drawing functions of \p pGraphics in the recorded order,
+     * using its current stroke/fill settings.
+     *
+     * \tparam GraphicsT ArduinoGraphics or a class with the same drawing interface (e.g. MonoFramebuffer).
+     * \param pGraphics Graphics instance to draw with.
+     */
+    template<class GraphicsT>
+    void replay(GraphicsT& pGraphics) const
+    {
+        for (uint8_t i = 0; i < numOps; ++i)
+        {
+            const Op& op = ops[i];
+
+            if (op.type == OpType::Rect)
+                pGraphics.rect(op.a, op.b, op.c, op.d);
+            else if (op.type == OpType::Line)
+                pGraphics.line(op.a, op.b, op.c, op.d);
+            else if (op.type == OpType::Text)
+            {
+                pGraphics.textFont(op.font);
+                pGraphics.text(&textPool[op.textOfs], op.a, op.b);
+            }
+        }
+    }
+
+public:
+    static constexpr size_t maxOps = 16;                ///< Maximum number of operations.
+    static constexpr size_t textPoolSize = 96;          ///< Size of the character pool for all texts (including terminators).
+
+private:
+    /*!
+     * \brief Type of a drawing operation.
+     */
+    enum class OpType : uint8_t
+    {
+        Rect = 0,   ///< Rectangle (position and size).
+        Line = 1,   ///< Line (start and end point).
+        Text = 2    ///< Text (font, position and string).
+    };
+
+    /*!
+     * \brief Single recorded drawing operation.
+     */
+    struct Op
+    {
+        OpType type;        ///< Operation type.
+        uint8_t textOfs;    ///< Offset of the (null-terminated) string in the character pool (text only).
+        int16_t a;          ///< Rectangle/text x-coordinate or line start x-coordinate.
+        int16_t b;          ///< Rectangle/text y-coordinate or line start y-coordinate.
+        int16_t c;          ///< Rectangle width or line end x-coordinate.
+        int16_t d;          ///< Rectangle height or line end y-coordinate.
+        const Font* font;   ///< %Font (text only).
+    };
+
+private:
+    bool addOp(OpType pType, int16_t pA, int16_t pB, int16_t pC, int16_t pD);  ///< Append an operation.
+
+private:
+    Op ops[maxOps];                 ///< Recorded operations.
+    uint8_t numOps;                 ///< Number of recorded operations.
+    char textPool[textPoolSize];    ///< Character pool for the strings of text operations.
+    uint8_t textPoolUsed;           ///< Number of used bytes in 'textPool'.
+    bool overflow;                  ///< An operation had to be dropped.
+};
+
+#endif // DRAWLIST_H
@@ -0,0 +1,159 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host tool that renders the static parts of the status screen (see StatusScreenLayout::recordStaticParts())
+ * into a 1 bit per pixel image and writes it as the source file of StatusScreenBackground.
+ *
+ * Needs to be run again whenever the status screen layout or the used fonts are changed.
+ * Also checks that the text field font subset contains all characters of StatusScreenLayout::fieldCharacters.
+ *
+ * Build and run from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -D FONTS_INCLUDE_ALL -I tools/hoststub -I tools -I lightning_detector -o render_status_background \
+ *         tools/render_status_background.cpp \
+ *         lightning_detector/statusscreenlayout.cpp tools/drawlist.cpp lightning_detector/fonts.cpp
+ *     ./render_status_background lightning_detector/statusscreenbackground.cpp
+ */
+
+#include "drawlist.h"
+#include "fonts.h"
+#include "monoframebuffer.h"
+#include "statusscreenlayout.h"
+
+#include <cstdio>
+
+namespace
+{
+
+const char fileHeader[] =
+R"(/*
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is additionally licensed under the SIL Open Font License, Version 1.1,
+//  because it embeds glyphs of the Terminus Font, Version 4.49.1, as rendered from
+//  the converted fonts in 'fonts/' (size 12x24, medium and synthesized bold weight).
+//
+//  The Terminus Font Software itself is licensed under the SIL Open Font License, Version 1.1.
+//
+//  Terminus Font, Copyright (C) 2020 Dimitar Toshkov Zhekov,
+//  with Reserved Font Name "Terminus Font"
+//
+//  You should have received a copy of the SIL Open Font License along with Lightning Detector.
+//  If not, see <https://openfontlicense.org/>.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+*/
+
+//
+//  Generated by 'tools/render_status_background.cpp'. Do not edit.
+//
+
+#include "statusscreenbackground.h"
+
+const uint8_t StatusScreenBackground[StatusScreenLayout::screenSize * StatusScreenLayout::screenSize / 8] = {
+)";
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "Usage: %s OUTPUT_FILE\n", argv[0]);
+        return 1;
+    }
+
+    for (const char* c = StatusScreenLayout::fieldCharacters; *c != '\0'; ++c)
+    {
+        if (Font_TerminASCII24Status.glyph(static_cast<uint8_t>(*c)) == nullptr)
+        {
+            std::fprintf(stderr, "Error: Text field font has no glyph for '%c' (regenerate it with 'tools/bdf2font.cpp').\n", *c);
+            return 1;
+        }
+    }
+
+    DrawList drawList;
+    StatusScreenLayout::recordStaticParts(drawList);
+
+    if (drawList.overflowed())
+    {
+        std::fprintf(stderr, "Error: Static parts of the status screen do not fit into a DrawList.\n");
+        return 1;
+    }
+
+    constexpr size_t screenSize = StatusScreenLayout::screenSize;
+
+    MonoFramebuffer<screenSize, screenSize> framebuffer;
+    framebuffer.background(255, 255, 255);
+    framebuffer.stroke(0, 0, 0);
+    framebuffer.noFill();
+    framebuffer.clear();
+
+    drawList.replay(framebuffer);
+
+    std::FILE* file = std::fopen(argv[1], "w");
+
+    if (!file)
+    {
+        std::fprintf(stderr, "Error: Could not open \"%s\" for writing.\n", argv[1]);
+        return 1;
+    }
+
+    std::fputs(fileHeader, file);
+
+    for (size_t row = 0; row < screenSize; ++row)
+    {
+        std::fprintf(file, "    ");
+
+        for (size_t col = 0; col < framebuffer.bytesPerRow; ++col)
+            std::fprintf(file, "0x%02X,", framebuffer.data()[row*framebuffer.bytesPerRow + col]);
+
+        std::fprintf(file, "\n");
+    }
+
+    std::fputs("};\n", file);
+
+    std::fclose(file);
+
+    return 0;
+}
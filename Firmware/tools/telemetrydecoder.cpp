@@ -0,0 +1,241 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#include "telemetrydecoder.h"
+
+#include <cstdio>
+
+constexpr size_t TelemetryDecoder::bufferSize;
+
+//
+
+/*!
+ * \brief Constructor.
+ */
+TelemetryDecoder::TelemetryDecoder() :
+    buffer(),
+    bufferLength(0),
+    bufferOverflow(false),
+    frameType(Telemetry::FrameType::Event),
+    event(),
+    status(),
+    numSkippedFrames(0)
+{
+}
+
+//Public
+
+/*!
+ * \brief Process a received byte.
+ *
+ * \param pByte Received byte.
+ * \return If a valid record was completed (see getFrameType()).
+ */
+bool TelemetryDecoder::feed(uint8_t pByte)
+{
+    if (pByte != 0)
+    {
+        if (bufferLength < bufferSize)
+            buffer[bufferLength++] = pByte;
+        else
+            bufferOverflow = true;
+
+        return false;
+    }
+
+    bool valid = false;
+
+    //Ignore empty frames (consecutive delimiters)
+    if (bufferOverflow || (bufferLength > 0))
+    {
+        valid = !bufferOverflow && decode();
+
+        if (!valid)
+            ++numSkippedFrames;
+    }
+
+    bufferLength = 0;
+    bufferOverflow = false;
+
+    return valid;
+}
+
+//
+
+/*!
+ * \brief Get the type of the last decoded record.
+ *
+ * \return Frame type of the last valid record (see feed()).
+ */
+Telemetry::FrameType TelemetryDecoder::getFrameType() const
+{
+    return frameType;
+}
+
+/*!
+ * \brief Get the last decoded event record.
+ *
+ * \return Last event record.
+ */
+const Telemetry::EventRecord& TelemetryDecoder::getEvent() const
+{
+    return event;
+}
+
+/*!
+ * \brief Get the last decoded status record.
+ *
+ * \return Last status record.
+ */
+const Telemetry::StatusRecord& TelemetryDecoder::getStatus() const
+{
+    return status;
+}
+
+//
+
+/*!
+ * \brief Get the number of skipped (invalid) frames.
+ *
+ * Includes corrupted frames, frames of unknown type and interleaved text (e.g. serial console output).
+ *
+ * \return Number of skipped frames.
+ */
+size_t TelemetryDecoder::getNumSkippedFrames() const
+{
+    return numSkippedFrames;
+}
+
+//
+
+/*!
+ * \brief Format the last decoded record.
+ *
+ * \param pFormat Output format.
+ * \return Formatted record as single line (without line break).
+ */
+std::string TelemetryDecoder::format(Format pFormat) const
+{
+    char line[256];
+
+    if (frameType == Telemetry::FrameType::Event)
+    {
+        if (pFormat == Format::CSV)
+        {
+            std::snprintf(line, sizeof(line), "event,%lu,%s,%lu,%u,,,,,,,,",
+                          static_cast<unsigned long>(event.timeSecs), interruptTypeName(event.type),
+                          static_cast<unsigned long>(event.energy), static_cast<unsigned>(event.distance));
+        }
+        else
+        {
+            std::snprintf(line, sizeof(line), "{\"record\":\"event\",\"time_s\":%lu,\"type\":\"%s\",\"energy\":%lu,\"distance_km\":%u}",
+                          static_cast<unsigned long>(event.timeSecs), interruptTypeName(event.type),
+                          static_cast<unsigned long>(event.energy), static_cast<unsigned>(event.distance));
+        }
+    }
+    else
+    {
+        const double vdd = status.vddMilliVolts / 1000.;
+        const double rate = status.lightningRate / 100.;
+
+        const bool lowBattery = (status.flags & Telemetry::StatusFlags::LowBattery) != 0;
+        const bool as3935Off = (status.flags & Telemetry::StatusFlags::AS3935Off) != 0;
+
+        if (pFormat == Format::CSV)
+        {
+            std::snprintf(line, sizeof(line), "status,%lu,,,,%.3f,%u,%u,%lu,%.2f,%lu,%d,%d",
+                          static_cast<unsigned long>(status.timeSecs), vdd, static_cast<unsigned>(status.batteryPercentage),
+                          static_cast<unsigned>(status.energyTier), static_cast<unsigned long>(status.lightningCount), rate,
+                          static_cast<unsigned long>(status.wakeUpCount), lowBattery ? 1 : 0, as3935Off ? 1 : 0);
+        }
+        else
+        {
+            std::snprintf(line, sizeof(line), "{\"record\":\"status\",\"time_s\":%lu,\"vdd_v\":%.3f,\"battery_percent\":%u,"
+                                              "\"energy_tier\":%u,\"lightnings\":%lu,\"rate_per_min\":%.2f,\"wakeups\":%lu,"
+                                              "\"low_battery\":%s,\"as3935_off\":%s}",
+                          static_cast<unsigned long>(status.timeSecs), vdd, static_cast<unsigned>(status.batteryPercentage),
+                          static_cast<unsigned>(status.energyTier), static_cast<unsigned long>(status.lightningCount), rate,
+                          static_cast<unsigned long>(status.wakeUpCount), lowBattery ? "true" : "false", as3935Off ? "true" : "false");
+        }
+    }
+
+    return line;
+}
+
+//
+
+/*!
+ * \brief Get the CSV header line.
+ *
+ * \return Column names for Format::CSV (without line break).
+ */
+std::string TelemetryDecoder::csvHeader()
+{
+    return "record,time_s,type,energy,distance_km,vdd_v,battery_percent,energy_tier,lightnings,rate_per_min,wakeups,low_battery,as3935_off";
+}
+
+/*!
+ * \brief Get the name of an %AS3935 interrupt type.
+ *
+ * \param pType Raw interrupt type (see Telemetry::EventRecord::type).
+ * \return Interrupt type name.
+ */
+const char* TelemetryDecoder::interruptTypeName(uint8_t pType)
+{
+    switch (pType)
+    {
+        case 0b0000:
+            return "distance";
+        case 0b0001:
+            return "noise";
+        case 0b0100:
+            return "disturber";
+        case 0b1000:
+            return "lightning";
+        default:
+            return "invalid";
+    }
+}
+
+//Private
+
+/*!
+ * \brief Decode the collected frame.
+ *
+ * \return If the frame is a valid record of a known type.
+ */
+bool TelemetryDecoder::decode()
+{
+    uint8_t payload[Telemetry::maxPayloadSize + 4];
+
+    size_t length = Telemetry::decodeFrame(buffer, bufferLength, payload, sizeof(payload));
+
+    if (Telemetry::parseEvent(payload, length, event))
+        frameType = Telemetry::FrameType::Event;
+    else if (Telemetry::parseStatus(payload, length, status))
+        frameType = Telemetry::FrameType::Status;
+    else
+        return false;
+
+    return true;
+}
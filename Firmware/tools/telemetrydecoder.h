@@ -0,0 +1,88 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+#ifndef TELEMETRYDECODER_H
+#define TELEMETRYDECODER_H
+
+/*
+ * Host library for decoding the binary telemetry stream of the firmware (see lightning_detector/telemetry.h)
+ * and for converting the decoded records to CSV or JSON (see tools/decode_telemetry.cpp for an example).
+ */
+
+#include "telemetry.h"
+
+#include <string>
+
+/*!
+ * \brief Incremental decoder for the binary telemetry stream.
+ *
+ * Collects received bytes until a frame delimiter (zero byte), then decodes and checks the frame
+ * (see Telemetry::decodeFrame()). Corrupted frames, unknown frame types and interleaved text are skipped.
+ */
+class TelemetryDecoder
+{
+public:
+    /*!
+     * \brief Output formats for decoded records.
+     */
+    enum class Format : uint8_t
+    {
+        CSV,    ///< One line per record with common columns for all record types (see csvHeader()).
+        JSON    ///< One JSON object per line ("JSON Lines").
+    };
+
+public:
+    TelemetryDecoder();                                     ///< Constructor.
+    //
+    bool feed(uint8_t pByte);                               ///< Process a received byte.
+    //
+    Telemetry::FrameType getFrameType() const;              ///< Get the type of the last decoded record.
+    const Telemetry::EventRecord& getEvent() const;         ///< Get the last decoded event record.
+    const Telemetry::StatusRecord& getStatus() const;       ///< Get the last decoded status record.
+    //
+    size_t getNumSkippedFrames() const;                     ///< Get the number of skipped (invalid) frames.
+    //
+    std::string format(Format pFormat) const;               ///< Format the last decoded record.
+    //
+    static std::string csvHeader();                         ///< Get the CSV header line.
+    static const char* interruptTypeName(uint8_t pType);    ///< Get the name of an %AS3935 interrupt type.
+
+private:
+    bool decode();                                          ///< Decode the collected frame.
+
+private:
+    static constexpr size_t bufferSize = 256;               ///< Maximum collected frame size.
+
+private:
+    uint8_t buffer[bufferSize];                             ///< Collected bytes of the current frame.
+    size_t bufferLength;                                    ///< Number of collected bytes.
+    bool bufferOverflow;                                    ///< Current frame exceeds the buffer.
+    //
+    Telemetry::FrameType frameType;                         ///< Type of the last decoded record.
+    Telemetry::EventRecord event;                           ///< Last decoded event record.
+    Telemetry::StatusRecord status;                         ///< Last decoded status record.
+    //
+    size_t numSkippedFrames;                                ///< Number of skipped frames.
+};
+
+#endif // TELEMETRYDECODER_H
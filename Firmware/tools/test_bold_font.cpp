@@ -0,0 +1,247 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host visual golden test for the synthesized bold font weight (see Font::bold).
+ *
+ * Compares the glyphs of Font_TerminASCII24Bold (synthesized from the medium weight glyph data) for the characters
+ * 0x20 to 0x7E with the actual Terminus Bold glyphs in 'tools/golden/terminus_bold_12x24.txt' and prints the number
+ * of differing pixels per glyph. Pass "--show" to additionally print each differing glyph side by side
+ * (synthesized, golden, difference with 'o' for extra and 'X' for missing pixels).
+ *
+ * Acceptance thresholds:
+ * - In total, at most 12% of the golden glyphs' set pixels may differ (maxTotalDiffRatio).
+ * - Per glyph, at most 40% of the golden glyph's set pixels may differ (maxGlyphDiffRatio). Since Terminus Bold
+ *   thickens some glyphs (e.g. 't', 'M', 'W', brackets) to the left instead of to the right like the synthesis,
+ *   the golden glyph shifted right by one pixel is compared as well and the smaller difference counts.
+ * - At most 12% of the set pixels of the status screen caption may differ (maxCaptionDiffRatio,
+ *   see StatusScreenLayout::recordStaticParts()).
+ * When the synthesis was introduced, 492 of 4308 pixels (11.4%) differed in total, '*' was the worst glyph with
+ * 15 of 41 pixels (36.6%) and 60 of 591 caption pixels (10.2%, only its two 't', 0 when shifted) differed.
+ * Returns a non-zero exit code if any threshold is exceeded.
+ *
+ * Build and run from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -D FONTS_INCLUDE_ALL -I tools/hoststub -I lightning_detector -o test_bold_font \
+ *         tools/test_bold_font.cpp lightning_detector/fonts.cpp
+ *     ./test_bold_font [--show]
+ */
+
+#include "fonts.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr double maxTotalDiffRatio = 0.12;
+constexpr double maxGlyphDiffRatio = 0.40;
+constexpr double maxCaptionDiffRatio = 0.12;
+
+const char goldenFileName[] = "tools/golden/terminus_bold_12x24.txt";
+const char caption[] = " Lightning Det. ";
+
+constexpr size_t glyphWidth = 12;
+constexpr size_t glyphHeight = 24;
+
+typedef std::vector<uint16_t> GlyphRows;
+
+/*
+ * Read the golden glyphs ("char 0x<code>" followed by one line of '#'/'.' per row; other lines starting with '#' are comments).
+ */
+bool readGolden(std::map<int, GlyphRows>& pGlyphs)
+{
+    std::ifstream file(goldenFileName);
+
+    if (!file)
+        return false;
+
+    std::string line;
+    int code = -1;
+
+    while (std::getline(file, line))
+    {
+        const bool isRow = (line.size() == glyphWidth) && (line.find_first_not_of("#.") == std::string::npos);
+
+        if (line.compare(0, 5, "char ") == 0)
+        {
+            code = std::stoi(line.substr(5), nullptr, 16);
+            pGlyphs[code].clear();
+        }
+        else if ((code >= 0) && isRow && (pGlyphs[code].size() < glyphHeight))
+        {
+            uint16_t row = 0;
+
+            for (size_t i = 0; i < glyphWidth; ++i)
+                if (line[i] == '#')
+                    row |= 0b1000000000000000 >> i;
+
+            pGlyphs[code].push_back(row);
+        }
+        else if (!line.empty() && (line[0] != '#'))
+            return false;
+    }
+
+    for (const auto& glyph : pGlyphs)
+        if (glyph.second.size() != glyphHeight)
+            return false;
+
+    return !pGlyphs.empty();
+}
+
+int countPixels(uint16_t pRow)
+{
+    return __builtin_popcount(pRow);
+}
+
+/*
+ * Print synthesized and golden glyph side by side, plus their difference.
+ */
+void showGlyph(const uint16_t* pSynthesized, const GlyphRows& pGolden)
+{
+    for (size_t j = 0; j < glyphHeight; ++j)
+    {
+        std::string synthesized, golden, diff;
+
+        for (size_t i = 0; i < glyphWidth; ++i)
+        {
+            const bool s = (pSynthesized[j] & (0b1000000000000000 >> i)) != 0;
+            const bool g = (pGolden[j] & (0b1000000000000000 >> i)) != 0;
+
+            synthesized += s ? '#' : '.';
+            golden += g ? '#' : '.';
+            diff += (s == g) ? (s ? '#' : '.') : (s ? 'o' : 'X');
+        }
+
+        std::printf("    %s   %s   %s\n", synthesized.c_str(), golden.c_str(), diff.c_str());
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool show = (argc == 2) && (std::strcmp(argv[1], "--show") == 0);
+
+    if ((argc > 1) && !show)
+    {
+        std::fprintf(stderr, "Usage: %s [--show]\n", argv[0]);
+        return 1;
+    }
+
+    const Font& font = Font_TerminASCII24Bold;
+
+    if ((font.width != glyphWidth) || (font.height != glyphHeight) || !font.bold)
+    {
+        std::fprintf(stderr, "Error: Font_TerminASCII24Bold is not a synthesized bold font of size 12x24.\n");
+        return 1;
+    }
+
+    std::map<int, GlyphRows> goldenGlyphs;
+
+    if (!readGolden(goldenGlyphs))
+    {
+        std::fprintf(stderr, "Error: Could not read \"%s\" (run from the 'Firmware' directory).\n", goldenFileName);
+        return 1;
+    }
+
+    std::map<int, int> glyphDiffs;
+    std::map<int, int> glyphPixels;
+    int totalDiffs = 0;
+    int totalPixels = 0;
+    double maxAlignedDiffRatio = 0;
+    bool passed = true;
+
+    for (const auto& golden : goldenGlyphs)
+    {
+        const int code = golden.first;
+
+        uint16_t rows[Font::maxHeight];
+
+        if (!font.decodeGlyph(static_cast<uint8_t>(code), rows))
+        {
+            std::printf("Glyph 0x%02X missing\n", code);
+            passed = false;
+            continue;
+        }
+
+        int diffs = 0;
+        int shiftedDiffs = 0;
+        int pixels = 0;
+
+        for (size_t j = 0; j < glyphHeight; ++j)
+        {
+            diffs += countPixels(rows[j] ^ golden.second[j]);
+            shiftedDiffs += countPixels(rows[j] ^ static_cast<uint16_t>(golden.second[j] >> 1));
+            pixels += countPixels(golden.second[j]);
+        }
+
+        const int alignedDiffs = std::min(diffs, shiftedDiffs);
+
+        glyphDiffs[code] = diffs;
+        glyphPixels[code] = pixels;
+        totalDiffs += diffs;
+        totalPixels += pixels;
+        maxAlignedDiffRatio = std::max(maxAlignedDiffRatio, static_cast<double>(alignedDiffs) / pixels);
+
+        if (diffs == 0)
+            continue;
+
+        std::printf("Glyph 0x%02X '%c': %2d of %2d pixels differ, %2d when shifted%s\n", code, code, diffs, pixels, shiftedDiffs,
+                    (alignedDiffs > maxGlyphDiffRatio * pixels) ? " (exceeds threshold)" : "");
+
+        if (show)
+            showGlyph(rows, golden.second);
+    }
+
+    int captionDiffs = 0;
+    int captionPixels = 0;
+
+    for (const char* c = caption; *c != '\0'; ++c)
+    {
+        captionDiffs += glyphDiffs[static_cast<uint8_t>(*c)];
+        captionPixels += glyphPixels[static_cast<uint8_t>(*c)];
+    }
+
+    const double totalRatio = (totalPixels > 0) ? static_cast<double>(totalDiffs) / totalPixels : 0;
+    const double captionRatio = (captionPixels > 0) ? static_cast<double>(captionDiffs) / captionPixels : 0;
+
+    std::printf("\nTotal:   %4d of %4d pixels differ (%.1f%%, threshold %.1f%%)\n", totalDiffs, totalPixels,
+                100*totalRatio, 100*maxTotalDiffRatio);
+    std::printf("Glyph:   %.1f%% of pixels differ at most, allowing a shift (threshold %.1f%%)\n", 100*maxAlignedDiffRatio,
+                100*maxGlyphDiffRatio);
+    std::printf("Caption: %4d of %4d pixels differ (%.1f%%, threshold %.1f%%)\n", captionDiffs, captionPixels,
+                100*captionRatio, 100*maxCaptionDiffRatio);
+
+    passed = passed && (totalRatio <= maxTotalDiffRatio) && (maxAlignedDiffRatio <= maxGlyphDiffRatio) && (captionRatio <= maxCaptionDiffRatio);
+
+    std::printf("%s\n", passed ? "Passed." : "FAILED.");
+
+    return passed ? 0 : 1;
+}
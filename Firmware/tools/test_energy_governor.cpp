@@ -0,0 +1,228 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host simulation of the EnergyGovernor tier policy (see energygovernor.h).
+ *
+ * Drives the governor with the tier table of the firmware ('energyTiers' in energytiers.h) over a simulated coin cell discharge curve with voltage fluctuations and lightning bursts,
+ * and checks tier selection with hysteresis, beep coalescing and the AS3935 duty cycle.
+ * Prints a summary per tier and returns a non-zero exit code if any check fails.
+ * Pass "--trace" to additionally print the simulated course as CSV.
+ *
+ * Build and run from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -I tools/hoststub -I lightning_detector -o test_energy_governor \
+ *         tools/test_energy_governor.cpp lightning_detector/energygovernor.cpp
+ *     ./test_energy_governor
+ */
+
+#include "energygovernor.h"
+#include "energytiers.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t numTiers = sizeof(energyTiers) / sizeof(energyTiers[0]);
+
+size_t numFailures = 0;
+
+/*!
+ * \brief Record a failed check.
+ *
+ * \param pOk Check result.
+ * \param pWhat Description of the check.
+ * \param pTime Simulated time in seconds.
+ */
+void check(bool pOk, const char* pWhat, size_t pTime)
+{
+    if (pOk)
+        return;
+
+    if (numFailures < 20)
+        std::fprintf(stderr, "FAIL at t = %zu s: %s\n", pTime, pWhat);
+
+    ++numFailures;
+}
+
+/*!
+ * \brief Expected tier for a percentage without hysteresis (i.e. on the way down).
+ *
+ * \param pPercentage Battery percentage.
+ * \return Index of the first tier with a threshold not above \p pPercentage.
+ */
+size_t tierBelow(float pPercentage)
+{
+    size_t idx = 0;
+    while ((idx+1 < numTiers) && (pPercentage < energyTiers[idx].minBatteryPercentage))
+        ++idx;
+    return idx;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool trace = (argc > 1) && (std::strcmp(argv[1], "--trace") == 0);
+
+    EnergyGovernor governor(energyTiers, numTiers, energyTierHysteresisPercent);
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> noise(-3., 3.);   //Coin cell voltage fluctuations mapped to percent
+
+    //Simulated discharge: 100% -> 0% over 60 days, one step per minute (~ VDD measurement interval lower bound)
+    constexpr size_t stepSecs = 60;
+    constexpr size_t totalSecs = 60*24*3600;
+
+    struct TierStats
+    {
+        size_t secs = 0;
+        size_t beepRequests = 0;
+        size_t beepsGranted = 0;
+        size_t as3935OnSecs = 0;
+    };
+    std::vector<TierStats> stats(numTiers);
+
+    size_t secsSinceGrantedBeep = std::numeric_limits<size_t>::max();
+    bool lastAS3935On = true;
+    size_t as3935PhaseSecs = 0;
+
+    if (trace)
+        std::printf("time_s,percentage,tier,as3935_on,beeps\n");
+
+    for (size_t t = 0; t < totalSecs; t += stepSecs)
+    {
+        const float truePercentage = 100.f * (1.f - static_cast<float>(t) / totalSecs);
+        const float measured = std::max(0.f, std::min(100.f, truePercentage + noise(rng)));
+
+        const size_t prevTier = governor.getTierIndex();
+        const bool changed = governor.updateBatteryPercentage(measured);
+        const size_t tier = governor.getTierIndex();
+
+        //Hysteresis: downward moves follow the thresholds exactly, upward moves need the extra margin
+        check(changed == (tier != prevTier), "return value of updateBatteryPercentage()", t);
+        if (tier > prevTier)
+            check(tier == tierBelow(measured), "moved down to wrong tier", t);
+        else if (tier < prevTier)
+            check(measured >= energyTiers[tier].minBatteryPercentage + energyTierHysteresisPercent, "moved up without hysteresis margin", t);
+        else if (tier > 0)
+            check(measured < energyTiers[tier-1].minBatteryPercentage + energyTierHysteresisPercent, "missed move up", t);
+
+        //Tier never more than one threshold crossing away from the noise-free tier
+        check((tier + 1 >= tierBelow(truePercentage)) && (tier <= tierBelow(truePercentage) + 1), "tier far from discharge curve", t);
+
+        if (changed)
+        {
+            as3935PhaseSecs = 0;
+            lastAS3935On = true;
+            check(governor.as3935Enabled(), "duty cycle does not restart with on phase after tier change", t);
+        }
+
+        //Lightning burst: one beep request per 5 seconds during the first half of each hour
+        size_t beeps = 0;
+        for (size_t s = 0; s < stepSecs; s += 5)
+        {
+            const bool burst = ((t + s) % 3600) < 1800;
+
+            if (burst)
+            {
+                ++stats[tier].beepRequests;
+
+                const bool granted = governor.requestBeep();
+                const bool expected = secsSinceGrantedBeep >= energyTiers[tier].beepCoalesceSecs;
+
+                check(granted == expected, "beep coalescing", t + s);
+
+                if (granted)
+                {
+                    ++stats[tier].beepsGranted;
+                    ++beeps;
+                    secsSinceGrantedBeep = 0;
+                }
+            }
+
+            governor.advanceTime(5);
+            if (secsSinceGrantedBeep < std::numeric_limits<size_t>::max() - 5)
+                secsSinceGrantedBeep += 5;
+
+            //Duty cycle: phases last exactly their configured lengths (time steps divide the phase lengths)
+            const EnergyGovernor::Tier& tierEntry = energyTiers[tier];
+            const bool on = governor.as3935Enabled();
+
+            as3935PhaseSecs += 5;
+
+            if (tierEntry.as3935OffMins == 0)
+                check(on, "AS3935 off in tier without duty cycle", t + s);
+            else if (on != lastAS3935On)
+            {
+                check(as3935PhaseSecs == 60 * (lastAS3935On ? tierEntry.as3935OnMins : tierEntry.as3935OffMins),
+                      "wrong AS3935 duty cycle phase length", t + s);
+                as3935PhaseSecs = 0;
+            }
+
+            lastAS3935On = on;
+
+            if (on)
+                stats[tier].as3935OnSecs += 5;
+        }
+
+        stats[tier].secs += stepSecs;
+
+        if (trace)
+            std::printf("%zu,%.2f,%zu,%d,%zu\n", t, measured, tier, governor.as3935Enabled() ? 1 : 0, beeps);
+    }
+
+    check(governor.getTierIndex() == numTiers - 1, "not in last tier at end of discharge", totalSecs);
+
+    std::fprintf(stderr, "tier  hours  beeps/requests  AS3935 on [%%]\n");
+    for (size_t i = 0; i < numTiers; ++i)
+    {
+        check(stats[i].secs > 0, "tier never selected", totalSecs);
+
+        //Duty cycle restarts with the "on" phase after each tier change, hence allow some excess "on" time
+        const EnergyGovernor::Tier& tierEntry = energyTiers[i];
+        const float onFraction = static_cast<float>(stats[i].as3935OnSecs) / stats[i].secs;
+        const float nominalOnFraction = (tierEntry.as3935OffMins == 0) ? 1.f :
+                                            static_cast<float>(tierEntry.as3935OnMins) / (tierEntry.as3935OnMins + tierEntry.as3935OffMins);
+        check((onFraction >= nominalOnFraction - 0.01f) && (onFraction <= nominalOnFraction + 0.1f), "AS3935 duty cycle ratio", totalSecs);
+
+        std::fprintf(stderr, "%4zu %6.1f  %6zu/%-7zu  %5.1f\n", i, stats[i].secs / 3600.,
+                     stats[i].beepsGranted, stats[i].beepRequests,
+                     stats[i].secs ? 100. * stats[i].as3935OnSecs / stats[i].secs : 0.);
+    }
+
+    if (numFailures > 0)
+    {
+        std::fprintf(stderr, "%zu check(s) failed.\n", numFailures);
+        return 1;
+    }
+
+    std::fprintf(stderr, "All checks passed.\n");
+    return 0;
+}
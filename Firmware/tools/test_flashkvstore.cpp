@@ -0,0 +1,513 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host test for FlashKVStore (see flashkvstore.h) with a simulated flash and NVMC.
+ *
+ * The simulated flash consists of 4 pages in memory mapped between two inaccessible guard pages (such that reads
+ * outside of the flash, e.g. at address 0 or beyond the last page, crash the test). The NVMC simulation performs
+ * page erases and can simulate a power loss before any flash operation (word write or page erase) or in the middle
+ * of a page erase (leaving a random part of the page's bits set).
+ * Checks:
+ * - Random writes and removals of a few keys against a reference model (including re-initialization via setup()),
+ *   starting from a never erased region; also checks that only erased words are written (or written words cleared).
+ * - Power loss at every possible point during a write (with and without compaction): the value must afterwards
+ *   be the old or the new one and the store must stay writable.
+ * - Power loss in the middle of the page erase of a compaction, with an old valid header on the erased page:
+ *   all values must be kept (the half-erased page must not become active) and the store must stay writable.
+ * - Corrupted record headers (bit errors, garbage): a length beyond maxLength in the middle of the records and a
+ *   record exceeding the page at its end. Records before the corruption must stay readable and the store must
+ *   stay writable (via compaction if the region has more than one page).
+ * Returns a non-zero exit code if any check fails.
+ *
+ * Build and run from the 'Firmware' directory (Linux):
+ *
+ *     g++ -std=gnu++17 -I tools/hoststub -I lightning_detector -o test_flashkvstore \
+ *         tools/test_flashkvstore.cpp lightning_detector/auxil.cpp
+ *     ./test_flashkvstore
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+//Simulated NVMC (must precede flashkvstore.cpp, which is compiled as part of this file to use it)
+
+struct NVMCReady
+{
+    operator uint32_t() const;                  //Reading READY may simulate a power loss (see flashOpsUntilPowerLoss)
+};
+
+struct NVMCErasePage
+{
+    NVMCErasePage& operator=(uintptr_t pAddr);  //Erase the page at pAddr
+};
+
+struct NRF_NVMC_Type
+{
+    NVMCReady READY;
+    uint32_t CONFIG;
+    NVMCErasePage ERASEPAGE;
+};
+
+#define NVMC_CONFIG_WEN_Ren 0
+#define NVMC_CONFIG_WEN_Wen 1
+#define NVMC_CONFIG_WEN_Een 2
+
+NRF_NVMC_Type simulatedNVMC = {};
+NRF_NVMC_Type* const NRF_NVMC = &simulatedNVMC;
+
+#include "flashkvstore.cpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <sys/mman.h>
+
+namespace
+{
+
+constexpr size_t pageSize = FlashKVStore::pageSize;
+constexpr size_t numFlashPages = 4;
+
+uint8_t* flash = nullptr;                   //Simulated flash (numFlashPages pages between two guard pages)
+std::vector<uintptr_t> erasedPages;         //Pages erased since last snapshot (see takeSnapshot())
+std::vector<uint8_t> snapshot;              //Flash content at last snapshot
+
+long flashOpsUntilPowerLoss = -1;           //Number of flash operations to complete before a simulated power loss (-1: never)
+long readyPolls = 0;                        //Number of READY polls since the last setting of flashOpsUntilPowerLoss
+long erasesUntilPowerLoss = -1;             //Number of page erases to complete before a power loss in the middle of an erase (-1: never)
+std::mt19937 partialEraseRng;               //Selects the bits that are already set by an interrupted page erase
+
+int numFailedChecks = 0;
+
+/*
+ * Thrown by the NVMC simulation to abort the current store operation like a power loss.
+ */
+struct PowerLoss
+{
+};
+
+} // namespace
+
+NVMCReady::operator uint32_t() const
+{
+    //Each flash operation polls READY once before and once after (see FlashKVStore::writeWord(), erasePage())
+    if ((flashOpsUntilPowerLoss >= 0) && (readyPolls++ == 2*flashOpsUntilPowerLoss))
+        throw PowerLoss();
+
+    return 1;
+}
+
+NVMCErasePage& NVMCErasePage::operator=(uintptr_t pAddr)
+{
+    if ((simulatedNVMC.CONFIG != NVMC_CONFIG_WEN_Een) || (pAddr % pageSize != 0) ||
+        (pAddr < reinterpret_cast<uintptr_t>(flash)) || (pAddr >= reinterpret_cast<uintptr_t>(flash) + numFlashPages*pageSize))
+    {
+        std::printf("  FAILED: Invalid page erase at 0x%lX\n", static_cast<unsigned long>(pAddr));
+        ++numFailedChecks;
+        return *this;
+    }
+
+    if (erasesUntilPowerLoss == 0)
+    {
+        erasesUntilPowerLoss = -1;
+
+        //Some words are already erased, some partially and some not yet
+        for (size_t i = 0; i < pageSize; i += 4)
+        {
+            uint32_t word;
+            std::memcpy(&word, reinterpret_cast<void*>(pAddr + i), 4);
+
+            const uint32_t progress = partialEraseRng() % 3;
+
+            if (progress == 0)
+                word = 0xFFFFFFFF;
+            else if (progress == 1)
+                word |= partialEraseRng();
+
+            std::memcpy(reinterpret_cast<void*>(pAddr + i), &word, 4);
+        }
+
+        throw PowerLoss();
+    }
+
+    if (erasesUntilPowerLoss > 0)
+        --erasesUntilPowerLoss;
+
+    std::memset(reinterpret_cast<void*>(pAddr), 0xFF, pageSize);
+    erasedPages.push_back(pAddr);
+
+    return *this;
+}
+
+namespace
+{
+
+void check(bool pCondition, const char* pWhat)
+{
+    if (pCondition)
+        return;
+
+    std::printf("  FAILED: %s\n", pWhat);
+    ++numFailedChecks;
+}
+
+/*
+ * Map the simulated flash between two inaccessible guard pages.
+ */
+bool mapFlash()
+{
+    void* mapping = mmap(nullptr, (numFlashPages + 2)*pageSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED)
+        return false;
+
+    flash = static_cast<uint8_t*>(mapping) + pageSize;
+
+    return mprotect(flash, numFlashPages*pageSize, PROT_READ | PROT_WRITE) == 0;
+}
+
+uintptr_t pageAddr(size_t pPage)
+{
+    return reinterpret_cast<uintptr_t>(flash) + pPage*pageSize;
+}
+
+void fillFlash(uint8_t pValue)
+{
+    std::memset(flash, pValue, numFlashPages*pageSize);
+}
+
+void takeSnapshot()
+{
+    snapshot.assign(flash, flash + numFlashPages*pageSize);
+    erasedPages.clear();
+}
+
+/*
+ * Check that all words changed since the last snapshot were erased before or cleared to 0 (NOR flash can only clear bits).
+ */
+bool onlyErasedWordsWritten()
+{
+    for (size_t i = 0; i < numFlashPages*pageSize; i += 4)
+    {
+        uint32_t before, after;
+        std::memcpy(&before, &snapshot[i], 4);
+        std::memcpy(&after, &flash[i], 4);
+
+        if ((before == after) || (before == 0xFFFFFFFF) || (after == 0))
+            continue;
+
+        bool erased = false;
+
+        for (uintptr_t page : erasedPages)
+            if ((reinterpret_cast<uintptr_t>(&flash[i]) >= page) && (reinterpret_cast<uintptr_t>(&flash[i]) < page + pageSize))
+                erased = true;
+
+        if (!erased)
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * Overwrite a word of the simulated flash (bypassing the NVMC, like a bit error).
+ */
+void corruptWord(uintptr_t pAddr, uint32_t pValue)
+{
+    std::memcpy(reinterpret_cast<void*>(pAddr), &pValue, 4);
+}
+
+uint32_t recordHeader(uint16_t pKey, uint16_t pLength)
+{
+    return (static_cast<uint32_t>(pKey) << 16) | pLength;
+}
+
+bool readWord(FlashKVStore& pStore, uint16_t pKey, uint32_t& pValue)
+{
+    return pStore.read(pKey, &pValue, sizeof(pValue));
+}
+
+bool writeWord(FlashKVStore& pStore, uint16_t pKey, uint32_t pValue)
+{
+    return pStore.write(pKey, &pValue, sizeof(pValue));
+}
+
+//
+
+void testRandomOperations()
+{
+    std::printf("Random operations:\n");
+
+    fillFlash(0x5A);    //Never erased region
+
+    std::mt19937 rng(1);
+    std::map<uint16_t, std::vector<uint8_t>> model;
+
+    FlashKVStore* store = new FlashKVStore(pageAddr(0), numFlashPages);
+    store->setup();
+
+    for (int op = 0; (op < 20000) && (numFailedChecks == 0); ++op)
+    {
+        const uint16_t key = rng() % 6;
+
+        takeSnapshot();
+
+        if (rng() % 10 == 0)
+        {
+            check(store->remove(key), "remove() succeeds");
+            model.erase(key);
+        }
+        else
+        {
+            uint8_t value[40];
+            const size_t length = rng() % sizeof(value);
+
+            for (size_t i = 0; i < length; ++i)
+                value[i] = static_cast<uint8_t>(rng());
+
+            check(store->write(key, value, length), "write() succeeds");
+            model[key].assign(value, value + length);
+        }
+
+        check(onlyErasedWordsWritten(), "only erased words are written (or written words cleared)");
+
+        if (op % 997 == 0)
+        {
+            delete store;
+            store = new FlashKVStore(pageAddr(0), numFlashPages);
+            store->setup();
+        }
+
+        for (uint16_t k = 0; k < 6; ++k)
+        {
+            uint8_t buffer[40];
+
+            const auto it = model.find(k);
+
+            if (it == model.end())
+            {
+                for (size_t length = 0; length < sizeof(buffer); ++length)
+                    check(!store->read(k, buffer, length), "removed/unset key cannot be read");
+            }
+            else
+            {
+                check(store->read(k, buffer, it->second.size()) && std::equal(it->second.begin(), it->second.end(), buffer),
+                      "read() returns last written value");
+                check(!store->read(k, buffer, it->second.size() + 1), "read() with wrong length fails");
+            }
+        }
+    }
+
+    delete store;
+}
+
+void testPowerLoss()
+{
+    std::printf("Power loss during writes:\n");
+
+    fillFlash(0xFF);
+
+    for (int n = 0; (n < 400) && (numFailedChecks == 0); ++n)
+    {
+        FlashKVStore store(pageAddr(0), numFlashPages);
+        store.setup();
+
+        const uint32_t oldValue = 0x1000 + n;
+        const uint32_t newValue = 0x2000 + n;
+
+        check(writeWord(store, 7, oldValue), "write() succeeds");
+
+        //Fill the page with other records (compaction happens during some of the interrupted writes)
+        for (int i = 0; i < (n % 7)*150; ++i)
+            writeWord(store, 9, i);
+
+        flashOpsUntilPowerLoss = n % 9;
+        readyPolls = 0;
+
+        bool lost = false;
+
+        try
+        {
+            writeWord(store, 7, newValue);
+        }
+        catch (const PowerLoss&)
+        {
+            lost = true;
+        }
+
+        flashOpsUntilPowerLoss = -1;
+
+        FlashKVStore restarted(pageAddr(0), numFlashPages);
+        restarted.setup();
+
+        uint32_t value = 0;
+        check(readWord(restarted, 7, value) && ((value == oldValue) || (value == newValue)), "old or new value after power loss");
+        check(lost || (value == newValue), "new value without power loss");
+
+        check(writeWord(restarted, 7, 0) && readWord(restarted, 7, value) && (value == 0), "store is writable after power loss");
+    }
+}
+
+void testPowerLossDuringErase()
+{
+    std::printf("Power loss during page erase:\n");
+
+    constexpr int recordsPerPage = (pageSize - 8) / 12;     //Records with 4 byte values after the page header
+
+    for (int n = 0; (n < 300) && (numFailedChecks == 0); ++n)
+    {
+        fillFlash(0xFF);
+
+        FlashKVStore store(pageAddr(0), numFlashPages);
+        store.setup();
+
+        const uint32_t value7 = 0x1000 + n;
+
+        check(writeWord(store, 7, value7), "write() succeeds");
+
+        //Fill all pages once, such that the next compaction erases a page with an old valid header
+        int i = 0;
+
+        for (; i < static_cast<int>(numFlashPages - 1)*recordsPerPage + (n % 50); ++i)
+            writeWord(store, 9, i);
+
+        partialEraseRng.seed(n);
+        erasesUntilPowerLoss = 0;
+
+        bool lost = false;
+
+        try
+        {
+            for (int j = 0; j < recordsPerPage; ++j, ++i)
+                writeWord(store, 9, i);
+        }
+        catch (const PowerLoss&)
+        {
+            lost = true;
+        }
+
+        erasesUntilPowerLoss = -1;
+
+        check(lost, "compaction erases a page");
+
+        FlashKVStore restarted(pageAddr(0), numFlashPages);
+        restarted.setup();
+
+        uint32_t value = 0;
+        check(readWord(restarted, 7, value) && (value == value7), "value is kept after power loss during erase");
+        check(readWord(restarted, 9, value) && (value == static_cast<uint32_t>(i - 1)), "last value is kept after power loss during erase");
+
+        check(writeWord(restarted, 9, 0) && readWord(restarted, 9, value) && (value == 0) &&
+              readWord(restarted, 7, value) && (value == value7), "store is writable after power loss during erase");
+    }
+}
+
+void testCorruptedHeaders()
+{
+    std::printf("Corrupted record headers:\n");
+
+    constexpr size_t recordSize = 12;           //Header, 4 byte value, CRC-32
+    constexpr uintptr_t firstRecordOfs = 8;     //After page header
+
+    //Length beyond maxLength in the middle of the records (region of 2 pages)
+    {
+        fillFlash(0xFF);
+
+        FlashKVStore store(pageAddr(2), 2);
+        store.setup();
+
+        check(writeWord(store, 1, 0x11) && writeWord(store, 2, 0x22) && writeWord(store, 3, 0x33), "write() succeeds");
+
+        corruptWord(pageAddr(2) + firstRecordOfs + recordSize, recordHeader(2, FlashKVStore::maxLength + 1));
+
+        FlashKVStore restarted(pageAddr(2), 2);
+        restarted.setup();
+
+        uint32_t value = 0;
+        check(readWord(restarted, 1, value) && (value == 0x11), "record before corrupted header is readable");
+        check(!readWord(restarted, 2, value), "record with corrupted header is not readable");
+        check(!readWord(restarted, 3, value), "record after corrupted header is not readable");
+
+        check(writeWord(restarted, 3, 0x34), "write() after corrupted header succeeds (compaction)");
+        check(readWord(restarted, 1, value) && (value == 0x11), "record before corrupted header is kept by compaction");
+        check(readWord(restarted, 3, value) && (value == 0x34), "new value after compaction is readable");
+
+        FlashKVStore restartedAgain(pageAddr(2), 2);
+        restartedAgain.setup();
+
+        check(readWord(restartedAgain, 1, value) && (value == 0x11) && readWord(restartedAgain, 3, value) && (value == 0x34),
+              "values are kept after restart");
+    }
+
+    //Record exceeding the page at its end (single page region directly before the guard page, i.e. no compaction)
+    {
+        fillFlash(0xFF);
+
+        FlashKVStore store(pageAddr(numFlashPages - 1), 1);
+        store.setup();
+
+        constexpr size_t numRecords = (pageSize - firstRecordOfs) / recordSize - 1;
+
+        check(writeWord(store, 1, 0x11), "write() succeeds");
+
+        for (size_t i = 1; i < numRecords; ++i)
+            check(writeWord(store, 9, i), "write() succeeds");
+
+        //Header of a record (key 1) with 24 bytes in the last 20 bytes of the page
+        corruptWord(pageAddr(numFlashPages - 1) + firstRecordOfs + numRecords*recordSize, recordHeader(1, 16));
+
+        FlashKVStore restarted(pageAddr(numFlashPages - 1), 1);
+        restarted.setup();
+
+        uint32_t value = 0;
+        check(readWord(restarted, 1, value) && (value == 0x11), "record before corrupted header is readable");
+        check(readWord(restarted, 9, value) && (value == numRecords - 1), "last record before corrupted header is readable");
+        check(!writeWord(restarted, 1, 0x12), "write() fails for a full single page");
+        check(readWord(restarted, 1, value) && (value == 0x11), "value is kept after failed write()");
+    }
+}
+
+} // namespace
+
+int main()
+{
+    if (!mapFlash())
+    {
+        std::fprintf(stderr, "Error: Could not map the simulated flash.\n");
+        return 1;
+    }
+
+    testRandomOperations();
+    testPowerLoss();
+    testPowerLossDuringErase();
+    testCorruptedHeaders();
+
+    std::printf("%s\n", (numFailedChecks == 0) ? "All checks passed." : "Some checks FAILED.");
+
+    return (numFailedChecks == 0) ? 0 : 1;
+}
@@ -0,0 +1,459 @@
+/*
+////////////////////////////////////////////////////////////////////////////////////
+//
+//  This file is part of the firmware of Lightning Detector, an experimental open
+//  hardware project for early notification about approaching thunderstorm activity.
+//  Copyright (C) 2024–2025 M. Frohne
+//
+//  Lightning Detector's firmware is free software: you can redistribute it
+//  and/or modify it under the terms of the GNU General Public License
+//  as published by the Free Software Foundation, either version 3
+//  of the License, or (at your option) any later version.
+//
+//  Lightning Detector's firmware is distributed in the hope that it
+//  will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//  See the GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with Lightning Detector. If not, see <https://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////////
+*/
+
+/*
+ * Host golden-image test for the graphics primitives of ArduinoGraphics and MonoFramebuffer.
+ *
+ * Draws a few test scenes (rectangles, lines, ellipses and text, each also partially or fully outside of the image)
+ * into a 64x48 pixels image and compares the result with the golden images 'tools/golden/graphics_<scene>.pbm'.
+ * Scenes without ellipses are additionally drawn with MonoFramebuffer in bands of 7 rows (to exercise the clipping
+ * to the band) and compared with the same golden images. Also checks that ArduinoGraphics never calls set() for
+ * pixels outside of the image. Returns a non-zero exit code if any check fails.
+ *
+ * Pass "--update" to (re)write the golden images from the ArduinoGraphics output instead, e.g. after an intended
+ * change of the rasterization; inspect the changed images (plain PBM format, '1' being black) before committing them.
+ *
+ * Build and run from the 'Firmware' directory:
+ *
+ *     g++ -std=gnu++17 -D FONTS_INCLUDE_ALL -I tools/hoststub -I lightning_detector -o test_graphics \
+ *         tools/test_graphics.cpp lightning_detector/arduinographics.cpp lightning_detector/fonts.cpp
+ *     ./test_graphics
+ */
+
+#include "arduinographics.h"
+#include "fonts.h"
+#include "monoframebuffer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace
+{
+
+constexpr int imageWidth = 64;
+constexpr int imageHeight = 48;
+constexpr int bandRows = 7;
+
+const char goldenDir[] = "tools/golden";
+
+/*
+ * Monochrome image (true for white pixels) as compared with the golden images.
+ */
+struct Image
+{
+    bool pixels[imageHeight][imageWidth];
+};
+
+/*
+ * ArduinoGraphics that records into an Image and counts calls of set() outside of the image.
+ */
+class ImageGraphics : public ArduinoGraphics
+{
+public:
+    ImageGraphics(Image& pImage) :
+        ArduinoGraphics(imageWidth, imageHeight),
+        image(pImage),
+        numOutsideSets(0)
+    {
+    }
+
+    void set(int pX, int pY, uint8_t pR, uint8_t pG, uint8_t pB) override
+    {
+        if ((pX < 0) || (pX >= imageWidth) || (pY < 0) || (pY >= imageHeight))
+        {
+            ++numOutsideSets;
+            return;
+        }
+
+        image.pixels[pY][pX] = ((pR > 0) || (pG > 0) || (pB > 0));
+    }
+
+    int getNumOutsideSets() const
+    {
+        return numOutsideSets;
+    }
+
+private:
+    Image& image;
+    int numOutsideSets;
+};
+
+typedef MonoFramebuffer<imageWidth, bandRows> BandFramebuffer;
+
+//
+
+/*
+ * Rectangles: outlines, fills with and without stroke, degenerate sizes and clipping.
+ */
+template<class GraphicsT>
+void drawRects(GraphicsT& pGraphics)
+{
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.noFill();
+    pGraphics.rect(2, 2, 20, 10);
+    pGraphics.rect(24, 2, 1, 1);
+    pGraphics.rect(27, 2, 8, 1);
+    pGraphics.rect(37, 2, 1, 8);
+    pGraphics.rect(40, 2, 2, 2);
+
+    pGraphics.fill(0, 0, 0);
+    pGraphics.rect(2, 14, 16, 12);
+
+    pGraphics.noStroke();
+    pGraphics.rect(20, 14, 10, 10);
+
+    pGraphics.fill(255, 255, 255);
+    pGraphics.rect(22, 16, 6, 6);
+
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.rect(4, 16, 12, 8);
+    pGraphics.rect(33, 14, 27, 13);
+
+    pGraphics.noFill();
+    pGraphics.rect(-5, 30, 12, 8);
+    pGraphics.rect(58, 40, 12, 12);
+    pGraphics.rect(-3, -3, 70, 54);
+    pGraphics.rect(70, 0, 5, 5);
+    pGraphics.rect(10, -20, 5, 5);
+
+    pGraphics.fill(0, 0, 0);
+    pGraphics.rect(20, 44, 30, 10);
+}
+
+/*
+ * Lines: horizontal and vertical in both directions, flat/steep/diagonal oblique lines, points and clipping.
+ */
+template<class GraphicsT>
+void drawLines(GraphicsT& pGraphics)
+{
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.line(2, 1, 40, 1);
+    pGraphics.line(40, 3, 4, 3);
+    pGraphics.line(1, 5, 1, 30);
+    pGraphics.line(3, 40, 3, 8);
+    pGraphics.line(5, 5, 60, 20);
+    pGraphics.line(10, 10, 20, 45);
+    pGraphics.line(30, 10, 50, 30);
+    pGraphics.line(60, 44, 6, 30);
+    pGraphics.line(44, 46, 34, 12);
+    pGraphics.line(-10, -3, 70, 50);
+    pGraphics.line(50, -30, 63, 100);
+    pGraphics.line(-10, -10, -1, -40);
+    pGraphics.line(20, 60, 40, 50);
+    pGraphics.point(62, 46);
+    pGraphics.point(64, 0);
+    pGraphics.point(0, -1);
+
+    pGraphics.noStroke();
+    pGraphics.line(5, 40, 30, 47);
+}
+
+/*
+ * Ellipses and circles: outlines, fills, odd and even diameters, tiny sizes and clipping (ArduinoGraphics only).
+ */
+void drawEllipses(ArduinoGraphics& pGraphics)
+{
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.noFill();
+    pGraphics.ellipse(16, 12, 28, 20);
+    pGraphics.circle(44, 12, 17);
+    pGraphics.circle(58, 5, 8);
+    pGraphics.ellipse(4, 26, 1, 1);
+    pGraphics.ellipse(9, 26, 2, 3);
+
+    pGraphics.fill(0, 0, 0);
+    pGraphics.noStroke();
+    pGraphics.rect(0, 30, 40, 18);
+
+    pGraphics.fill(255, 255, 255);
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.ellipse(20, 38, 30, 14);
+
+    pGraphics.fill(0, 0, 0);
+    pGraphics.noStroke();
+    pGraphics.ellipse(48, 32, 9, 12);
+
+    pGraphics.noFill();
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.ellipse(60, 44, 20, 30);
+    pGraphics.circle(-2, 20, 10);
+}
+
+/*
+ * Text: regular font, line break, characters without glyph and clipping at all image edges.
+ */
+template<class GraphicsT>
+void drawText(GraphicsT& pGraphics)
+{
+    pGraphics.stroke(0, 0, 0);
+    pGraphics.textFont(&Font_TerminASCII24);
+    pGraphics.text("Ab1\n%", 2, 0);
+    pGraphics.text("Q", -5, 24);
+    pGraphics.text("W", 58, 30);
+    pGraphics.text("g", 40, -10);
+    pGraphics.text("\x01", 52, 40);
+}
+
+/*
+ * Test scene with a drawing function for ArduinoGraphics and (optionally) one for MonoFramebuffer.
+ */
+struct Scene
+{
+    const char* name;
+    void (*drawGraphics)(ArduinoGraphics&);
+    void (*drawMono)(BandFramebuffer&);
+};
+
+const Scene scenes[] = {
+    {"rects",       drawRects<ArduinoGraphics>,     drawRects<BandFramebuffer>},
+    {"lines",       drawLines<ArduinoGraphics>,     drawLines<BandFramebuffer>},
+    {"ellipses",    drawEllipses,                   nullptr},
+    {"text",        drawText<ArduinoGraphics>,      drawText<BandFramebuffer>}
+};
+
+//
+
+/*
+ * Draw a scene with ArduinoGraphics on a cleared white image.
+ */
+int renderGraphics(const Scene& pScene, Image& pImage)
+{
+    ImageGraphics graphics(pImage);
+    graphics.begin();
+    graphics.background(255, 255, 255);
+    graphics.clear();
+
+    pScene.drawGraphics(graphics);
+
+    return graphics.getNumOutsideSets();
+}
+
+/*
+ * Draw a scene with MonoFramebuffer band by band on a cleared white image.
+ */
+void renderMono(const Scene& pScene, Image& pImage)
+{
+    BandFramebuffer framebuffer;
+    framebuffer.background(255, 255, 255);
+
+    for (int originY = 0; originY < imageHeight; originY += bandRows)
+    {
+        framebuffer.setOriginY(originY);
+        framebuffer.clear();
+
+        pScene.drawMono(framebuffer);
+
+        for (int y = originY; (y < originY + bandRows) && (y < imageHeight); ++y)
+            for (int x = 0; x < imageWidth; ++x)
+                pImage.pixels[y][x] = ((framebuffer.data()[BandFramebuffer::bytesPerRow*(y - originY) + x/8] & (0b10000000 >> (x % 8))) != 0);
+    }
+}
+
+/*
+ * Write an image in plain PBM format.
+ */
+bool writeImage(const std::string& pFileName, const Image& pImage, const char* pSceneName)
+{
+    std::FILE* file = std::fopen(pFileName.c_str(), "w");
+
+    if (!file)
+        return false;
+
+    std::fprintf(file, "P1\n# Golden image of scene '%s' of 'tools/test_graphics.cpp'.\n%d %d\n", pSceneName, imageWidth, imageHeight);
+
+    for (int y = 0; y < imageHeight; ++y)
+    {
+        for (int x = 0; x < imageWidth; ++x)
+            std::fputc(pImage.pixels[y][x] ? '0' : '1', file);
+
+        std::fputc('\n', file);
+    }
+
+    std::fclose(file);
+
+    return true;
+}
+
+/*
+ * Read an image in plain PBM format (with the expected dimensions).
+ */
+bool readImage(const std::string& pFileName, Image& pImage)
+{
+    std::FILE* file = std::fopen(pFileName.c_str(), "r");
+
+    if (!file)
+        return false;
+
+    auto nextToken = [file]() -> int
+    {
+        int c = std::fgetc(file);
+
+        while ((c == '#') || (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'))
+        {
+            if (c == '#')
+                while ((c != '\n') && (c != EOF))
+                    c = std::fgetc(file);
+
+            c = std::fgetc(file);
+        }
+
+        return c;
+    };
+
+    bool valid = (nextToken() == 'P') && (std::fgetc(file) == '1');
+
+    int width = 0;
+    int height = 0;
+
+    if (valid)
+    {
+        std::ungetc(nextToken(), file);
+        valid = (std::fscanf(file, "%d", &width) == 1);
+    }
+    if (valid)
+    {
+        std::ungetc(nextToken(), file);
+        valid = (std::fscanf(file, "%d", &height) == 1) && (width == imageWidth) && (height == imageHeight);
+    }
+
+    for (int y = 0; valid && (y < imageHeight); ++y)
+    {
+        for (int x = 0; valid && (x < imageWidth); ++x)
+        {
+            const int c = nextToken();
+
+            valid = (c == '0') || (c == '1');
+            pImage.pixels[y][x] = (c == '0');
+        }
+    }
+
+    std::fclose(file);
+
+    return valid;
+}
+
+/*
+ * Compare two images and print the differing pixels (if any).
+ */
+bool compareImages(const Image& pImage, const Image& pGolden, const char* pWhat)
+{
+    int numDiffs = 0;
+
+    for (int y = 0; y < imageHeight; ++y)
+        for (int x = 0; x < imageWidth; ++x)
+            if (pImage.pixels[y][x] != pGolden.pixels[y][x])
+                ++numDiffs;
+
+    if (numDiffs == 0)
+        return true;
+
+    std::printf("  %s: %d pixels differ from golden image ('X': missing black, 'o': extra black):\n", pWhat, numDiffs);
+
+    for (int y = 0; y < imageHeight; ++y)
+    {
+        std::printf("    ");
+
+        for (int x = 0; x < imageWidth; ++x)
+        {
+            if (pImage.pixels[y][x] == pGolden.pixels[y][x])
+                std::putchar(pImage.pixels[y][x] ? '.' : '#');
+            else
+                std::putchar(pImage.pixels[y][x] ? 'X' : 'o');
+        }
+
+        std::putchar('\n');
+    }
+
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool update = (argc == 2) && (std::strcmp(argv[1], "--update") == 0);
+
+    if ((argc > 1) && !update)
+    {
+        std::fprintf(stderr, "Usage: %s [--update]\n", argv[0]);
+        return 1;
+    }
+
+    bool passed = true;
+
+    for (const Scene& scene : scenes)
+    {
+        const std::string fileName = std::string(goldenDir) + "/graphics_" + scene.name + ".pbm";
+
+        Image image;
+        const int numOutsideSets = renderGraphics(scene, image);
+
+        if (update)
+        {
+            if (!writeImage(fileName, image, scene.name))
+            {
+                std::fprintf(stderr, "Error: Could not write \"%s\".\n", fileName.c_str());
+                return 1;
+            }
+
+            std::printf("Updated %s\n", fileName.c_str());
+            continue;
+        }
+
+        Image golden;
+
+        if (!readImage(fileName, golden))
+        {
+            std::fprintf(stderr, "Error: Could not read \"%s\" (run from the 'Firmware' directory).\n", fileName.c_str());
+            return 1;
+        }
+
+        std::printf("Scene '%s':\n", scene.name);
+
+        bool scenePassed = compareImages(image, golden, "ArduinoGraphics");
+
+        if (numOutsideSets != 0)
+        {
+            std::printf("  ArduinoGraphics: set() called %d times outside of the image\n", numOutsideSets);
+            scenePassed = false;
+        }
+
+        if (scene.drawMono != nullptr)
+        {
+            Image monoImage;
+            renderMono(scene, monoImage);
+
+            scenePassed = compareImages(monoImage, golden, "MonoFramebuffer") && scenePassed;
+        }
+
+        std::printf("  %s\n", scenePassed ? "passed" : "FAILED");
+
+        passed = passed && scenePassed;
+    }
+
+    if (!update)
+        std::printf("%s\n", passed ? "All scenes passed." : "Some scenes FAILED.");
+
+    return passed ? 0 : 1;
+}